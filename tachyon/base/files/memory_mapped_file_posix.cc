@@ -0,0 +1,132 @@
+// Copyright 2013 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "tachyon/base/files/memory_mapped_file.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/numerics/safe_conversions.h"
+
+namespace tachyon::base {
+
+// static
+void MemoryMappedFile::CalculateVMAlignedBoundaries(int64_t start, size_t size,
+                                                    int64_t* aligned_start,
+                                                    size_t* aligned_size,
+                                                    int32_t* offset) {
+  int64_t mask = static_cast<int64_t>(sysconf(_SC_PAGESIZE)) - 1;
+  DCHECK(IsValueInRangeForNumericType<int32_t>(mask));
+  *offset = static_cast<int32_t>(start & mask);
+  *aligned_start = start & ~mask;
+  *aligned_size = (size + static_cast<size_t>(*offset) +
+                   static_cast<size_t>(mask)) &
+                  ~static_cast<size_t>(mask);
+}
+
+bool MemoryMappedFile::MapFileRegionToMemory(
+    const MemoryMappedFile::Region& region, Access access) {
+  off_t map_start = 0;
+  size_t map_size = 0;
+  int32_t data_offset = 0;
+
+  if (region == MemoryMappedFile::Region::kWholeFile) {
+    int64_t file_len = file_.GetLength();
+    if (file_len < 0) {
+      DPLOG(ERROR) << "fstat " << file_.GetPlatformFile();
+      return false;
+    }
+    if (!IsValueInRangeForNumericType<size_t>(file_len)) return false;
+    map_size = static_cast<size_t>(file_len);
+    length_ = map_size;
+  } else {
+    // The region can be arbitrarily aligned. mmap, instead, requires both the
+    // start and size to be page-aligned. Hence, we map here the page-aligned
+    // outer region [|aligned_start|, |aligned_start| + |size|] which contains
+    // |region| and then add up the |data_offset| displacement.
+    int64_t aligned_start = 0;
+    size_t aligned_size = 0;
+    CalculateVMAlignedBoundaries(region.offset, region.size, &aligned_start,
+                                 &aligned_size, &data_offset);
+
+    // Ensure that the casts in the mmap call below are sane.
+    if (aligned_start < 0 ||
+        !IsValueInRangeForNumericType<off_t>(aligned_start)) {
+      DLOG(ERROR) << "Region bounds are not valid for mmap";
+      return false;
+    }
+
+    map_start = static_cast<off_t>(aligned_start);
+    map_size = aligned_size;
+    length_ = region.size;
+  }
+
+  int prot = PROT_READ;
+  int flags = MAP_SHARED;
+  switch (access) {
+    case READ_ONLY:
+      break;
+
+    case READ_WRITE:
+      prot |= PROT_WRITE;
+      break;
+
+    case READ_WRITE_COPY:
+      prot |= PROT_WRITE;
+      flags = MAP_PRIVATE;
+      break;
+
+    case READ_WRITE_EXTEND: {
+      prot |= PROT_WRITE;
+
+      const int64_t new_file_len = region.offset + region.size;
+
+      // POSIX won't auto-extend the file when it is written so it must first
+      // be explicitly extended to the maximum size. Zeros will fill the new
+      // space. It is assumed that the existing file is fully realized as
+      // otherwise the entire file would have to be read and possibly written.
+      const int64_t original_file_len = file_.GetLength();
+      if (original_file_len < 0) {
+        DPLOG(ERROR) << "fstat " << file_.GetPlatformFile();
+        return false;
+      }
+
+      // Increase the actual length of the file, if necessary. This can fail if
+      // the disk is full and the OS doesn't support sparse files.
+      if (new_file_len > original_file_len &&
+          !file_.SetLength(new_file_len)) {
+        DPLOG(ERROR) << "ftruncate " << file_.GetPlatformFile();
+        return false;
+      }
+      break;
+    }
+  }
+
+  void* mapped = mmap(nullptr, map_size, prot, flags,
+                      file_.GetPlatformFile(), map_start);
+  if (mapped == MAP_FAILED) {
+    DPLOG(ERROR) << "mmap " << file_.GetPlatformFile();
+    return false;
+  }
+
+  data_ = static_cast<uint8_t*>(mapped) + data_offset;
+  data_offset_ = data_offset;
+  return true;
+}
+
+void MemoryMappedFile::CloseHandles() {
+  if (data_ != nullptr) {
+    munmap(data_ - data_offset_, length_ + static_cast<size_t>(data_offset_));
+  }
+  file_.Close();
+
+  data_ = nullptr;
+  length_ = 0;
+  data_offset_ = 0;
+}
+
+}  // namespace tachyon::base
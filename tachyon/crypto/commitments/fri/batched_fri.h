@@ -0,0 +1,273 @@
+#ifndef TACHYON_CRYPTO_COMMITMENTS_FRI_BATCHED_FRI_H_
+#define TACHYON_CRYPTO_COMMITMENTS_FRI_BATCHED_FRI_H_
+
+#include <stddef.h>
+
+#include <utility>
+#include <vector>
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/crypto/commitments/fri/batched_fri_proof.h"
+#include "tachyon/crypto/commitments/fri/fri.h"
+#include "tachyon/crypto/commitments/merkle_tree/matrix_merkle_tree/matrix_merkle_tree.h"
+#include "tachyon/crypto/transcripts/transcript.h"
+#include "tachyon/math/matrix/matrix_types.h"
+
+namespace tachyon::crypto {
+
+// Proves the evaluations of many polynomials at out-of-domain points with a
+// single FRI. The evaluations of the polynomials on the domain of |FRI| are
+// committed as the columns of a matrix with |MatrixMerkleTree|. After the
+// evaluations pᵢ(zₖ) at the points zₖ = z * sₖ are written, where z is
+// squeezed from the transcript and sₖ are the given shifts, the prover runs
+// FRI on the DEEP quotient
+//
+//   Q(X) = Σₖ Σᵢ α^(k * N + i) * (pᵢ(X) - pᵢ(zₖ)) / (X - zₖ)
+//
+// where N is the number of the polynomials and α is squeezed from the
+// transcript. Q(X) is a polynomial of a low degree only if every claimed
+// evaluation is correct. A query opens a row of the matrix and checks it
+// against the first layer of FRI, so all the polynomials share the queries.
+template <typename F, size_t MaxDegree>
+class BatchedFRI {
+ public:
+  using PCS = FRI<F, MaxDegree>;
+  using Poly = typename PCS::Poly;
+  using Domain = typename PCS::Domain;
+  using Matrix = math::RowMajorMatrix<F>;
+  using Tree = MatrixMerkleTree<F, F, MaxDegree + 1>;
+
+  BatchedFRI() = default;
+  // |domain| must be the domain of |fri|.
+  BatchedFRI(const Domain* domain, const PCS* fri,
+             MatrixMerkleHasher<F, F>* hasher, size_t cap_size = 1,
+             std::vector<F> shifts = {F::One()})
+      : domain_(domain),
+        fri_(fri),
+        tree_(hasher, cap_size),
+        shifts_(std::move(shifts)) {
+    CHECK_EQ(domain->size(), fri->N());
+    CHECK_GT(fri->GetNumLayers(), size_t{0});
+    CHECK(!shifts_.empty());
+  }
+  // NOTE: |tree_| points to |matrices_| once committed, so a copy
+  // or a move would leave the tree pointing into the source.
+  BatchedFRI(const BatchedFRI& other) = delete;
+  BatchedFRI& operator=(const BatchedFRI& other) = delete;
+  BatchedFRI(BatchedFRI&& other) = delete;
+  BatchedFRI& operator=(BatchedFRI&& other) = delete;
+
+  // Commits to |polys| and writes the cap of the tree to the proof. |polys|
+  // must outlive |Open()|, since they are evaluated there.
+  [[nodiscard]] bool Commit(const std::vector<Poly>& polys,
+                            TranscriptWriter<F>* writer) {
+    size_t degree_bound = domain_->size() >> fri_->config().log_blowup;
+    for (const Poly& poly : polys) {
+      if (poly.Degree() >= degree_bound) {
+        LOG(ERROR) << "Degree of the polynomial is too high: "
+                   << poly.Degree();
+        return false;
+      }
+    }
+    polys_ = &polys;
+
+    size_t n = domain_->size();
+    size_t num_polys = polys.size();
+    matrices_.resize(1);
+    Matrix& matrix = matrices_[0];
+    matrix = Matrix(n, num_polys);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < num_polys; ++i) {
+      std::vector<F> evals = std::move(domain_->FFT(polys[i]).evaluations());
+      evals.resize(n, F::Zero());
+      for (size_t j = 0; j < evals.size(); ++j) {
+        matrix(j, i) = evals[j];
+      }
+    }
+
+    std::vector<F> cap;
+    if (!tree_.Commit(matrices_, &cap)) return false;
+    for (const F& node : cap) {
+      if (!writer->WriteToProof(node)) return false;
+    }
+    return true;
+  }
+
+  // Writes the evaluations of the committed polynomials at the points and
+  // commits to the DEEP quotient with FRI. |evaluations[k][i]| is pᵢ(zₖ).
+  [[nodiscard]] bool Open(TranscriptWriter<F>* writer,
+                          std::vector<std::vector<F>>* evaluations) const {
+    CHECK(polys_) << "Nothing is committed";
+    std::vector<F> points = GetPoints(writer->SqueezeChallenge());
+    const std::vector<Poly>& polys = *polys_;
+    evaluations->resize(points.size());
+    for (size_t k = 0; k < points.size(); ++k) {
+      std::vector<F>& values = (*evaluations)[k];
+      values.resize(polys.size());
+      OPENMP_PARALLEL_FOR(size_t i = 0; i < polys.size(); ++i) {
+        values[i] = polys[i].Evaluate(points[k]);
+      }
+      for (const F& value : values) {
+        if (!writer->WriteToProof(value)) return false;
+      }
+    }
+    F alpha = writer->SqueezeChallenge();
+
+    std::vector<F> quotient;
+    if (!ComputeQuotient(points, *evaluations, alpha, &quotient)) return false;
+    return fri_->CommitEvaluations(std::move(quotient), writer);
+  }
+
+  [[nodiscard]] bool CreateOpeningProof(const std::vector<size_t>& indices,
+                                        BatchedFRIProof<F>* proof) const {
+    proof->matrix_proofs.resize(indices.size());
+    for (size_t j = 0; j < indices.size(); ++j) {
+      if (!tree_.CreateOpeningProof(indices[j], &proof->matrix_proofs[j]))
+        return false;
+    }
+    return fri_->CreateOpeningProof(indices, &proof->fri_proof);
+  }
+
+  // Verifies the evaluations of |num_polys| polynomials at the queried
+  // |indices| and populates |evaluations| with the verified evaluations at
+  // the points in the same way as |Open()|.
+  [[nodiscard]] bool VerifyOpeningProof(
+      TranscriptReader<F>* reader, size_t num_polys,
+      const std::vector<size_t>& indices, const BatchedFRIProof<F>& proof,
+      std::vector<std::vector<F>>* evaluations) const {
+    if (proof.matrix_proofs.size() != indices.size()) {
+      LOG(ERROR) << "The number of the matrix proofs doesn't match";
+      return false;
+    }
+    std::vector<F> cap(tree_.cap_size());
+    for (F& node : cap) {
+      if (!reader->ReadFromProof(&node)) return false;
+    }
+    std::vector<F> points = GetPoints(reader->SqueezeChallenge());
+    evaluations->resize(points.size());
+    for (std::vector<F>& values : *evaluations) {
+      values.resize(num_polys);
+      for (F& value : values) {
+        if (!reader->ReadFromProof(&value)) return false;
+      }
+    }
+    F alpha = reader->SqueezeChallenge();
+    if (!fri_->VerifyOpeningProof(*reader, indices, proof.fri_proof))
+      return false;
+
+    // Σᵢ α^(k * N + i) * pᵢ(zₖ) for each zₖ
+    std::vector<F> combined_evaluations =
+        CombineEvaluations(*evaluations, alpha);
+    F alpha_pow_num_polys = alpha.Pow(num_polys);
+    size_t n = domain_->size();
+    MatrixMerkleQuery query;
+    query.heights = {n};
+    query.widths = {num_polys};
+    for (size_t j = 0; j < indices.size(); ++j) {
+      query.index = indices[j] % n;
+      const MatrixMerkleProof<F, F>& matrix_proof = proof.matrix_proofs[j];
+      if (!tree_.VerifyOpeningProof(cap, query, matrix_proof)) return false;
+
+      F x = domain_->GetElement(query.index);
+      F reduced_row = ReduceRow(matrix_proof.rows[0], alpha);
+      F quotient = F::Zero();
+      F alpha_pow = F::One();
+      for (size_t k = 0; k < points.size(); ++k) {
+        F denominator = x - points[k];
+        if (denominator.IsZero()) {
+          LOG(ERROR) << "The point is in the domain";
+          return false;
+        }
+        quotient += alpha_pow * (reduced_row - combined_evaluations[k]) *
+                    denominator.Inverse();
+        alpha_pow *= alpha_pow_num_polys;
+      }
+      if (quotient !=
+          fri_->GetInitialEvaluation(proof.fri_proof, j, query.index)) {
+        LOG(ERROR) << "Quotient doesn't match with FRI at query [" << j
+                   << "]";
+        return false;
+      }
+    }
+    return true;
+  }
+
+ private:
+  std::vector<F> GetPoints(const F& z) const {
+    return base::Map(shifts_, [&z](const F& shift) { return z * shift; });
+  }
+
+  // Returns Σᵢ αⁱ * |row[i]|.
+  static F ReduceRow(const std::vector<F>& row, const F& alpha) {
+    F ret = F::Zero();
+    for (auto it = row.rbegin(); it != row.rend(); ++it) {
+      ret *= alpha;
+      ret += *it;
+    }
+    return ret;
+  }
+
+  static std::vector<F> CombineEvaluations(
+      const std::vector<std::vector<F>>& evaluations, const F& alpha) {
+    return base::Map(evaluations, [&alpha](const std::vector<F>& values) {
+      return ReduceRow(values, alpha);
+    });
+  }
+
+  // Computes Q(x) for every x in |domain_|. Since the numerators share the
+  // powers of α, each row is reduced once and
+  //
+  //   Q(x) = Σₖ α^(k * N) * (Σᵢ αⁱ * pᵢ(x) - Σᵢ αⁱ * pᵢ(zₖ)) / (x - zₖ)
+  bool ComputeQuotient(const std::vector<F>& points,
+                       const std::vector<std::vector<F>>& evaluations,
+                       const F& alpha, std::vector<F>* quotient) const {
+    const Matrix& matrix = matrices_[0];
+    size_t n = domain_->size();
+    size_t num_polys = static_cast<size_t>(matrix.cols());
+    std::vector<F> reduced_rows(n);
+    OPENMP_PARALLEL_FOR(size_t j = 0; j < n; ++j) {
+      F value = F::Zero();
+      for (size_t i = num_polys; i > 0; --i) {
+        value *= alpha;
+        value += matrix(j, i - 1);
+      }
+      reduced_rows[j] = value;
+    }
+
+    std::vector<F> combined_evaluations =
+        CombineEvaluations(evaluations, alpha);
+    std::vector<F> xs = domain_->GetElements();
+    F alpha_pow_num_polys = alpha.Pow(num_polys);
+    F alpha_pow = F::One();
+    quotient->assign(n, F::Zero());
+    std::vector<F> denominators(n);
+    for (size_t k = 0; k < points.size(); ++k) {
+      OPENMP_PARALLEL_FOR(size_t j = 0; j < n; ++j) {
+        denominators[j] = xs[j] - points[k];
+      }
+      if (!F::BatchInverseInPlace(denominators)) return false;
+      const F& combined_evaluation = combined_evaluations[k];
+      OPENMP_PARALLEL_FOR(size_t j = 0; j < n; ++j) {
+        (*quotient)[j] += alpha_pow * (reduced_rows[j] - combined_evaluation) *
+                          denominators[j];
+      }
+      alpha_pow *= alpha_pow_num_polys;
+    }
+    return true;
+  }
+
+  // not owned
+  const Domain* domain_ = nullptr;
+  // not owned
+  const PCS* fri_ = nullptr;
+  Tree tree_;
+  std::vector<F> shifts_;
+  // not owned
+  const std::vector<Poly>* polys_ = nullptr;
+  std::vector<Matrix> matrices_;
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_COMMITMENTS_FRI_BATCHED_FRI_H_
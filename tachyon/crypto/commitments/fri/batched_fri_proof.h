@@ -0,0 +1,22 @@
+#ifndef TACHYON_CRYPTO_COMMITMENTS_FRI_BATCHED_FRI_PROOF_H_
+#define TACHYON_CRYPTO_COMMITMENTS_FRI_BATCHED_FRI_PROOF_H_
+
+#include <vector>
+
+#include "tachyon/crypto/commitments/fri/fri_proof.h"
+#include "tachyon/crypto/commitments/merkle_tree/matrix_merkle_tree/matrix_merkle_proof.h"
+
+namespace tachyon::crypto {
+
+template <typename F>
+struct BatchedFRIProof {
+  // |matrix_proofs[j]| opens the evaluations of all the polynomials at the
+  // j-th queried index.
+  std::vector<MatrixMerkleProof<F, F>> matrix_proofs;
+  // A proof of the low degree of the combined quotient.
+  FRIBatchProof<F> fri_proof;
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_COMMITMENTS_FRI_BATCHED_FRI_PROOF_H_
@@ -0,0 +1,145 @@
+#include "tachyon/crypto/commitments/fri/batched_fri.h"
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/simple_binary_merkle_tree_storage.h"
+#include "tachyon/crypto/transcripts/simple_transcript.h"
+#include "tachyon/math/finite_fields/goldilocks_prime/goldilocks.h"
+#include "tachyon/math/polynomials/univariate/univariate_evaluation_domain_factory.h"
+#include "tachyon/math/polynomials/univariate/univariate_polynomial.h"
+
+namespace tachyon::crypto {
+
+namespace {
+
+using F = math::Goldilocks;
+
+class SimpleHasher : public BinaryMerkleHasher<F, F> {
+ public:
+  // BinaryMerkleHasher<F, F> methods
+  F ComputeLeafHash(const F& leaf) const override { return leaf; }
+  F ComputeParentHash(const F& left, const F& right) const override {
+    return left + right.Double();
+  }
+};
+
+class SimpleMatrixHasher : public MatrixMerkleHasher<F, F> {
+ public:
+  // MatrixMerkleHasher<F, F> methods
+  F ComputeRowHash(absl::Span<const F> row) const override {
+    F ret = F(row.size());
+    for (const F& value : row) {
+      ret = ret.Double() + value;
+    }
+    return ret;
+  }
+  F ComputeParentHash(const F& left, const F& right) const override {
+    return left + right.Double();
+  }
+};
+
+class SimpleFRIStorage : public FRIStorage<F> {
+ public:
+  // FRIStorage<F> methods
+  void Allocate(size_t size) override { layers_.resize(size); }
+  BinaryMerkleTreeStorage<F>* GetLayer(size_t index) override {
+    return &layers_[index];
+  }
+
+ private:
+  std::vector<SimpleBinaryMerkleTreeStorage<F>> layers_;
+};
+
+class BatchedFRITest : public testing::Test {
+ public:
+  constexpr static size_t K = 5;
+  constexpr static size_t N = size_t{1} << K;
+  constexpr static size_t kMaxDegree = N - 1;
+  constexpr static size_t kNumPolys = 3;
+
+  using PCS = FRI<F, kMaxDegree>;
+  using Poly = PCS::Poly;
+  using Domain = PCS::Domain;
+
+  static void SetUpTestSuite() { F::Init(); }
+
+  void SetUp() override {
+    domain_ = Domain::Create(N);
+    FRIConfig config;
+    config.log_blowup = 1;
+    config.log_folding_arity = 2;
+    pcs_ = PCS(domain_.get(), &storage_, &hasher_, config);
+    // Opens at z and z * ω as an AIR does for the transitions.
+    batched_fri_ = std::make_unique<BatchedFRI<F, kMaxDegree>>(
+        domain_.get(), &pcs_, &matrix_hasher_, /*cap_size=*/2,
+        std::vector<F>{F::One(), domain_->group_gen()});
+  }
+
+ protected:
+  std::unique_ptr<Domain> domain_;
+  SimpleFRIStorage storage_;
+  SimpleHasher hasher_;
+  SimpleMatrixHasher matrix_hasher_;
+  PCS pcs_;
+  std::unique_ptr<BatchedFRI<F, kMaxDegree>> batched_fri_;
+};
+
+}  // namespace
+
+TEST_F(BatchedFRITest, CommitAndVerify) {
+  size_t degree_bound = N >> pcs_.config().log_blowup;
+  std::vector<Poly> polys = base::CreateVector(
+      kNumPolys, [degree_bound]() { return Poly::Random(degree_bound - 1); });
+  base::Uint8VectorBuffer write_buffer;
+  SimpleTranscriptWriter<F> writer(std::move(write_buffer));
+  ASSERT_TRUE(batched_fri_->Commit(polys, &writer));
+  std::vector<std::vector<F>> evaluations;
+  ASSERT_TRUE(batched_fri_->Open(&writer, &evaluations));
+  ASSERT_EQ(evaluations.size(), size_t{2});
+
+  std::vector<size_t> indices = base::CreateVector(
+      8, []() { return base::Uniform(base::Range<size_t>::Until(N)); });
+  BatchedFRIProof<F> proof;
+  ASSERT_TRUE(batched_fri_->CreateOpeningProof(indices, &proof));
+
+  std::vector<uint8_t> proof_bytes = writer.buffer().owned_buffer();
+  auto verify = [this, &proof_bytes, &indices](
+                    size_t num_polys, const BatchedFRIProof<F>& proof,
+                    std::vector<std::vector<F>>* evaluations) {
+    SimpleTranscriptReader<F> reader(
+        base::Buffer(proof_bytes.data(), proof_bytes.size()));
+    return batched_fri_->VerifyOpeningProof(&reader, num_polys, indices, proof,
+                                           evaluations);
+  };
+  std::vector<std::vector<F>> verified_evaluations;
+  ASSERT_TRUE(verify(kNumPolys, proof, &verified_evaluations));
+  EXPECT_EQ(verified_evaluations, evaluations);
+
+  // The evaluations are at z and z * ω, where z is squeezed after the cap.
+  SimpleTranscriptReader<F> reader(
+      base::Buffer(proof_bytes.data(), proof_bytes.size()));
+  F node;
+  ASSERT_TRUE(reader.ReadFromProof(&node));
+  ASSERT_TRUE(reader.ReadFromProof(&node));
+  F z = reader.SqueezeChallenge();
+  for (size_t i = 0; i < kNumPolys; ++i) {
+    EXPECT_EQ(evaluations[0][i], polys[i].Evaluate(z));
+    EXPECT_EQ(evaluations[1][i], polys[i].Evaluate(z * domain_->group_gen()));
+  }
+
+  BatchedFRIProof<F> invalid_proof = proof;
+  invalid_proof.matrix_proofs[0].rows[0][0] += F::One();
+  EXPECT_FALSE(verify(kNumPolys, invalid_proof, &verified_evaluations));
+
+  invalid_proof = proof;
+  invalid_proof.fri_proof.evaluations[0][0][0] += F::One();
+  EXPECT_FALSE(verify(kNumPolys, invalid_proof, &verified_evaluations));
+
+  EXPECT_FALSE(verify(kNumPolys - 1, proof, &verified_evaluations));
+}
+
+}  // namespace tachyon::crypto
@@ -4,20 +4,45 @@
 #ifndef TACHYON_CRYPTO_COMMITMENTS_FRI_FRI_H_
 #define TACHYON_CRYPTO_COMMITMENTS_FRI_FRI_H_
 
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
 #include <memory>
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/crypto/commitments/fri/fri_config.h"
 #include "tachyon/crypto/commitments/fri/fri_proof.h"
 #include "tachyon/crypto/commitments/fri/fri_storage.h"
 #include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/binary_merkle_tree.h"
 #include "tachyon/crypto/commitments/univariate_polynomial_commitment_scheme.h"
+#include "tachyon/crypto/transcripts/proof_of_work.h"
+#include "tachyon/crypto/transcripts/proof_of_work_hasher.h"
 #include "tachyon/crypto/transcripts/transcript.h"
 
 namespace tachyon::crypto {
 
+// Commits to a polynomial by its evaluations on |domain| and folds them layer
+// by layer in evaluation form. A layer of a domain of size n with folding
+// arity m is committed so that the m evaluations Pᵢ(x·ωʲ), where ω is the
+// primitive m-th root of unity, are adjacent leaves:
+//
+// clang-format off
+// leaf index: c·m + t  <->  Pᵢ(g^(c + t·n/m)),  0 ≤ c < n/m, 0 ≤ t < m
+// clang-format on
+//
+// where g is the generator of the domain. So a query opens a contiguous run
+// of m leaves per layer, which are folded into the evaluation of Pᵢ₊₁ at
+// g^(m·c).
+//
+// NOTE: |MaxDegree| bounds the size of the domain. The degree of a
+// committed polynomial must be less than |N()| / 2^|log_blowup|.
 template <typename F, size_t MaxDegree>
 class FRI final
     : public UnivariatePolynomialCommitmentScheme<FRI<F, MaxDegree>> {
@@ -29,83 +54,156 @@ class FRI final
 
   FRI() = default;
   FRI(const Domain* domain, FRIStorage<F>* storage,
-      BinaryMerkleHasher<F, F>* hasher)
-      : domain_(domain), storage_(storage), hasher_(hasher) {
+      BinaryMerkleHasher<F, F>* hasher, const FRIConfig& config = FRIConfig(),
+      const ProofOfWorkHasher<F>* proof_of_work_hasher = nullptr)
+      : domain_(domain),
+        storage_(storage),
+        hasher_(hasher),
+        config_(config),
+        proof_of_work_hasher_(proof_of_work_hasher) {
     // This ensures last folding process.
     CHECK_GE(domain->size(), size_t{2}) << "Domain size must be at least 2";
-    size_t k = domain->log_size_of_group();
-    if (k > 1) {
-      sub_domains_ = base::CreateVector(k - 1, [k](size_t i) {
-        return Domain::Create(size_t{1} << (k - i - 1));
-      });
+    CHECK(config.proof_of_work_bits == 0 || proof_of_work_hasher)
+        << "Proof of work needs a hasher";
+    CHECK(domain->offset().IsOne()) << "Domain must be a subgroup";
+    CHECK_GE(config.log_folding_arity, uint32_t{1});
+    CHECK_LE(config.log_folding_arity, uint32_t{4});
+    uint32_t k = domain->log_size_of_group();
+    CHECK_LE(config.log_blowup + config.log_final_poly_len, k);
+
+    // The last layer may fold less so as not to fold below the final
+    // polynomial.
+    uint32_t log_degree_bound = k - config.log_blowup;
+    while (log_degree_bound > config.log_final_poly_len) {
+      uint32_t log_arity =
+          std::min(config.log_folding_arity,
+                   log_degree_bound - config.log_final_poly_len);
+      log_arities_.push_back(log_arity);
+      log_degree_bound -= log_arity;
     }
-    storage_->Allocate(k);
+    final_domain_ = Domain::Create(domain->size() >> GetTotalLogArity());
+    // The inverse twiddles of a domain of size n / 2ˢ are the ones of |domain|
+    // at the multiples of 2ˢ.
+    half_inv_twiddles_ = F::GetSuccessivePowers(
+        domain->size() >> 1, domain->group_gen_inv(), F(2).Inverse());
+    storage_->Allocate(log_arities_.size());
+    layer_evaluations_.resize(log_arities_.size());
   }
 
+  const FRIConfig& config() const { return config_; }
+
+  // Returns the number of the committed layers.
+  size_t GetNumLayers() const { return log_arities_.size(); }
+
   // UnivariatePolynomialCommitmentScheme methods
   size_t N() const { return domain_->size(); }
 
   [[nodiscard]] bool Commit(const Poly& poly, Transcript<F>* transcript) const {
-    size_t num_layers = domain_->log_size_of_group();
+    size_t degree_bound = domain_->size() >> config_.log_blowup;
+    if (poly.Degree() >= degree_bound) {
+      LOG(ERROR) << "Degree of the polynomial is too high: " << poly.Degree();
+      return false;
+    }
+    return CommitEvaluations(std::move(domain_->FFT(poly).evaluations()),
+                             transcript);
+  }
+
+  // Commits to the evaluations of a polynomial on |domain_|. The degree is
+  // only checked by the final polynomial.
+  [[nodiscard]] bool CommitEvaluations(std::vector<F>&& evals,
+                                       Transcript<F>* transcript) const {
     TranscriptWriter<F>* writer = transcript->ToWriter();
-    BinaryMerkleTree<F, F, MaxDegree + 1> tree(storage_->GetLayer(0), hasher_);
-    Evals evals = domain_->FFT(poly);
-    F root;
-    if (!tree.Commit(evals.evaluations(), &root)) return false;
-    if (!writer->WriteToProof(root)) return false;
-    const Poly* cur_poly = &poly;
+    evals.resize(domain_->size(), F::Zero());
 
+    F root;
     F beta;
-    Poly folded_poly;
-    if (num_layers > 1) {
-      for (size_t i = 1; i < num_layers; ++i) {
-        // Pᵢ(X)   = Pᵢ_even(X²) + X * Pᵢ_odd(X²)
-        // Pᵢ₊₁(X) = Pᵢ_even(X²) + β * Pᵢ_odd(X²)
-        beta = writer->SqueezeChallenge();
-        folded_poly = cur_poly->template Fold<false>(beta);
-        BinaryMerkleTree<F, F, MaxDegree + 1> tree(storage_->GetLayer(i),
-                                                   hasher_);
-        evals = sub_domains_[i - 1]->FFT(folded_poly);
-        if (!tree.Commit(evals.evaluations(), &root)) return false;
-        if (!writer->WriteToProof(root)) return false;
-        cur_poly = &folded_poly;
+    uint32_t log_size_diff = 0;
+    for (size_t i = 0; i < log_arities_.size(); ++i) {
+      size_t arity = size_t{1} << log_arities_[i];
+      layer_evaluations_[i] = PermuteToCosets(evals, arity);
+      BinaryMerkleTree<F, F, MaxDegree + 1> tree(storage_->GetLayer(i),
+                                                 hasher_);
+      if (!tree.Commit(layer_evaluations_[i], &root)) return false;
+      if (!writer->WriteToProof(root)) return false;
+
+      // Pᵢ₊₁(X) = Σ βᵗ * Pᵢ,ₜ(X), where Pᵢ(X) = Σ Xᵗ * Pᵢ,ₜ(Xᵐ).
+      // This is done by folding in half with β, β², ..., β^(m / 2).
+      beta = writer->SqueezeChallenge();
+      for (uint32_t r = 0; r < log_arities_[i]; ++r) {
+        evals = FoldEvaluations(evals, beta, log_size_diff++);
+        beta.SquareInPlace();
       }
     }
 
-    beta = writer->SqueezeChallenge();
-    folded_poly = cur_poly->template Fold<false>(beta);
-    const F* constant = folded_poly[0];
-    root = constant ? *constant : F::Zero();
-    return writer->WriteToProof(root);
+    Poly final_poly = final_domain_->IFFT(Evals(std::move(evals)));
+    size_t final_poly_len = size_t{1} << config_.log_final_poly_len;
+    if (!final_poly.IsZero() && final_poly.Degree() >= final_poly_len) {
+      LOG(ERROR) << "Degree of the final polynomial is too high: "
+                 << final_poly.Degree();
+      return false;
+    }
+    for (size_t i = 0; i < final_poly_len; ++i) {
+      const F* coefficient = final_poly[i];
+      if (!writer->WriteToProof(coefficient ? *coefficient : F::Zero()))
+        return false;
+    }
+    if (config_.proof_of_work_bits == 0) return true;
+    return ProofOfWork<F>::Grind(writer, *proof_of_work_hasher_,
+                                 config_.proof_of_work_bits);
+  }
+
+  // Returns the evaluation at |index| of the polynomial committed by
+  // |CommitEvaluations()| from the |query|-th coset of |proof|. |proof| must
+  // have been verified.
+  const F& GetInitialEvaluation(const FRIBatchProof<F>& proof, size_t query,
+                                size_t index) const {
+    size_t num_cosets = domain_->size() >> log_arities_[0];
+    return proof.evaluations[0][query][(index % domain_->size()) / num_cosets];
   }
 
   [[nodiscard]] bool DoCreateOpeningProof(size_t index,
                                           FRIProof<F>* fri_proof) const {
+    FRIBatchProof<F> batch_proof;
+    if (!DoCreateOpeningProof(std::vector<size_t>{index}, &batch_proof))
+      return false;
+    fri_proof->paths = std::move(batch_proof.paths);
+    fri_proof->evaluations.resize(batch_proof.evaluations.size());
+    for (size_t i = 0; i < batch_proof.evaluations.size(); ++i) {
+      fri_proof->evaluations[i] = std::move(batch_proof.evaluations[i][0]);
+    }
+    return true;
+  }
+
+  // Creates a proof for all the |indices| at once. The merkle paths of the
+  // queries share the siblings near the root, so the proof only contains a
+  // single multi-proof per layer.
+  [[nodiscard]] bool DoCreateOpeningProof(const std::vector<size_t>& indices,
+                                          FRIBatchProof<F>* fri_proof) const {
     size_t domain_size = domain_->size();
-    size_t num_layers = domain_->log_size_of_group();
+    size_t num_layers = log_arities_.size();
+    fri_proof->paths.resize(num_layers);
+    fri_proof->evaluations.resize(num_layers);
+    std::vector<size_t> leaf_indices;
     for (size_t i = 0; i < num_layers; ++i) {
-      size_t leaf_index = index % domain_size;
-      BinaryMerkleTreeStorage<F>* layer = storage_->GetLayer(i);
-      BinaryMerkleTree<F, F, MaxDegree + 1> tree(layer, hasher_);
-      BinaryMerkleProof<F> proof;
-      if (!tree.CreateOpeningProof(leaf_index, &proof)) return false;
-      // Merkle proof for Pᵢ(ωʲ) against Cᵢ
-      fri_proof->paths.push_back(std::move(proof));
-      // Pᵢ(ωʲ)
-      fri_proof->evaluations.push_back(
-          layer->GetHash(domain_size - 1 + leaf_index));
-
-      size_t half_domain_size = domain_size >> 1;
-      size_t leaf_index_sym = (index + half_domain_size) % domain_size;
-      BinaryMerkleProof<F> proof_sym;
-      if (!tree.CreateOpeningProof(leaf_index_sym, &proof_sym)) return false;
-      // Merkle proof for Pᵢ(-ωʲ) against Cᵢ
-      fri_proof->paths_sym.push_back(std::move(proof_sym));
-      // Pᵢ(-ωʲ)
-      fri_proof->evaluations_sym.push_back(
-          layer->GetHash(domain_size - 1 + leaf_index_sym));
-
-      domain_size = half_domain_size;
+      size_t arity = size_t{1} << log_arities_[i];
+      size_t num_cosets = domain_size >> log_arities_[i];
+      const std::vector<F>& leaves = layer_evaluations_[i];
+      leaf_indices.clear();
+      // Pᵢ on the coset of each query
+      fri_proof->evaluations[i] = base::Map(indices, [&](size_t index) {
+        size_t coset = index % num_cosets;
+        for (size_t t = 0; t < arity; ++t) {
+          leaf_indices.push_back(coset * arity + t);
+        }
+        return std::vector<F>(leaves.begin() + coset * arity,
+                              leaves.begin() + (coset + 1) * arity);
+      });
+      // Merkle proof for all of them against Cᵢ
+      BinaryMerkleTree<F, F, MaxDegree + 1> tree(storage_->GetLayer(i),
+                                                 hasher_);
+      if (!tree.CreateOpeningProof(leaf_indices, &fri_proof->paths[i]))
+        return false;
+      domain_size = num_cosets;
     }
     return true;
   }
@@ -113,96 +211,204 @@ class FRI final
   [[nodiscard]] bool DoVerifyOpeningProof(Transcript<F>& transcript,
                                           size_t index,
                                           const FRIProof<F>& proof) const {
+    FRIBatchProof<F> batch_proof;
+    batch_proof.paths = proof.paths;
+    batch_proof.evaluations = base::Map(
+        proof.evaluations, [](const std::vector<F>& evaluations) {
+          return std::vector<std::vector<F>>{evaluations};
+        });
+    return DoVerifyOpeningProof(transcript, std::vector<size_t>{index},
+                                batch_proof);
+  }
+
+  // Verifies the proof for all the |indices| at once.
+  [[nodiscard]] bool DoVerifyOpeningProof(Transcript<F>& transcript,
+                                          const std::vector<size_t>& indices,
+                                          const FRIBatchProof<F>& proof) const {
     TranscriptReader<F>* reader = transcript.ToReader();
     size_t domain_size = domain_->size();
-    size_t num_layers = domain_->log_size_of_group();
+    size_t num_layers = log_arities_.size();
+    if (proof.paths.size() != num_layers ||
+        proof.evaluations.size() != num_layers) {
+      LOG(ERROR) << "The number of layers doesn't match";
+      return false;
+    }
+    size_t num_queries = indices.size();
     F root;
-    F x;
     F beta;
-    F evaluation;
-    F evaluation_sym;
-    F two_inv = F(2).Inverse();
+    uint32_t log_size_diff = 0;
+    // The evaluations of the folded polynomial at the queries
+    std::vector<F> evaluations(num_queries);
+    BinaryMerkleMultiOpening<F> opening;
+    std::vector<F> leaves;
     for (size_t i = 0; i < num_layers; ++i) {
-      BinaryMerkleTreeStorage<F>* layer = storage_->GetLayer(i);
-      BinaryMerkleTree<F, F, MaxDegree + 1> tree(layer, hasher_);
-
-      if (!reader->ReadFromProof(&root)) return false;
-      if (!tree.VerifyOpeningProof(root, proof.evaluations[i], proof.paths[i]))
-        return false;
-
-      if (!tree.VerifyOpeningProof(root, proof.evaluations_sym[i],
-                                   proof.paths_sym[i]))
+      size_t arity = size_t{1} << log_arities_[i];
+      size_t num_cosets = domain_size >> log_arities_[i];
+      const std::vector<std::vector<F>>& cosets = proof.evaluations[i];
+      if (cosets.size() != num_queries) {
+        LOG(ERROR) << "The number of evaluations doesn't match at layer [" << i
+                   << "]";
         return false;
+      }
 
-      // Given equations:
-      // Pᵢ(X)  = Pᵢ_even(X²) + X * Pᵢ_odd(X²)
-      // Pᵢ(-X) = Pᵢ_even(X²) - X * Pᵢ_odd(X²)
-      //
-      // Using Gaussian elimination, we derive:
-      // Pᵢ_even(X²) = (Pᵢ(X) + Pᵢ(-X)) / 2
-      // Pᵢ_odd(X²)  = (Pᵢ(X) - Pᵢ(-X)) / (2 * X)
-      //
-      // Next layer equation:
-      // Pᵢ₊₁(X) = Pᵢ_even(X²) + β * Pᵢ_odd(X²)
-      //
-      // If the domain of Pᵢ(X) is Dᵢ = {ω⁰, ω¹, ..., ωⁿ⁻¹},
-      // then the domain of Pᵢ₊₁(X) is Dᵢ₊₁ = {ω⁰, ω¹, ..., ωᵏ⁻¹},
-      // where k = n / 2.
-      //
-      // As per the definition:
-      // Pᵢ₊₁(ωʲ) = Pᵢ_even((ωʲ)²) + β * Pᵢ_odd((ωʲ)²)
-      //
-      // Substituting Pᵢ_even and Pᵢ_odd:
-      // Pᵢ₊₁(ωʲ) = (Pᵢ(ωʲ) + Pᵢ(-ωʲ)) / 2 + β * (Pᵢ(ωʲ) - Pᵢ(-ωʲ)) / (2 * ωʲ)
-      //           = ((1 + β * ω⁻ʲ) * Pᵢ(ωʲ) + (1 - β * ω⁻ʲ) * Pᵢ(-ωʲ)) / 2
-      size_t leaf_index = index % domain_size;
-      if (i == 0) {
-        evaluation = proof.evaluations[i];
-        evaluation_sym = proof.evaluations_sym[i];
-        x = domain_->GetElement(leaf_index);
-      } else {
-        evaluation *= (F::One() + beta);
-        evaluation_sym *= (F::One() - beta);
-        evaluation += evaluation_sym;
-        evaluation *= two_inv;
-
-        if (evaluation != proof.evaluations[i]) {
+      if (!reader->ReadFromProof(&root)) return false;
+      opening.leaves_size = domain_size;
+      opening.indices.clear();
+      leaves.clear();
+      for (size_t j = 0; j < num_queries; ++j) {
+        if (cosets[j].size() != arity) {
+          LOG(ERROR) << "The size of the coset doesn't match at layer [" << i
+                     << "]";
+          return false;
+        }
+        size_t position = indices[j] % domain_size;
+        size_t coset = position % num_cosets;
+        if (i > 0 && evaluations[j] != cosets[j][position / num_cosets]) {
           LOG(ERROR)
               << "Proof doesn't match with expected evaluation at layer [" << i
               << "]";
           return false;
         }
-        evaluation_sym = proof.evaluations_sym[i];
-        x = sub_domains_[i - 1]->GetElement(leaf_index);
+        for (size_t t = 0; t < arity; ++t) {
+          opening.indices.push_back(coset * arity + t);
+        }
+        leaves.insert(leaves.end(), cosets[j].begin(), cosets[j].end());
       }
+      opening.leaf_hashes.resize(leaves.size());
+      hasher_->ComputeLeafHashes(leaves, absl::MakeSpan(opening.leaf_hashes));
+      BinaryMerkleTree<F, F, MaxDegree + 1> tree(storage_->GetLayer(i),
+                                                 hasher_);
+      if (!tree.VerifyOpeningProof(root, opening, proof.paths[i])) return false;
+
       beta = reader->SqueezeChallenge();
-      beta *= x.Inverse();
-      domain_size = domain_size >> 1;
+      for (size_t j = 0; j < num_queries; ++j) {
+        evaluations[j] =
+            FoldCoset(cosets[j], indices[j] % num_cosets, num_cosets,
+                      log_arities_[i], beta, log_size_diff);
+      }
+      log_size_diff += log_arities_[i];
+      domain_size = num_cosets;
     }
 
-    evaluation *= (F::One() + beta);
-    evaluation_sym *= (F::One() - beta);
-    evaluation += evaluation_sym;
-    evaluation *= two_inv;
-
-    if (!reader->ReadFromProof(&root)) return false;
-    if (root != evaluation) {
-      LOG(ERROR) << "Root doesn't match with expected evaluation";
+    size_t final_poly_len = size_t{1} << config_.log_final_poly_len;
+    std::vector<F> final_poly(final_poly_len);
+    for (size_t i = 0; i < final_poly_len; ++i) {
+      if (!reader->ReadFromProof(&final_poly[i])) return false;
+    }
+    if (config_.proof_of_work_bits > 0 &&
+        !ProofOfWork<F>::Verify(reader, *proof_of_work_hasher_,
+                                config_.proof_of_work_bits))
       return false;
+    for (size_t j = 0; j < num_queries; ++j) {
+      F x = domain_->GetElement((indices[j] % domain_size) << log_size_diff);
+      F evaluation = F::Zero();
+      for (auto it = final_poly.rbegin(); it != final_poly.rend(); ++it) {
+        evaluation *= x;
+        evaluation += *it;
+      }
+      if (evaluation != evaluations[j]) {
+        LOG(ERROR) << "Final polynomial doesn't match with expected evaluation";
+        return false;
+      }
     }
     return true;
   }
 
  private:
+  uint32_t GetTotalLogArity() const {
+    uint32_t ret = 0;
+    for (uint32_t log_arity : log_arities_) {
+      ret += log_arity;
+    }
+    return ret;
+  }
+
+  // Reorders |evals| so that the evaluations at g^(c + t·n/m) for 0 ≤ t < m
+  // are adjacent, where n is the size of |evals| and m is |arity|.
+  static std::vector<F> PermuteToCosets(const std::vector<F>& evals,
+                                        size_t arity) {
+    size_t num_cosets = evals.size() / arity;
+    std::vector<F> ret(evals.size());
+    OPENMP_PARALLEL_FOR(size_t c = 0; c < num_cosets; ++c) {
+      for (size_t t = 0; t < arity; ++t) {
+        ret[c * arity + t] = evals[c + t * num_cosets];
+      }
+    }
+    return ret;
+  }
+
+  // Given equations:
+  // Pᵢ(X)  = Pᵢ_even(X²) + X * Pᵢ_odd(X²)
+  // Pᵢ(-X) = Pᵢ_even(X²) - X * Pᵢ_odd(X²)
+  //
+  // Using Gaussian elimination, we derive:
+  // Pᵢ_even(X²) = (Pᵢ(X) + Pᵢ(-X)) / 2
+  // Pᵢ_odd(X²)  = (Pᵢ(X) - Pᵢ(-X)) / (2 * X)
+  //
+  // Folding with β:
+  // Pᵢ₊₁(X²) = Pᵢ_even(X²) + β * Pᵢ_odd(X²)
+  //          = (Pᵢ(X) + Pᵢ(-X)) / 2 + β * (Pᵢ(X) - Pᵢ(-X)) / (2 * X)
+  //
+  // |half_inv_twiddle| is 1 / (2 * X).
+  static F Fold(const F& evaluation, const F& evaluation_sym, const F& beta,
+                const F& half_inv_twiddle, const F& two_inv) {
+    return (evaluation + evaluation_sym) * two_inv +
+           (evaluation - evaluation_sym) * half_inv_twiddle * beta;
+  }
+
+  // Folds the evaluations of Pᵢ on a domain of size n into the ones of Pᵢ₊₁
+  // on a domain of size n / 2, where g^(n / 2) = -1 for the generator g. The
+  // size of |domain_| is n * 2^|log_size_diff|.
+  std::vector<F> FoldEvaluations(const std::vector<F>& evals, const F& beta,
+                                 uint32_t log_size_diff) const {
+    size_t half = evals.size() >> 1;
+    F two_inv = half_inv_twiddles_[0];
+    std::vector<F> ret(half);
+    OPENMP_PARALLEL_FOR(size_t j = 0; j < half; ++j) {
+      ret[j] = Fold(evals[j], evals[j + half], beta,
+                    half_inv_twiddles_[j << log_size_diff], two_inv);
+    }
+    return ret;
+  }
+
+  // Folds the evaluations of Pᵢ at g^(|coset| + t·|num_cosets|) for
+  // 0 ≤ t < 2^|log_arity| into the evaluation of Pᵢ₊₁ at g^(2^|log_arity| *
+  // |coset|) in the same way as |FoldEvaluations()|.
+  F FoldCoset(const std::vector<F>& evaluations, size_t coset,
+              size_t num_cosets, uint32_t log_arity, F beta,
+              uint32_t log_size_diff) const {
+    std::vector<F> values = evaluations;
+    F two_inv = half_inv_twiddles_[0];
+    for (uint32_t r = 0; r < log_arity; ++r) {
+      size_t half = values.size() >> 1;
+      for (size_t t = 0; t < half; ++t) {
+        size_t position = coset + t * num_cosets;
+        values[t] =
+            Fold(values[t], values[t + half], beta,
+                 half_inv_twiddles_[position << (log_size_diff + r)], two_inv);
+      }
+      values.resize(half);
+      beta.SquareInPlace();
+    }
+    return values[0];
+  }
+
   // not owned
   const Domain* domain_ = nullptr;
   // not owned
   mutable FRIStorage<F>* storage_ = nullptr;
   // not owned
   BinaryMerkleHasher<F, F>* hasher_ = nullptr;
+  FRIConfig config_;
   // not owned
-  Transcript<F>* transcript_ = nullptr;
-  std::vector<std::unique_ptr<Domain>> sub_domains_;
+  const ProofOfWorkHasher<F>* proof_of_work_hasher_ = nullptr;
+  // The log₂ of the folding arity of each committed layer.
+  std::vector<uint32_t> log_arities_;
+  std::unique_ptr<Domain> final_domain_;
+  // 1 / (2 * gʲ) for 0 ≤ j < n / 2, where g is the generator of |domain_|.
+  std::vector<F> half_inv_twiddles_;
+  // The leaves of each committed layer.
+  mutable std::vector<std::vector<F>> layer_evaluations_;
 };
 
 template <typename F, size_t MaxDegree>
@@ -0,0 +1,25 @@
+#ifndef TACHYON_CRYPTO_COMMITMENTS_FRI_FRI_CONFIG_H_
+#define TACHYON_CRYPTO_COMMITMENTS_FRI_FRI_CONFIG_H_
+
+#include <stdint.h>
+
+namespace tachyon::crypto {
+
+struct FRIConfig {
+  // The polynomial is committed on a domain 2^|log_blowup| times larger than
+  // its degree bound. In other words, the rate is 2^-|log_blowup|.
+  uint32_t log_blowup = 0;
+  // Each layer folds 2^|log_folding_arity| evaluations into one, so that only
+  // every |log_folding_arity|-th layer is committed. It must be in [1, 4].
+  uint32_t log_folding_arity = 1;
+  // The folding stops when the degree bound of the folded polynomial becomes
+  // 2^|log_final_poly_len| and its coefficients are sent as they are.
+  uint32_t log_final_poly_len = 0;
+  // After the commit phase, the prover grinds a nonce with this many leading
+  // zero bits before the queries are squeezed. See |ProofOfWork|.
+  uint32_t proof_of_work_bits = 0;
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_COMMITMENTS_FRI_FRI_CONFIG_H_
@@ -12,10 +12,22 @@ namespace tachyon::crypto {
 
 template <typename F>
 struct FRIProof {
-  std::vector<BinaryMerkleProof<F>> paths;
-  std::vector<BinaryMerkleProof<F>> paths_sym;
-  std::vector<F> evaluations;
-  std::vector<F> evaluations_sym;
+  // |paths[i]| opens the evaluations of Pᵢ on the coset of the query against
+  // Cᵢ.
+  std::vector<BinaryMerkleMultiProof<F>> paths;
+  // |evaluations[i]| are the evaluations of Pᵢ on the coset of the query in
+  // the order of the leaves.
+  std::vector<std::vector<F>> evaluations;
+};
+
+// A proof for several queries at once. For each layer, a single multi-proof
+// opens the cosets of all the queries.
+template <typename F>
+struct FRIBatchProof {
+  std::vector<BinaryMerkleMultiProof<F>> paths;
+  // |evaluations[i][j]| are the evaluations of Pᵢ on the coset of the j-th
+  // query in the order of the leaves.
+  std::vector<std::vector<std::vector<F>>> evaluations;
 };
 
 }  // namespace tachyon::crypto
@@ -7,6 +7,7 @@
 
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/simple_binary_merkle_tree_storage.h"
+#include "tachyon/crypto/transcripts/sha256_proof_of_work_hasher.h"
 #include "tachyon/crypto/transcripts/simple_transcript.h"
 #include "tachyon/math/finite_fields/goldilocks_prime/goldilocks.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluation_domain_factory.h"
@@ -50,7 +51,7 @@ class SimpleFRIStorage : public FRIStorage<math::Goldilocks> {
 
 class FRITest : public testing::Test {
  public:
-  constexpr static size_t K = 3;
+  constexpr static size_t K = 4;
   constexpr static size_t N = size_t{1} << K;
   constexpr static size_t kMaxDegree = N - 1;
 
@@ -71,6 +72,7 @@ class FRITest : public testing::Test {
   std::unique_ptr<Domain> domain_;
   SimpleFRIStorage storage_;
   SimpleHasher hasher_;
+  Sha256ProofOfWorkHasher<math::Goldilocks> proof_of_work_hasher_;
   PCS pcs_;
 };
 
@@ -91,4 +93,157 @@ TEST_F(FRITest, CommitAndVerify) {
   ASSERT_TRUE(pcs_.VerifyOpeningProof(reader, index, proof));
 }
 
+TEST_F(FRITest, BatchCommitAndVerify) {
+  Poly poly = Poly::Random(kMaxDegree);
+  base::Uint8VectorBuffer write_buffer;
+  SimpleTranscriptWriter<F> writer(std::move(write_buffer));
+  ASSERT_TRUE(pcs_.Commit(poly, &writer));
+
+  std::vector<size_t> indices = base::CreateVector(5, []() {
+    return base::Uniform(base::Range<size_t>::Until(kMaxDegree + 1));
+  });
+  FRIBatchProof<math::Goldilocks> proof;
+  ASSERT_TRUE(pcs_.CreateOpeningProof(indices, &proof));
+
+  // Every query in the batch is the same as the one proved alone.
+  for (size_t j = 0; j < indices.size(); ++j) {
+    FRIProof<math::Goldilocks> single_proof;
+    ASSERT_TRUE(pcs_.CreateOpeningProof(indices[j], &single_proof));
+    for (size_t i = 0; i < pcs_.GetNumLayers(); ++i) {
+      EXPECT_EQ(proof.evaluations[i][j], single_proof.evaluations[i]);
+    }
+  }
+
+  std::vector<uint8_t> proof_bytes = writer.buffer().owned_buffer();
+  auto verify = [this, &proof_bytes,
+                 &indices](const FRIBatchProof<math::Goldilocks>& proof) {
+    SimpleTranscriptReader<F> reader(
+        base::Buffer(proof_bytes.data(), proof_bytes.size()));
+    return pcs_.VerifyOpeningProof(reader, indices, proof);
+  };
+  ASSERT_TRUE(verify(proof));
+
+  FRIBatchProof<math::Goldilocks> invalid_proof = proof;
+  invalid_proof.evaluations[1][0][0] += F::One();
+  EXPECT_FALSE(verify(invalid_proof));
+}
+
+TEST_F(FRITest, CommitAndVerifyWithConfig) {
+  struct {
+    FRIConfig config;
+    size_t num_layers;
+  } tests[] = {
+      // 8 -> 2 -> 1
+      {{/*log_blowup=*/1, /*log_folding_arity=*/2, /*log_final_poly_len=*/0},
+       2},
+      // 4 -> 2 with the final polynomial of 2 coefficients
+      {{/*log_blowup=*/2, /*log_folding_arity=*/1, /*log_final_poly_len=*/1},
+       1},
+      // 16 -> 1
+      {{/*log_blowup=*/0, /*log_folding_arity=*/4, /*log_final_poly_len=*/0},
+       1},
+      // 8 -> 4 -> 2 -> 1 with grinding
+      {{/*log_blowup=*/1, /*log_folding_arity=*/1, /*log_final_poly_len=*/0,
+        /*proof_of_work_bits=*/8},
+       3},
+  };
+
+  for (const auto& test : tests) {
+    SimpleFRIStorage storage;
+    PCS pcs(domain_.get(), &storage, &hasher_, test.config,
+            &proof_of_work_hasher_);
+    EXPECT_EQ(pcs.GetNumLayers(), test.num_layers);
+
+    size_t degree_bound = N >> test.config.log_blowup;
+    Poly poly = Poly::Random(degree_bound - 1);
+    base::Uint8VectorBuffer write_buffer;
+    SimpleTranscriptWriter<F> writer(std::move(write_buffer));
+    ASSERT_TRUE(pcs.Commit(poly, &writer));
+
+    std::vector<size_t> indices = base::CreateVector(
+        5, []() { return base::Uniform(base::Range<size_t>::Until(N)); });
+    FRIBatchProof<math::Goldilocks> proof;
+    ASSERT_TRUE(pcs.CreateOpeningProof(indices, &proof));
+
+    SimpleTranscriptReader<F> reader(std::move(writer).TakeBuffer());
+    reader.buffer().set_buffer_offset(0);
+    ASSERT_TRUE(pcs.VerifyOpeningProof(reader, indices, proof));
+
+    // The degree exceeds the degree bound.
+    if (test.config.log_blowup > 0) {
+      poly = Poly::Random(degree_bound);
+      base::Uint8VectorBuffer write_buffer;
+      SimpleTranscriptWriter<F> writer(std::move(write_buffer));
+      EXPECT_FALSE(pcs.Commit(poly, &writer));
+    }
+  }
+}
+
+TEST_F(FRITest, VerifyOverDegreeCodeword) {
+  // 16 -> 8 -> 4 -> 2 with the final polynomial of 2 coefficients, which
+  // accepts the polynomials of degree less than 16.
+  SimpleFRIStorage loose_storage;
+  PCS loose_pcs(domain_.get(), &loose_storage, &hasher_,
+                {/*log_blowup=*/0, /*log_folding_arity=*/1,
+                 /*log_final_poly_len=*/1});
+  // 16 -> 8 -> 4 -> 2 with the final polynomial of 1 coefficient, which
+  // accepts the polynomials of degree less than 8.
+  SimpleFRIStorage storage;
+  PCS pcs(domain_.get(), &storage, &hasher_,
+          {/*log_blowup=*/1, /*log_folding_arity=*/1,
+           /*log_final_poly_len=*/0});
+  ASSERT_EQ(loose_pcs.GetNumLayers(), pcs.GetNumLayers());
+
+  // A cheating prover commits to a codeword over the degree bound with the
+  // same layers.
+  Poly poly = Poly::Random(N / 2);
+  ASSERT_EQ(poly.Degree(), N / 2);
+  base::Uint8VectorBuffer write_buffer;
+  SimpleTranscriptWriter<F> writer(std::move(write_buffer));
+  ASSERT_TRUE(loose_pcs.CommitEvaluations(
+      std::move(domain_->FFT(poly).evaluations()), &writer));
+
+  std::vector<size_t> indices = base::CreateVector(
+      5, []() { return base::Uniform(base::Range<size_t>::Until(N)); });
+  FRIBatchProof<math::Goldilocks> proof;
+  ASSERT_TRUE(loose_pcs.CreateOpeningProof(indices, &proof));
+
+  std::vector<uint8_t> proof_bytes = writer.buffer().owned_buffer();
+  {
+    SimpleTranscriptReader<F> reader(
+        base::Buffer(proof_bytes.data(), proof_bytes.size()));
+    ASSERT_TRUE(loose_pcs.VerifyOpeningProof(reader, indices, proof));
+  }
+  {
+    SimpleTranscriptReader<F> reader(
+        base::Buffer(proof_bytes.data(), proof_bytes.size()));
+    EXPECT_FALSE(pcs.VerifyOpeningProof(reader, indices, proof));
+  }
+}
+
+TEST_F(FRITest, VerifyTamperedFinalPolynomial) {
+  SimpleFRIStorage storage;
+  PCS pcs(domain_.get(), &storage, &hasher_,
+          {/*log_blowup=*/1, /*log_folding_arity=*/1,
+           /*log_final_poly_len=*/1});
+
+  Poly poly = Poly::Random(N / 2 - 1);
+  base::Uint8VectorBuffer write_buffer;
+  SimpleTranscriptWriter<F> writer(std::move(write_buffer));
+  ASSERT_TRUE(pcs.Commit(poly, &writer));
+
+  std::vector<size_t> indices = base::CreateVector(
+      5, []() { return base::Uniform(base::Range<size_t>::Until(N)); });
+  FRIBatchProof<math::Goldilocks> proof;
+  ASSERT_TRUE(pcs.CreateOpeningProof(indices, &proof));
+
+  std::vector<uint8_t> proof_bytes = writer.buffer().owned_buffer();
+  // The final polynomial is written last, so this flips a bit of its
+  // highest coefficient.
+  proof_bytes[proof_bytes.size() - sizeof(F)] ^= 1;
+  SimpleTranscriptReader<F> reader(
+      base::Buffer(proof_bytes.data(), proof_bytes.size()));
+  EXPECT_FALSE(pcs.VerifyOpeningProof(reader, indices, proof));
+}
+
 }  // namespace tachyon::crypto
@@ -0,0 +1,707 @@
+// Copyright 2020-2022 The Electric Coin Company
+// Copyright 2022 The Halo2 developers
+// Use of this source code is governed by a MIT/Apache-2.0 style license that
+// can be found in the LICENSE-MIT.halo2 and the LICENCE-APACHE.halo2
+// file.
+
+#ifndef TACHYON_CRYPTO_COMMITMENTS_IPA_IPA_H_
+#define TACHYON_CRYPTO_COMMITMENTS_IPA_IPA_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/buffer/copyable.h"
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/crypto/commitments/polynomial_openings.h"
+#include "tachyon/crypto/commitments/univariate_polynomial_commitment_scheme.h"
+#include "tachyon/crypto/transcripts/transcript.h"
+#include "tachyon/math/elliptic_curves/msm/variable_base_msm.h"
+#include "tachyon/math/elliptic_curves/point_conversions.h"
+#include "tachyon/math/polynomials/univariate/lagrange_interpolation.h"
+#include "tachyon/math/polynomials/univariate/radix2_evaluation_domain.h"
+
+namespace tachyon {
+namespace crypto {
+
+// The polynomial commitment scheme based on the inner product argument of
+// BCMS20, which is described in the appendix A.2 of
+// https://eprint.iacr.org/2020/499.pdf. A polynomial is committed by a
+// Pedersen commitment to its coefficients over random generators G, so that
+// it needs no trusted setup. The cost is the opening proof, which has
+// 2log₂(n) points and needs a linear time verifier. The proof has the same
+// transcript layout as ProverIPA and VerifierIPA of halo2, but the bytes
+// differ since the generators are not derived by halo2's hash-to-curve.
+template <typename AffinePoint, size_t MaxDegree,
+          typename Commitment = typename math::Pippenger<AffinePoint>::Bucket>
+class IPA final : public UnivariatePolynomialCommitmentScheme<
+                      IPA<AffinePoint, MaxDegree, Commitment>> {
+ public:
+  using Base = UnivariatePolynomialCommitmentScheme<
+      IPA<AffinePoint, MaxDegree, Commitment>>;
+  using Field = typename Base::Field;
+  using Poly = typename Base::Poly;
+  using Point = typename Poly::Point;
+  using Bucket = typename math::Pippenger<AffinePoint>::Bucket;
+  using JacobianPoint = math::JacobianPoint<typename AffinePoint::Curve>;
+
+  // The number of the generators folded together, which are normalized at
+  // once.
+  constexpr static size_t kChunkSize = 1 << 12;
+
+  IPA() = default;
+  IPA(std::vector<AffinePoint>&& generators, const AffinePoint& u,
+      const AffinePoint& w)
+      : generators_(std::move(generators)), u_(u), w_(w) {
+    CHECK(base::bits::IsPowerOfTwo(generators_.size()));
+    CHECK_LE(generators_.size(), MaxDegree + 1);
+    CHECK(ComputeGeneratorsLagrange());
+  }
+
+  const std::vector<AffinePoint>& generators() const { return generators_; }
+  const std::vector<AffinePoint>& generators_lagrange() const {
+    return generators_lagrange_;
+  }
+  const AffinePoint& u() const { return u_; }
+  const AffinePoint& w() const { return w_; }
+
+  void ResizeBatchCommitments() {
+    batch_commitments_.resize(this->batch_commitment_state_.batch_count);
+  }
+
+  std::vector<Commitment> GetBatchCommitments() {
+    std::vector<Commitment> batch_commitments;
+    if constexpr (std::is_same_v<Commitment, Bucket>) {
+      batch_commitments = std::move(batch_commitments_);
+    } else {
+      batch_commitments.resize(batch_commitments_.size());
+      CHECK(Bucket::BatchNormalize(batch_commitments_, &batch_commitments));
+      batch_commitments_.clear();
+    }
+    this->batch_commitment_state_.Reset();
+    return batch_commitments;
+  }
+
+  // VectorCommitmentScheme methods
+  size_t N() const { return generators_.size(); }
+
+  // Writes the proof that P(|x|) = v to |writer|, where P(X) is |poly| and
+  // its commitment is <G, P> + |blind| * W. Returns false if the degree of
+  // |poly| is not less than |N()|.
+  [[nodiscard]] bool CreateInnerProductProof(
+      const Poly& poly, const Field& blind, const Point& x,
+      TranscriptWriter<Commitment>* writer) const {
+    const std::vector<Field>& coefficients = poly.coefficients().coefficients();
+    size_t n = N();
+    if (coefficients.size() > n) {
+      LOG(ERROR) << "Too many coefficients: " << coefficients.size();
+      return false;
+    }
+
+    // S(X) is a random polynomial with a root at |x|.
+    // b = [1, x, x², ..., xⁿ⁻¹]
+    std::vector<Field> b = Field::GetSuccessivePowers(n, x);
+    std::vector<Field> s_poly =
+        base::CreateVector(n, []() { return Field::Random(); });
+    s_poly[0] -= Field::SumOfProductsSerial(s_poly, b);
+    Field s_blind = Field::Random();
+
+    Bucket s_commitment;
+    if (!CommitWithBlind(s_poly, s_blind, &s_commitment)) return false;
+    if (!writer->WriteToProof(ToCommitment(s_commitment))) return false;
+
+    Field xi = writer->SqueezeChallenge();
+    Field z = writer->SqueezeChallenge();
+
+    // P'(X) = P(X) + ξ * S(X) - v, where v = P(x) + ξ * S(x), so that P'(X)
+    // has a root at |x|.
+    std::vector<Field> p = std::move(s_poly);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < n; ++i) {
+      p[i] *= xi;
+      if (i < coefficients.size()) p[i] += coefficients[i];
+    }
+    p[0] -= Field::SumOfProductsSerial(p, b);
+
+    // |f| accumulates the blinding factor of the folded commitments.
+    Field f = s_blind * xi + blind;
+
+    math::VariableBaseMSM<AffinePoint> msm;
+    std::vector<AffinePoint> g = generators_;
+    for (size_t half = n >> 1; half > 0; half >>= 1) {
+      absl::Span<const AffinePoint> g_lo(g.data(), half);
+      absl::Span<const AffinePoint> g_hi(g.data() + half, half);
+      absl::Span<const Field> p_lo(p.data(), half);
+      absl::Span<const Field> p_hi(p.data() + half, half);
+      absl::Span<const Field> b_lo(b.data(), half);
+      absl::Span<const Field> b_hi(b.data() + half, half);
+
+      // Lⱼ = <G_lo, p_hi> + z<p_hi, b_lo> * U + l_blind * W
+      // Rⱼ = <G_hi, p_lo> + z<p_lo, b_hi> * U + r_blind * W
+      Field l_blind = Field::Random();
+      Field r_blind = Field::Random();
+      Bucket l;
+      Bucket r;
+      if (!msm.Run(g_lo, p_hi, &l)) return false;
+      if (!msm.Run(g_hi, p_lo, &r)) return false;
+      l += math::ConvertPoint<Bucket>(
+          (z * Field::SumOfProductsSerial(p_hi, b_lo)) * u_ + l_blind * w_);
+      r += math::ConvertPoint<Bucket>(
+          (z * Field::SumOfProductsSerial(p_lo, b_hi)) * u_ + r_blind * w_);
+      if (!writer->WriteToProof(ToCommitment(l))) return false;
+      if (!writer->WriteToProof(ToCommitment(r))) return false;
+
+      Field u_j = writer->SqueezeChallenge();
+      Field u_j_inv = u_j.Inverse();
+
+      // p = p_lo + uⱼ⁻¹ * p_hi
+      // b = b_lo + uⱼ * b_hi
+      OPENMP_PARALLEL_FOR(size_t i = 0; i < half; ++i) {
+        p[i] += p[half + i] * u_j_inv;
+        b[i] += b[half + i] * u_j;
+      }
+      p.resize(half);
+      b.resize(half);
+      // G = G_lo + uⱼ * G_hi
+      if (!FoldGenerators(u_j, g)) return false;
+
+      f += l_blind * u_j_inv;
+      f += r_blind * u_j;
+    }
+
+    // c = p₀
+    return writer->WriteToProof(p[0]) && writer->WriteToProof(f);
+  }
+
+  // Reads the proof that P(|x|) = |v| from |reader| and verifies it, where
+  // the commitment to P(X) is Σᵢ |scalars[i]| * |commitments[i]|. Returns
+  // false if the proof can't be read or it is invalid.
+  [[nodiscard]] bool VerifyInnerProductProof(
+      absl::Span<const Commitment> commitments,
+      absl::Span<const Field> scalars, const Point& x, const Field& v,
+      TranscriptReader<Commitment>* reader) const {
+    if (commitments.size() != scalars.size()) {
+      LOG(ERROR) << "Size of |commitments| and |scalars| do not match";
+      return false;
+    }
+    size_t n = N();
+    size_t k = this->K();
+
+    // The points and their scalars except the generators, U and W.
+    // [S, L₀, ..., Lₖ₋₁, R₀, ..., Rₖ₋₁, C₀, C₁, ...]
+    std::vector<Commitment> points(1 + 2 * k + commitments.size());
+    if (!reader->ReadFromProof(&points[0])) return false;
+    Field xi = reader->SqueezeChallenge();
+    Field z = reader->SqueezeChallenge();
+
+    std::vector<Field> u(k);
+    for (size_t j = 0; j < k; ++j) {
+      if (!reader->ReadFromProof(&points[1 + j])) return false;
+      if (!reader->ReadFromProof(&points[1 + k + j])) return false;
+      u[j] = reader->SqueezeChallenge();
+    }
+    std::vector<Field> u_inv = u;
+    if (!Field::BatchInverseInPlace(u_inv)) return false;
+
+    Field c;
+    Field f;
+    if (!reader->ReadFromProof(&c)) return false;
+    if (!reader->ReadFromProof(&f)) return false;
+    std::copy(commitments.begin(), commitments.end(),
+              points.begin() + 1 + 2 * k);
+
+    // The folded b is b₀ = Πⱼ (1 + uⱼ * x^(2^(k - 1 - j))).
+    Field b = Field::One();
+    Field x_power = x;
+    for (size_t j = k - 1; j != SIZE_MAX; --j) {
+      b *= Field::One() + u[j] * x_power;
+      x_power.SquareInPlace();
+    }
+
+    // The folded generator is G'₀ = <s, G>, where sᵢ = Πⱼ uⱼ^(bit of i for
+    // the round j). Every sᵢ is multiplied by -c in advance.
+    std::vector<Field> s(n);
+    s[0] = -c;
+    for (size_t len = 1, j = k - 1; len < n; len <<= 1, --j) {
+      const Field& u_j = u[j];
+      OPENMP_PARALLEL_FOR(size_t i = 0; i < len; ++i) {
+        s[len + i] = s[i] * u_j;
+      }
+    }
+
+    // clang-format off
+    // P' = P - v * G₀ + ξ * S
+    // P' + Σⱼ (uⱼ⁻¹ * Lⱼ + uⱼ * Rⱼ) ≟ c * (G'₀ + bz * U) + f * W
+    // <-c * s, G> - v * G₀ - cbz * U - f * W + ξ * S + Σⱼ (uⱼ⁻¹ * Lⱼ + uⱼ * Rⱼ) + Σᵢ aᵢ * Cᵢ ≟ 0
+    // clang-format on
+    // All of them are computed by a single MSM.
+    s[0] -= v;
+    std::vector<AffinePoint> bases;
+    bases.reserve(n + 2 + points.size());
+    bases.insert(bases.end(), generators_.begin(), generators_.end());
+    bases.push_back(u_);
+    bases.push_back(w_);
+    if constexpr (std::is_same_v<Commitment, AffinePoint>) {
+      bases.insert(bases.end(), points.begin(), points.end());
+    } else {
+      bases.resize(n + 2 + points.size());
+      absl::Span<AffinePoint> normalized =
+          absl::MakeSpan(bases).subspan(n + 2);
+      if (!Commitment::BatchNormalize(points, &normalized)) return false;
+    }
+
+    std::vector<Field> bases_scalars = std::move(s);
+    bases_scalars.reserve(bases.size());
+    bases_scalars.push_back(-c * b * z);
+    bases_scalars.push_back(-f);
+    bases_scalars.push_back(xi);
+    bases_scalars.insert(bases_scalars.end(), u_inv.begin(), u_inv.end());
+    bases_scalars.insert(bases_scalars.end(), u.begin(), u.end());
+    bases_scalars.insert(bases_scalars.end(), scalars.begin(), scalars.end());
+
+    math::VariableBaseMSM<AffinePoint> msm;
+    Bucket result;
+    if (!msm.Run(bases, bases_scalars, &result)) return false;
+    return result.IsZero();
+  }
+
+ private:
+  friend class VectorCommitmentScheme<IPA<AffinePoint, MaxDegree, Commitment>>;
+  friend class UnivariatePolynomialCommitmentScheme<
+      IPA<AffinePoint, MaxDegree, Commitment>>;
+
+  // A polynomial oracle with its openings at the points of a point set.
+  template <typename PolyOracle>
+  struct OracleOpenings {
+    // Pᵢ or Cᵢ
+    const PolyOracle* poly_oracle;
+    // The index of the point set at which |poly_oracle| is opened.
+    size_t set_index;
+    // The openings ordered by the points in the point set.
+    std::vector<Field> openings;
+  };
+
+  // Groups the oracles of |poly_openings| by the sets of points at which they
+  // are opened, in the same order as construct_intermediate_sets() of halo2.
+  // The oracles are in the order in which they first appear. The points of a
+  // set are in the order in which the points first appear in
+  // |poly_openings|, and the sets are in the order in which they first
+  // appear over the oracles.
+  template <typename PolyOracle, typename Container>
+  static void ConstructIntermediateSets(
+      const Container& poly_openings,
+      std::vector<OracleOpenings<PolyOracle>>* oracles,
+      std::vector<std::vector<Point>>* point_sets) {
+    size_t size = std::size(poly_openings);
+    std::vector<const Point*> points;
+    std::vector<size_t> point_indices(size);
+    std::vector<size_t> oracle_indices(size);
+    std::vector<std::vector<size_t>> oracle_point_indices;
+    for (size_t i = 0; i < size; ++i) {
+      const Point& point = *poly_openings[i].point;
+      auto point_it =
+          std::find_if(points.begin(), points.end(),
+                       [&point](const Point* p) { return *p == point; });
+      point_indices[i] = point_it - points.begin();
+      if (point_it == points.end()) points.push_back(&point);
+
+      // NOTE: The oracles are compared by their addresses like
+      // halo2, so that the same polynomials at different addresses are
+      // opened separately.
+      const PolyOracle* poly_oracle = poly_openings[i].poly_oracle.get();
+      auto oracle_it = std::find_if(
+          oracles->begin(), oracles->end(),
+          [poly_oracle](const OracleOpenings<PolyOracle>& oracle) {
+            return oracle.poly_oracle == poly_oracle;
+          });
+      oracle_indices[i] = oracle_it - oracles->begin();
+      if (oracle_it == oracles->end()) {
+        oracles->push_back({poly_oracle, 0, {}});
+        oracle_point_indices.emplace_back();
+      }
+      oracle_point_indices[oracle_indices[i]].push_back(point_indices[i]);
+    }
+
+    std::vector<std::vector<size_t>> sets;
+    for (size_t i = 0; i < oracles->size(); ++i) {
+      std::vector<size_t>& set = oracle_point_indices[i];
+      std::sort(set.begin(), set.end());
+      set.erase(std::unique(set.begin(), set.end()), set.end());
+      auto it = std::find(sets.begin(), sets.end(), set);
+      (*oracles)[i].set_index = it - sets.begin();
+      (*oracles)[i].openings.resize(set.size());
+      if (it == sets.end()) sets.push_back(set);
+    }
+
+    for (size_t i = 0; i < size; ++i) {
+      const std::vector<size_t>& set = oracle_point_indices[oracle_indices[i]];
+      size_t pos = std::lower_bound(set.begin(), set.end(), point_indices[i]) -
+                   set.begin();
+      (*oracles)[oracle_indices[i]].openings[pos] = poly_openings[i].opening;
+    }
+
+    *point_sets = base::Map(sets, [&points](const std::vector<size_t>& set) {
+      return base::Map(set, [&points](size_t idx) { return *points[idx]; });
+    });
+  }
+
+  // Returns [xᵐ⁻¹, ..., x, 1].
+  static std::vector<Field> GetReversedPowers(size_t m, const Field& x) {
+    std::vector<Field> powers = Field::GetSuccessivePowers(m, x);
+    std::reverse(powers.begin(), powers.end());
+    return powers;
+  }
+
+  // UnivariatePolynomialCommitmentScheme methods
+  template <typename Container>
+  [[nodiscard]] bool DoCreateOpeningProof(
+      const Container& poly_openings,
+      TranscriptWriter<Commitment>* writer) const {
+    Field x1 = writer->SqueezeChallenge();
+    Field x2 = writer->SqueezeChallenge();
+
+    // {[P₀, P₁], [x₀, x₁]}
+    // {[P₂], [x₁]}
+    std::vector<OracleOpenings<Poly>> oracles;
+    std::vector<std::vector<Point>> point_sets;
+    ConstructIntermediateSets<Poly>(poly_openings, &oracles, &point_sets);
+    size_t m = point_sets.size();
+
+    std::vector<std::vector<const Poly*>> set_polys(m);
+    for (const OracleOpenings<Poly>& oracle : oracles) {
+      set_polys[oracle.set_index].push_back(oracle.poly_oracle);
+    }
+    // Qᵢ(X) = Σⱼ x₁^(|Sᵢ| - 1 - j) * Pᵢⱼ(X), where Sᵢ is the i-th set.
+    std::vector<Poly> q_polys =
+        base::Map(set_polys, [&x1](const std::vector<const Poly*>& polys) {
+          return Poly::WeightedSum(polys, GetReversedPowers(polys.size(), x1));
+        });
+
+    // Q'(X) = Σᵢ x₂^(m - 1 - i) * Qᵢ(X) / Zᵢ(X), where Zᵢ(X) vanishes on the
+    // i-th point set and the remainders are discarded.
+    std::vector<Poly> quotients = base::Map(
+        q_polys, [&point_sets](size_t i, const Poly& q_poly) {
+          Poly quotient = q_poly;
+          quotient.DivByVanishingPolyInPlace(point_sets[i]);
+          return quotient;
+        });
+    Poly q_prime_poly = Poly::WeightedSum(
+        base::Map(quotients, [](const Poly& poly) { return &poly; }),
+        GetReversedPowers(m, x2));
+    Field q_prime_blind = Field::Random();
+
+    Bucket q_prime;
+    if (!CommitWithBlind(q_prime_poly.coefficients().coefficients(),
+                         q_prime_blind, &q_prime)) {
+      return false;
+    }
+    if (!writer->WriteToProof(ToCommitment(q_prime))) return false;
+
+    Field x3 = writer->SqueezeChallenge();
+
+    std::vector<Field> q_evals = base::Map(
+        q_polys, [&x3](const Poly& q_poly) { return q_poly.Evaluate(x3); });
+    if (!writer->BatchWriteToProof(absl::MakeConstSpan(q_evals))) return false;
+
+    Field x4 = writer->SqueezeChallenge();
+
+    // P(X) = x₄ᵐ * Q'(X) + Σᵢ x₄^(m - 1 - i) * Qᵢ(X)
+    std::vector<const Poly*> polys;
+    polys.reserve(m + 1);
+    polys.push_back(&q_prime_poly);
+    for (const Poly& q_poly : q_polys) {
+      polys.push_back(&q_poly);
+    }
+    std::vector<Field> x4_powers = GetReversedPowers(m + 1, x4);
+    Poly p_poly = Poly::WeightedSum(polys, x4_powers);
+    return CreateInnerProductProof(p_poly, q_prime_blind * x4_powers[0], x3,
+                                   writer);
+  }
+
+  template <typename Container>
+  [[nodiscard]] bool DoVerifyOpeningProof(
+      const Container& poly_openings,
+      TranscriptReader<Commitment>* reader) const {
+    Field x1 = reader->SqueezeChallenge();
+    Field x2 = reader->SqueezeChallenge();
+
+    // {[C₀, C₁], [x₀, x₁]}
+    // {[C₂], [x₁]}
+    std::vector<OracleOpenings<Commitment>> oracles;
+    std::vector<std::vector<Point>> point_sets;
+    ConstructIntermediateSets<Commitment>(poly_openings, &oracles,
+                                          &point_sets);
+    size_t m = point_sets.size();
+
+    // The commitment to Qᵢ(X) is Σⱼ x₁^(|Sᵢ| - 1 - j) * Cᵢⱼ and its openings
+    // are collapsed in the same way.
+    std::vector<Field> x1_powers(m, Field::One());
+    std::vector<Field> oracle_scalars(oracles.size());
+    std::vector<std::vector<Field>> q_eval_sets = base::Map(
+        point_sets, [](const std::vector<Point>& point_set) {
+          return std::vector<Field>(point_set.size(), Field::Zero());
+        });
+    for (size_t i = oracles.size() - 1; i != SIZE_MAX; --i) {
+      const OracleOpenings<Commitment>& oracle = oracles[i];
+      Field& x1_power = x1_powers[oracle.set_index];
+      std::vector<Field>& q_evals = q_eval_sets[oracle.set_index];
+      for (size_t j = 0; j < q_evals.size(); ++j) {
+        q_evals[j] += oracle.openings[j] * x1_power;
+      }
+      oracle_scalars[i] = x1_power;
+      x1_power *= x1;
+    }
+
+    Commitment q_prime;
+    if (!reader->ReadFromProof(&q_prime)) return false;
+
+    Field x3 = reader->SqueezeChallenge();
+
+    // [Q₀(x₃), Q₁(x₃), ...]
+    std::vector<Field> q_evals(m);
+    if (!reader->BatchReadFromProof(absl::MakeSpan(q_evals))) return false;
+
+    // Q'(x₃) = Σᵢ x₂^(m - 1 - i) * (Qᵢ(x₃) - Rᵢ(x₃)) / Zᵢ(x₃), where Rᵢ(X)
+    // interpolates the openings of Qᵢ(X) on the i-th point set.
+    Field q_prime_eval = Field::Zero();
+    for (size_t i = 0; i < m; ++i) {
+      Poly r_poly;
+      if (!math::LagrangeInterpolate(point_sets[i], q_eval_sets[i], &r_poly)) {
+        return false;
+      }
+      Field z_eval = Poly::EvaluateVanishingPolyByRoots(point_sets[i], x3);
+      if (z_eval.IsZero()) {
+        LOG(ERROR) << "x₃ is one of the opening points";
+        return false;
+      }
+      q_prime_eval *= x2;
+      q_prime_eval += (q_evals[i] - r_poly.Evaluate(x3)) * z_eval.Inverse();
+    }
+
+    Field x4 = reader->SqueezeChallenge();
+
+    // P = x₄ᵐ * Q' + Σᵢ x₄^(m - 1 - i) * Qᵢ
+    // v = x₄ᵐ * Q'(x₃) + Σᵢ x₄^(m - 1 - i) * Qᵢ(x₃)
+    std::vector<Field> x4_powers = GetReversedPowers(m + 1, x4);
+    std::vector<Commitment> commitments;
+    std::vector<Field> scalars;
+    commitments.reserve(oracles.size() + 1);
+    scalars.reserve(oracles.size() + 1);
+    commitments.push_back(std::move(q_prime));
+    scalars.push_back(x4_powers[0]);
+    for (size_t i = 0; i < oracles.size(); ++i) {
+      commitments.push_back(*oracles[i].poly_oracle);
+      scalars.push_back(oracle_scalars[i] *
+                        x4_powers[1 + oracles[i].set_index]);
+    }
+    Field v = q_prime_eval * x4_powers[0];
+    for (size_t i = 0; i < m; ++i) {
+      v += q_evals[i] * x4_powers[1 + i];
+    }
+    return VerifyInnerProductProof(commitments, scalars, x3, v, reader);
+  }
+
+  [[nodiscard]] bool DoSetup(size_t size) {
+    if (!base::bits::IsPowerOfTwo(size) || size > MaxDegree + 1) {
+      LOG(ERROR) << "Invalid size of generators: " << size;
+      return false;
+    }
+    // NOTE: halo2 derives the generators by hashing to the curve,
+    // so that nobody knows their discrete logarithms. Like |Pedersen|,
+    // |Random| is used instead.
+    generators_ =
+        base::CreateVector(size, []() { return AffinePoint::Random(); });
+    u_ = AffinePoint::Random();
+    w_ = AffinePoint::Random();
+    return ComputeGeneratorsLagrange();
+  }
+
+  // The generators of the lagrange basis are derived by the IFFT over
+  // |generators_|, so that the commitment of the evaluations is equal to the
+  // one of its coefficients.
+  [[nodiscard]] bool ComputeGeneratorsLagrange() {
+    using Domain = math::Radix2EvaluationDomain<Field, MaxDegree>;
+
+    std::unique_ptr<Domain> domain = Domain::Create(generators_.size());
+    generators_lagrange_.resize(generators_.size());
+    return domain->IFFTPoints(absl::MakeConstSpan(generators_),
+                              absl::MakeSpan(generators_lagrange_));
+  }
+
+  template <typename ScalarContainer>
+  [[nodiscard]] bool DoCommit(const ScalarContainer& v, Commitment* out) const {
+    return DoMSM(generators_, v, out);
+  }
+
+  template <typename ScalarContainer>
+  [[nodiscard]] bool DoCommit(const ScalarContainer& v,
+                              BatchCommitmentState& state, size_t index) {
+    return DoMSM(generators_, v, state, index);
+  }
+
+  [[nodiscard]] bool DoCommit(const Poly& poly, Commitment* out) const {
+    return DoCommit(poly.coefficients().coefficients(), out);
+  }
+
+  [[nodiscard]] bool DoCommit(const Poly& poly, BatchCommitmentState& state,
+                              size_t index) {
+    return DoCommit(poly.coefficients().coefficients(), state, index);
+  }
+
+  template <typename ScalarContainer>
+  [[nodiscard]] bool DoCommitLagrange(const ScalarContainer& v,
+                                      Commitment* out) const {
+    return DoMSM(generators_lagrange_, v, out);
+  }
+
+  template <typename ScalarContainer>
+  [[nodiscard]] bool DoCommitLagrange(const ScalarContainer& v,
+                                      BatchCommitmentState& state,
+                                      size_t index) {
+    return DoMSM(generators_lagrange_, v, state, index);
+  }
+
+  [[nodiscard]] bool DoCommitLagrange(
+      const typename Base::Evals& evals, Commitment* out) const {
+    return DoCommitLagrange(evals.evaluations(), out);
+  }
+
+  [[nodiscard]] bool DoCommitLagrange(const typename Base::Evals& evals,
+                                      BatchCommitmentState& state,
+                                      size_t index) {
+    return DoCommitLagrange(evals.evaluations(), state, index);
+  }
+
+  static Commitment ToCommitment(const Bucket& bucket) {
+    if constexpr (std::is_same_v<Commitment, Bucket>) {
+      return bucket;
+    } else {
+      return math::ConvertPoint<Commitment>(bucket);
+    }
+  }
+
+  template <typename BaseContainer, typename ScalarContainer>
+  static bool DoMSM(const BaseContainer& bases, const ScalarContainer& scalars,
+                    Commitment* out) {
+    if constexpr (std::is_same_v<Commitment, Bucket>) {
+      return RunMSM(bases, scalars, out);
+    } else {
+      Bucket result;
+      if (!RunMSM(bases, scalars, &result)) return false;
+      *out = ToCommitment(result);
+      return true;
+    }
+  }
+
+  template <typename BaseContainer, typename ScalarContainer>
+  bool DoMSM(const BaseContainer& bases, const ScalarContainer& scalars,
+             BatchCommitmentState& state, size_t index) {
+    return RunMSM(bases, scalars, &batch_commitments_[index]);
+  }
+
+  template <typename BaseContainer, typename ScalarContainer>
+  static bool RunMSM(const BaseContainer& bases, const ScalarContainer& scalars,
+                     Bucket* out) {
+    math::VariableBaseMSM<AffinePoint> msm;
+    absl::Span<const AffinePoint> bases_span = absl::Span<const AffinePoint>(
+        bases.data(), std::min(bases.size(), std::size(scalars)));
+    return msm.Run(bases_span, scalars, out);
+  }
+
+  // <G, |v|> + |blind| * W
+  template <typename ScalarContainer>
+  bool CommitWithBlind(const ScalarContainer& v, const Field& blind,
+                       Bucket* out) const {
+    if (!RunMSM(generators_, v, out)) return false;
+    *out += math::ConvertPoint<Bucket>(blind * w_);
+    return true;
+  }
+
+  // Folds |g| into its half, where gᵢ = gᵢ + |u| * g_{i + n / 2}. The
+  // generators are folded in parallel by chunks and each chunk is normalized
+  // at once.
+  static bool FoldGenerators(const Field& u, std::vector<AffinePoint>& g) {
+    size_t half = g.size() / 2;
+    std::atomic<bool> normalized = true;
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < half; i += kChunkSize) {
+      size_t chunk_size = std::min(kChunkSize, half - i);
+      std::vector<JacobianPoint> folded(chunk_size);
+      for (size_t j = 0; j < chunk_size; ++j) {
+        folded[j] = u * g[half + i + j];
+        folded[j] += g[i + j];
+      }
+      absl::Span<AffinePoint> chunk(&g[i], chunk_size);
+      if (!JacobianPoint::BatchNormalize(folded, &chunk)) {
+        normalized.store(false, std::memory_order_relaxed);
+      }
+    }
+    g.resize(half);
+    return normalized.load();
+  }
+
+  // G
+  std::vector<AffinePoint> generators_;
+  // The generators of the lagrange basis.
+  std::vector<AffinePoint> generators_lagrange_;
+  // U, which binds the inner product.
+  AffinePoint u_;
+  // W, which blinds the commitments.
+  AffinePoint w_;
+  std::vector<Bucket> batch_commitments_;
+};
+
+template <typename AffinePoint, size_t MaxDegree, typename _Commitment>
+struct VectorCommitmentSchemeTraits<IPA<AffinePoint, MaxDegree, _Commitment>> {
+ public:
+  constexpr static size_t kMaxSize = MaxDegree + 1;
+  constexpr static bool kIsTransparent = true;
+  constexpr static bool kSupportsBatchMode = true;
+
+  using Field = typename AffinePoint::ScalarField;
+  using Commitment = _Commitment;
+};
+
+}  // namespace crypto
+
+namespace base {
+
+template <typename AffinePoint, size_t MaxDegree, typename Commitment>
+class Copyable<crypto::IPA<AffinePoint, MaxDegree, Commitment>> {
+ public:
+  using PCS = crypto::IPA<AffinePoint, MaxDegree, Commitment>;
+
+  static bool WriteTo(const PCS& pcs, Buffer* buffer) {
+    return buffer->WriteMany(pcs.generators(), pcs.u(), pcs.w());
+  }
+
+  static bool ReadFrom(const Buffer& buffer, PCS* pcs) {
+    std::vector<AffinePoint> generators;
+    AffinePoint u;
+    AffinePoint w;
+    if (!buffer.ReadMany(&generators, &u, &w)) {
+      return false;
+    }
+
+    *pcs = PCS(std::move(generators), u, w);
+    return true;
+  }
+
+  static size_t EstimateSize(const PCS& pcs) {
+    return base::EstimateSize(pcs.generators()) + base::EstimateSize(pcs.u()) +
+           base::EstimateSize(pcs.w());
+  }
+};
+
+}  // namespace base
+}  // namespace tachyon
+
+#endif  // TACHYON_CRYPTO_COMMITMENTS_IPA_IPA_H_
@@ -0,0 +1,191 @@
+#include "tachyon/crypto/commitments/ipa/ipa.h"
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/buffer/buffer.h"
+#include "tachyon/crypto/transcripts/simple_transcript.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/polynomials/univariate/univariate_evaluation_domain_factory.h"
+
+namespace tachyon::crypto {
+
+namespace {
+
+class IPATest : public testing::Test {
+ public:
+  constexpr static size_t K = 3;
+  constexpr static size_t N = size_t{1} << K;
+  constexpr static size_t kMaxDegree = N - 1;
+
+  using PCS =
+      IPA<math::bn254::G1AffinePoint, kMaxDegree, math::bn254::G1AffinePoint>;
+  using F = PCS::Field;
+  using Poly = PCS::Poly;
+  using Evals = PCS::Evals;
+  using Domain = PCS::Domain;
+  using Commitment = PCS::Commitment;
+  using Point = Poly::Point;
+  using PolyRef = base::DeepRef<const Poly>;
+  using PointRef = base::DeepRef<const Point>;
+  using CommitmentRef = base::DeepRef<const Commitment>;
+
+  static void SetUpTestSuite() { math::bn254::G1Curve::Init(); }
+
+  IPATest() : writer_(base::Uint8VectorBuffer()) {}
+
+  void SetUp() override {
+    ASSERT_TRUE(pcs_.Setup(N));
+
+    polys_ = base::CreateVector(4, []() { return Poly::Random(kMaxDegree); });
+    points_ = {F(1), F(2), F(3)};
+
+    commitments_.reserve(4);
+    for (const Poly& poly : polys_) {
+      Commitment commitment;
+      CHECK(pcs_.Commit(poly, &commitment));
+      commitments_.emplace_back(std::move(commitment));
+    }
+
+    // clang-format off
+    // {P₀, [x₀, x₁]}
+    AddOpening(0, 0);
+    AddOpening(0, 1);
+    // {P₁, [x₁, x₀]}
+    AddOpening(1, 1);
+    AddOpening(1, 0);
+    // {P₂, [x₂]}
+    AddOpening(2, 2);
+    // {P₃, [x₁]}
+    AddOpening(3, 1);
+    // clang-format on
+
+    // The challenges of |SimpleTranscript| are zero until something is
+    // written to it.
+    CHECK(writer_.WriteToTranscript(F(1)));
+  }
+
+  void AddOpening(size_t poly_idx, size_t point_idx) {
+    F opening = polys_[poly_idx].Evaluate(points_[point_idx]);
+    prover_openings_.emplace_back(PolyRef(&polys_[poly_idx]),
+                                  PointRef(&points_[point_idx]), opening);
+    verifier_openings_.emplace_back(CommitmentRef(&commitments_[poly_idx]),
+                                    PointRef(&points_[point_idx]), opening);
+  }
+
+  SimpleTranscriptReader<Commitment> CreateReader() {
+    base::Buffer read_buf(writer_.buffer().buffer(),
+                          writer_.buffer().buffer_len());
+    SimpleTranscriptReader<Commitment> reader(std::move(read_buf));
+    CHECK(reader.WriteToTranscript(F(1)));
+    return reader;
+  }
+
+ protected:
+  PCS pcs_;
+  std::vector<Poly> polys_;
+  std::vector<F> points_;
+  std::vector<Commitment> commitments_;
+  std::vector<PolynomialOpening<Poly>> prover_openings_;
+  std::vector<PolynomialOpening<Poly, Commitment>> verifier_openings_;
+  SimpleTranscriptWriter<Commitment> writer_;
+};
+
+}  // namespace
+
+TEST_F(IPATest, Setup) {
+  EXPECT_EQ(pcs_.N(), N);
+  EXPECT_EQ(pcs_.generators().size(), N);
+  EXPECT_EQ(pcs_.generators_lagrange().size(), N);
+
+  PCS pcs;
+  EXPECT_FALSE(pcs.Setup(N - 1));
+}
+
+TEST_F(IPATest, CommitLagrange) {
+  Poly poly = Poly::Random(N - 1);
+
+  Commitment commit;
+  ASSERT_TRUE(pcs_.Commit(poly, &commit));
+
+  std::unique_ptr<Domain> domain = Domain::Create(N);
+  Evals poly_evals = domain->FFT(poly);
+
+  Commitment commit_lagrange;
+  ASSERT_TRUE(pcs_.CommitLagrange(poly_evals, &commit_lagrange));
+
+  EXPECT_EQ(commit, commit_lagrange);
+}
+
+TEST_F(IPATest, BatchCommit) {
+  pcs_.SetBatchMode(polys_.size());
+  for (size_t i = 0; i < polys_.size(); ++i) {
+    ASSERT_TRUE(pcs_.Commit(polys_[i], i));
+  }
+  EXPECT_EQ(pcs_.GetBatchCommitments(), commitments_);
+  EXPECT_FALSE(pcs_.GetBatchMode());
+}
+
+TEST_F(IPATest, CreateAndVerifyInnerProductProof) {
+  const Poly& poly = polys_[0];
+  F blind = F::Random();
+  F x = F::Random();
+  F v = poly.Evaluate(x);
+
+  // C = <G, P> + blind * W
+  Commitment commitment;
+  ASSERT_TRUE(pcs_.Commit(poly, &commitment));
+  commitment = (commitment + blind * pcs_.w()).ToAffine();
+
+  ASSERT_TRUE(pcs_.CreateInnerProductProof(poly, blind, x, &writer_));
+
+  {
+    SimpleTranscriptReader<Commitment> reader = CreateReader();
+    EXPECT_TRUE(pcs_.VerifyInnerProductProof(
+        absl::MakeConstSpan(&commitment, 1), std::vector<F>{F::One()}, x, v,
+        &reader));
+  }
+  {
+    SimpleTranscriptReader<Commitment> reader = CreateReader();
+    EXPECT_FALSE(pcs_.VerifyInnerProductProof(
+        absl::MakeConstSpan(&commitment, 1), std::vector<F>{F::One()}, x,
+        v + F::One(), &reader));
+  }
+}
+
+TEST_F(IPATest, CreateAndVerifyProof) {
+  ASSERT_TRUE(pcs_.CreateOpeningProof(prover_openings_, &writer_));
+
+  SimpleTranscriptReader<Commitment> reader = CreateReader();
+  EXPECT_TRUE(pcs_.VerifyOpeningProof(verifier_openings_, &reader));
+}
+
+TEST_F(IPATest, VerifyProofWithWrongOpening) {
+  ASSERT_TRUE(pcs_.CreateOpeningProof(prover_openings_, &writer_));
+
+  verifier_openings_[1].opening += F::One();
+  SimpleTranscriptReader<Commitment> reader = CreateReader();
+  EXPECT_FALSE(pcs_.VerifyOpeningProof(verifier_openings_, &reader));
+}
+
+TEST_F(IPATest, Copyable) {
+  std::vector<uint8_t> vec;
+  vec.resize(base::EstimateSize(pcs_));
+  base::Buffer write_buf(vec.data(), vec.size());
+  ASSERT_TRUE(write_buf.Write(pcs_));
+  ASSERT_TRUE(write_buf.Done());
+
+  write_buf.set_buffer_offset(0);
+
+  PCS value;
+  ASSERT_TRUE(write_buf.Read(&value));
+
+  EXPECT_EQ(pcs_.generators(), value.generators());
+  EXPECT_EQ(pcs_.generators_lagrange(), value.generators_lagrange());
+  EXPECT_EQ(pcs_.u(), value.u());
+  EXPECT_EQ(pcs_.w(), value.w());
+}
+
+}  // namespace tachyon::crypto
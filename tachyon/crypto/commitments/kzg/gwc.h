@@ -0,0 +1,251 @@
+// Copyright 2020-2022 The Electric Coin Company
+// Copyright 2022 The Halo2 developers
+// Use of this source code is governed by a MIT/Apache-2.0 style license that
+// can be found in the LICENSE-MIT.halo2 and the LICENCE-APACHE.halo2
+// file.
+
+#ifndef TACHYON_CRYPTO_COMMITMENTS_KZG_GWC_H_
+#define TACHYON_CRYPTO_COMMITMENTS_KZG_GWC_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "tachyon/crypto/commitments/kzg/kzg_family.h"
+#include "tachyon/crypto/commitments/kzg/kzg_pairing_accumulator.h"
+#include "tachyon/crypto/commitments/polynomial_openings.h"
+#include "tachyon/crypto/commitments/univariate_polynomial_commitment_scheme.h"
+#include "tachyon/crypto/transcripts/transcript.h"
+#include "tachyon/math/elliptic_curves/pairing/pairing.h"
+
+namespace tachyon {
+namespace zk {
+
+template <typename Curve, size_t MaxDegree, size_t MaxExtensionDegree,
+          typename _Commitment = typename math::Pippenger<
+              typename Curve::G1Curve::AffinePoint>::Bucket>
+class GWCExtension;
+
+}  // namespace zk
+
+namespace crypto {
+
+// The multi opening scheme of GWC19, which is described in the section 3 of
+// https://eprint.iacr.org/2019/953.pdf. Unlike |SHPlonk|, a witness is
+// committed per distinct point, so the proof is larger, but the prover
+// doesn't need to interpolate the openings and the verifier needs no field
+// inversion. The proof has the same layout as the one of ProverGWC and
+// VerifierGWC of halo2, where a witness is written per point in the order in
+// which the points first appear.
+template <typename Curve, size_t MaxDegree,
+          typename Commitment = typename math::Pippenger<
+              typename Curve::G1Curve::AffinePoint>::Bucket>
+class GWC final
+    : public UnivariatePolynomialCommitmentScheme<
+          GWC<Curve, MaxDegree, Commitment>>,
+      public KZGFamily<typename Curve::G1Curve::AffinePoint, MaxDegree,
+                       Commitment> {
+ public:
+  using Base =
+      UnivariatePolynomialCommitmentScheme<GWC<Curve, MaxDegree, Commitment>>;
+  using G1Point = typename Curve::G1Curve::AffinePoint;
+  using G2Point = typename Curve::G2Curve::AffinePoint;
+  using G2Prepared = typename Curve::G2Prepared;
+  using Field = typename Base::Field;
+  using Poly = typename Base::Poly;
+  using Point = typename Poly::Point;
+
+  GWC() = default;
+  explicit GWC(KZG<G1Point, MaxDegree, Commitment>&& kzg)
+      : KZGFamily<G1Point, MaxDegree, Commitment>(std::move(kzg)) {}
+
+  void ResizeBatchCommitments() {
+    this->kzg_.ResizeBatchCommitments(
+        this->batch_commitment_state_.batch_count);
+  }
+
+  std::vector<Commitment> GetBatchCommitments() {
+    return this->kzg_.GetBatchCommitments(this->batch_commitment_state_);
+  }
+
+  // Returns [[1]₂, [-𝜏]₂], whose line coefficients are computed once when
+  // they are set, so that every pairing check reuses them.
+  const std::array<G2Prepared, 2>& g2_arr() const { return g2_arr_; }
+
+  // Prepares [[1]₂, [-𝜏]₂] from |tau_g2| = [𝜏]₂. This needs to be called
+  // when the SRS is loaded instead of being created by |UnsafeSetup()|.
+  void SetTauG2(const G2Point& tau_g2) {
+    g2_arr_ = {G2Prepared::From(G2Point::Generator()),
+               G2Prepared::From(-tau_g2)};
+  }
+
+  // Reads the opening proof of |poly_openings| from |reader| and adds its
+  // pairing check to |accumulator| instead of checking it, so that the proofs
+  // of many openings are checked at once by |VerifyAccumulator()|. Returns
+  // false if the proof can't be read.
+  template <typename Container>
+  [[nodiscard]] bool AccumulateOpeningProof(
+      const Container& poly_openings, TranscriptReader<Commitment>* reader,
+      KZGPairingAccumulator<Curve>* accumulator) const {
+    using G1JacobianPoint = math::JacobianPoint<typename G1Point::Curve>;
+
+    Field v = reader->SqueezeChallenge();
+
+    // {x₀, [C₀, C₁]}
+    // {x₁, [C₀, C₂]}
+    std::vector<std::vector<size_t>> groups = GroupByPoint(poly_openings);
+
+    std::vector<Commitment> w_commitments(groups.size());
+    for (Commitment& w_commitment : w_commitments) {
+      if (!reader->ReadFromProof(&w_commitment)) return false;
+    }
+
+    Field u = reader->SqueezeChallenge();
+
+    // clang-format off
+    // |w| = W₀ + uW₁
+    // |w_with_aux| = x₀W₀ + ux₁W₁ + (C₀ + vC₁) + u(C₀ + vC₂) - (E₀ + uE₁)G
+    // clang-format on
+    G1JacobianPoint w = G1JacobianPoint::Zero();
+    G1JacobianPoint w_with_aux = G1JacobianPoint::Zero();
+    Field eval = Field::Zero();
+    Field u_power = Field::One();
+    for (size_t i = 0; i < groups.size(); ++i) {
+      const Point& point = *poly_openings[groups[i][0]].point;
+      Field scalar = u_power;
+      for (size_t idx : groups[i]) {
+        const auto& poly_opening = poly_openings[idx];
+        w_with_aux += scalar * *poly_opening.poly_oracle;
+        eval += scalar * poly_opening.opening;
+        scalar *= v;
+      }
+      w += u_power * w_commitments[i];
+      w_with_aux += (u_power * point) * w_commitments[i];
+      u_power *= u;
+    }
+    w_with_aux -= eval * G1Point::Generator();
+
+    // clang-format off
+    // e(|w_with_aux|, [1]₂) * e(|w|, [-𝜏]₂) ≟ gᴛ⁰
+    // Σᵢ uⁱ * (xᵢ * Wᵢ(𝜏) + Σⱼ vʲ * (Pᵢⱼ(𝜏) - Pᵢⱼ(xᵢ)) - 𝜏 * Wᵢ(𝜏)) ≟ 0
+    // Σᵢ uⁱ * Σⱼ vʲ * (Pᵢⱼ(𝜏) - Pᵢⱼ(xᵢ)) ≟ Σᵢ uⁱ * (𝜏 - xᵢ) * Wᵢ(𝜏)
+    // clang-format on
+    accumulator->Add(w_with_aux, w.ToAffine());
+    return true;
+  }
+
+  // Returns true if all the checks accumulated by |AccumulateOpeningProof()|
+  // hold.
+  [[nodiscard]] bool VerifyAccumulator(
+      const KZGPairingAccumulator<Curve>& accumulator) const {
+    return accumulator.Check(g2_arr_);
+  }
+
+ private:
+  friend class VectorCommitmentScheme<GWC<Curve, MaxDegree, Commitment>>;
+  friend class UnivariatePolynomialCommitmentScheme<
+      GWC<Curve, MaxDegree, Commitment>>;
+  template <typename, size_t, size_t, typename>
+  friend class zk::GWCExtension;
+
+  // Groups the indices of |poly_openings| by their points in the order in
+  // which the points first appear. The indices in a group keep their order,
+  // which is the order the powers of v are assigned to by halo2.
+  template <typename Container>
+  static std::vector<std::vector<size_t>> GroupByPoint(
+      const Container& poly_openings) {
+    std::vector<const Point*> points;
+    std::vector<std::vector<size_t>> groups;
+    for (size_t i = 0; i < std::size(poly_openings); ++i) {
+      const Point& point = *poly_openings[i].point;
+      auto it = std::find_if(points.begin(), points.end(),
+                             [&point](const Point* p) { return *p == point; });
+      if (it == points.end()) {
+        points.push_back(&point);
+        groups.push_back({i});
+      } else {
+        groups[it - points.begin()].push_back(i);
+      }
+    }
+    return groups;
+  }
+
+  // UnivariatePolynomialCommitmentScheme methods
+  template <typename Container>
+  [[nodiscard]] bool DoCreateOpeningProof(
+      const Container& poly_openings,
+      TranscriptWriter<Commitment>* writer) const {
+    Field v = writer->SqueezeChallenge();
+
+    // {x₀, [P₀, P₁]}
+    // {x₁, [P₀, P₂]}
+    std::vector<std::vector<size_t>> groups = GroupByPoint(poly_openings);
+    for (const std::vector<size_t>& group : groups) {
+      const Point& point = *poly_openings[group[0]].point;
+      std::vector<const Poly*> polys;
+      polys.reserve(group.size());
+      std::vector<Field> scalars =
+          Field::GetSuccessivePowers(group.size(), v);
+      Field eval = Field::Zero();
+      for (size_t j = 0; j < group.size(); ++j) {
+        const auto& poly_opening = poly_openings[group[j]];
+        polys.push_back(poly_opening.poly_oracle.get());
+        eval += scalars[j] * poly_opening.opening;
+      }
+
+      // Wᵢ(X) = (Σⱼ vʲ * Pᵢⱼ(X) - Σⱼ vʲ * Pᵢⱼ(xᵢ)) / (X - xᵢ)
+      Poly w_poly = Poly::WeightedSum(polys, scalars);
+      if (Field* constant = w_poly[0]; constant != nullptr) {
+        *constant -= eval;
+      }
+      DCHECK(w_poly.Evaluate(point).IsZero());
+      w_poly.DivByVanishingPolyInPlace(std::vector<Field>({point}));
+
+      Commitment w;
+      if (!this->Commit(w_poly, &w)) return false;
+      if (!writer->WriteToProof(w)) return false;
+    }
+    return true;
+  }
+
+  template <typename Container>
+  [[nodiscard]] bool DoVerifyOpeningProof(
+      const Container& poly_openings,
+      TranscriptReader<Commitment>* reader) const {
+    KZGPairingAccumulator<Curve> accumulator;
+    if (!AccumulateOpeningProof(poly_openings, reader, &accumulator)) {
+      return false;
+    }
+    return VerifyAccumulator(accumulator);
+  }
+
+  // KZGFamily methods
+  [[nodiscard]] bool DoUnsafeSetupWithTau(size_t size,
+                                          const Field& tau) override {
+    SetTauG2((G2Point::Generator() * tau).ToAffine());
+    return true;
+  }
+
+  std::array<G2Prepared, 2> g2_arr_;
+};
+
+template <typename Curve, size_t MaxDegree, typename _Commitment>
+struct VectorCommitmentSchemeTraits<GWC<Curve, MaxDegree, _Commitment>> {
+ public:
+  constexpr static size_t kMaxSize = MaxDegree + 1;
+  constexpr static bool kIsTransparent = false;
+  constexpr static bool kSupportsBatchMode = true;
+
+  using G1Point = typename Curve::G1Curve::AffinePoint;
+  using Field = typename G1Point::ScalarField;
+  using Commitment = _Commitment;
+};
+
+}  // namespace crypto
+}  // namespace tachyon
+
+#endif  // TACHYON_CRYPTO_COMMITMENTS_KZG_GWC_H_
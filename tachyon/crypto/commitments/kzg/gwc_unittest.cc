@@ -0,0 +1,94 @@
+#include "tachyon/crypto/commitments/kzg/gwc.h"
+
+#include "gtest/gtest.h"
+
+#include "tachyon/crypto/commitments/kzg/multi_opening_test.h"
+
+namespace tachyon::crypto {
+
+namespace {
+
+class GWCTest
+    : public MultiOpeningTest<GWC<math::bn254::BN254Curve, 7,
+                                  math::bn254::G1AffinePoint>> {};
+
+}  // namespace
+
+TEST_F(GWCTest, CreateAndVerifyProof) {
+  ASSERT_TRUE(pcs_.CreateOpeningProof(prover_openings_, &writer_));
+
+  std::vector<uint8_t> proof = writer_.buffer().owned_buffer();
+  SimpleTranscriptReader<Commitment> reader = CreateReader(proof);
+  EXPECT_TRUE(pcs_.VerifyOpeningProof(verifier_openings_, &reader));
+}
+
+TEST_F(GWCTest, VerifyProofWithWrongOpening) {
+  ASSERT_TRUE(pcs_.CreateOpeningProof(prover_openings_, &writer_));
+
+  std::vector<uint8_t> proof = writer_.buffer().owned_buffer();
+  verifier_openings_[4].opening += F::One();
+  SimpleTranscriptReader<Commitment> reader = CreateReader(proof);
+  EXPECT_FALSE(pcs_.VerifyOpeningProof(verifier_openings_, &reader));
+}
+
+TEST_F(GWCTest, VerifyTamperedProof) { TestVerifyTamperedProof(); }
+
+TEST_F(GWCTest, BatchVerifyProofs) { TestBatchVerifyProofs(); }
+
+TEST_F(GWCTest, CreateProofKnownAnswer) {
+  // With a known 𝜏, every witness of halo2's ProverGWC is recomputed from
+  // its definition without the SRS. For each point xᵢ in the order in which
+  // it first appears, halo2 writes
+  //
+  //   Wᵢ = [Σⱼ vʲ * (Pᵢⱼ(𝜏) - Pᵢⱼ(xᵢ)) / (𝜏 - xᵢ)]₁
+  //
+  // where Pᵢⱼ is the j-th polynomial opened at xᵢ in the order of the
+  // queries.
+  F tau(11);
+  ASSERT_TRUE(pcs_.UnsafeSetup(N, tau));
+  SetUpOpenings(base::CreateVector(5, [](size_t i) {
+    std::vector<F> coefficients = base::CreateVector(
+        N, [i](size_t j) { return F(static_cast<uint64_t>(i * N + j + 1)); });
+    return Poly(math::UnivariateDenseCoefficients<F, kMaxDegree>(
+        std::move(coefficients)));
+  }));
+
+  ASSERT_TRUE(pcs_.CreateOpeningProof(prover_openings_, &writer_));
+  std::vector<uint8_t> proof = writer_.buffer().owned_buffer();
+
+  // {x₀, [P₀, P₁, P₂]}
+  // {x₁, [P₀, P₁, P₂]}
+  // {x₂, [P₀, P₁, P₂, P₃]}
+  // {x₃, [P₃, P₄]}
+  // {x₄, [P₄]}
+  std::vector<std::vector<size_t>> groups = {
+      {0, 1, 2}, {0, 1, 2}, {0, 1, 2, 3}, {3, 4}, {4}};
+
+  SimpleTranscriptReader<Commitment> reader = CreateReader(proof);
+  F v = reader.SqueezeChallenge();
+  ASSERT_FALSE(v.IsZero());
+  for (size_t i = 0; i < groups.size(); ++i) {
+    SCOPED_TRACE(i);
+    const F& x = points_[i];
+    F numerator = F::Zero();
+    F v_power = F::One();
+    for (size_t j : groups[i]) {
+      numerator +=
+          v_power * (polys_[j].Evaluate(tau) - polys_[j].Evaluate(x));
+      v_power *= v;
+    }
+    F scalar = numerator * (tau - x).Inverse();
+    Commitment expected = (scalar * Commitment::Generator()).ToAffine();
+
+    Commitment w;
+    ASSERT_TRUE(reader.ReadFromProof(&w));
+    EXPECT_EQ(w, expected);
+  }
+  Commitment w;
+  EXPECT_FALSE(reader.ReadFromProof(&w));
+
+  SimpleTranscriptReader<Commitment> verifier_reader = CreateReader(proof);
+  EXPECT_TRUE(pcs_.VerifyOpeningProof(verifier_openings_, &verifier_reader));
+}
+
+}  // namespace tachyon::crypto
@@ -14,11 +14,17 @@
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
+#include "tachyon/base/bits.h"
 #include "tachyon/base/buffer/copyable.h"
 #include "tachyon/base/logging.h"
 #include "tachyon/crypto/commitments/batch_commitment_state.h"
+#include "tachyon/crypto/commitments/kzg/kzg_srs_file.h"
+#include "tachyon/math/elliptic_curves/msm/fixed_base_msm.h"
 #include "tachyon/math/elliptic_curves/msm/variable_base_msm.h"
 #include "tachyon/math/elliptic_curves/point_conversions.h"
+#include "tachyon/math/polynomials/univariate/radix2_evaluation_domain.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluation_domain.h"
 
 namespace tachyon {
@@ -43,11 +49,26 @@ class KZG {
     CHECK_LE(g1_powers_of_tau_.size(), kMaxDegree + 1);
   }
 
-  const std::vector<G1Point>& g1_powers_of_tau() const {
+  // Uses the points mapped by |srs_file| without copying them. The copies of
+  // this share |srs_file|.
+  explicit KZG(std::shared_ptr<const KZGSRSFile<G1Point>> srs_file)
+      : srs_file_(std::move(srs_file)) {
+    CHECK(srs_file_);
+    srs_file_size_ = srs_file_->size();
+    CHECK_LE(srs_file_size_, kMaxDegree + 1);
+  }
+
+  absl::Span<const G1Point> g1_powers_of_tau() const {
+    if (srs_file_) {
+      return srs_file_->g1_powers_of_tau().first(srs_file_size_);
+    }
     return g1_powers_of_tau_;
   }
 
-  const std::vector<G1Point>& g1_powers_of_tau_lagrange() const {
+  absl::Span<const G1Point> g1_powers_of_tau_lagrange() const {
+    if (srs_file_) {
+      return srs_file_->g1_powers_of_tau_lagrange().first(srs_file_size_);
+    }
     return g1_powers_of_tau_lagrange_;
   }
 
@@ -66,41 +87,70 @@ class KZG {
     return batch_commitments;
   }
 
-  size_t N() const { return g1_powers_of_tau_.size(); }
+  size_t N() const { return g1_powers_of_tau().size(); }
 
   [[nodiscard]] bool UnsafeSetup(size_t size) {
     return UnsafeSetup(size, Field::Random());
   }
 
   [[nodiscard]] bool UnsafeSetup(size_t size, const Field& tau) {
-    using G1JacobianPoint = math::JacobianPoint<typename G1Point::Curve>;
     using Domain = math::UnivariateEvaluationDomain<Field, kMaxDegree>;
 
+    // Both SRSs are multiples of g₁, so the tables for g₁ are built once.
+    math::FixedBaseMSM<G1Point> msm(
+        G1Point::Generator(),
+        math::FixedBaseMSM<G1Point>::ComputeWindowBits(2 * size));
+
     // |g1_powers_of_tau_| = [𝜏⁰g₁, 𝜏¹g₁, ... , 𝜏ⁿ⁻¹g₁]
-    G1Point g1 = G1Point::Generator();
     std::vector<Field> powers_of_tau = Field::GetSuccessivePowers(size, tau);
-    std::vector<G1JacobianPoint> g1_powers_of_tau_jacobian;
 
+    srs_file_.reset();
+    srs_file_size_ = 0;
     g1_powers_of_tau_.resize(size);
-    if (!G1Point::BatchMapScalarFieldToPoint(g1, powers_of_tau,
-                                             &g1_powers_of_tau_)) {
-      return false;
-    }
+    if (!msm.Run(powers_of_tau, &g1_powers_of_tau_)) return false;
 
     // Get |g1_powers_of_tau_lagrange_| from 𝜏 and g₁.
     std::unique_ptr<Domain> domain = Domain::Create(size);
     std::vector<Field> lagrange_coeffs =
         domain->EvaluateAllLagrangeCoefficients(tau);
-    std::vector<G1JacobianPoint> g1_powers_of_tau_lagrange_jacobian;
 
     g1_powers_of_tau_lagrange_.resize(size);
-    return G1Point::BatchMapScalarFieldToPoint(g1, lagrange_coeffs,
-                                               &g1_powers_of_tau_lagrange_);
+    return msm.Run(lagrange_coeffs, &g1_powers_of_tau_lagrange_);
+  }
+
+  // Sets up from the powers of 𝜏 produced elsewhere, e.g., by a ceremony,
+  // where 𝜏 is unknown. The lagrange bases are derived by the IFFT over the
+  // points, since Lᵢ(𝜏)g₁ = n⁻¹ * Σⱼ ω⁻ⁱʲ * 𝜏ʲg₁. Returns false if the size of
+  // |g1_powers_of_tau| is not a power of two.
+  [[nodiscard]] bool Setup(std::vector<G1Point>&& g1_powers_of_tau) {
+    using Domain = math::Radix2EvaluationDomain<Field, kMaxDegree>;
+
+    size_t size = g1_powers_of_tau.size();
+    if (!base::bits::IsPowerOfTwo(size) || size > kMaxDegree + 1) {
+      LOG(ERROR) << "Invalid size of powers of tau: " << size;
+      return false;
+    }
+
+    std::unique_ptr<Domain> domain = Domain::Create(size);
+    std::vector<G1Point> g1_powers_of_tau_lagrange(size);
+    if (!domain->IFFTPoints(absl::MakeConstSpan(g1_powers_of_tau),
+                            absl::MakeSpan(g1_powers_of_tau_lagrange))) {
+      return false;
+    }
+    srs_file_.reset();
+    srs_file_size_ = 0;
+    g1_powers_of_tau_ = std::move(g1_powers_of_tau);
+    g1_powers_of_tau_lagrange_ = std::move(g1_powers_of_tau_lagrange);
+    return true;
   }
 
   // Return false if |n| >= |N()|.
   [[nodiscard]] bool Downsize(size_t n) {
     if (n >= N()) return false;
+    if (srs_file_) {
+      srs_file_size_ = n;
+      return true;
+    }
     g1_powers_of_tau_.resize(n);
     g1_powers_of_tau_lagrange_.resize(n);
     return true;
@@ -108,25 +158,25 @@ class KZG {
 
   template <typename ScalarContainer>
   [[nodiscard]] bool Commit(const ScalarContainer& v, Commitment* out) const {
-    return DoMSM(g1_powers_of_tau_, v, out);
+    return DoMSM(g1_powers_of_tau(), v, out);
   }
 
   template <typename ScalarContainer>
   [[nodiscard]] bool Commit(const ScalarContainer& v,
                             BatchCommitmentState& state, size_t index) {
-    return DoMSM(g1_powers_of_tau_, v, state, index);
+    return DoMSM(g1_powers_of_tau(), v, state, index);
   }
 
   template <typename ScalarContainer>
   [[nodiscard]] bool CommitLagrange(const ScalarContainer& v,
                                     Commitment* out) const {
-    return DoMSM(g1_powers_of_tau_lagrange_, v, out);
+    return DoMSM(g1_powers_of_tau_lagrange(), v, out);
   }
 
   template <typename ScalarContainer>
   [[nodiscard]] bool CommitLagrange(const ScalarContainer& v,
                                     BatchCommitmentState& state, size_t index) {
-    return DoMSM(g1_powers_of_tau_lagrange_, v, state, index);
+    return DoMSM(g1_powers_of_tau_lagrange(), v, state, index);
   }
 
  private:
@@ -157,6 +207,10 @@ class KZG {
 
   std::vector<G1Point> g1_powers_of_tau_;
   std::vector<G1Point> g1_powers_of_tau_lagrange_;
+  // If set, the points are read from |srs_file_| instead of the vectors
+  // above.
+  std::shared_ptr<const KZGSRSFile<G1Point>> srs_file_;
+  size_t srs_file_size_ = 0;
   std::vector<Bucket> batch_commitments_;
 };
 
@@ -170,8 +224,8 @@ class Copyable<crypto::KZG<G1Point, MaxDegree, Commitment>> {
   using PCS = crypto::KZG<G1Point, MaxDegree, Commitment>;
 
   static bool WriteTo(const PCS& pcs, Buffer* buffer) {
-    return buffer->WriteMany(pcs.g1_powers_of_tau(),
-                             pcs.g1_powers_of_tau_lagrange());
+    return WritePoints(pcs.g1_powers_of_tau(), buffer) &&
+           WritePoints(pcs.g1_powers_of_tau_lagrange(), buffer);
   }
 
   static bool ReadFrom(const Buffer& buffer, PCS* pcs) {
@@ -187,8 +241,26 @@ class Copyable<crypto::KZG<G1Point, MaxDegree, Commitment>> {
   }
 
   static size_t EstimateSize(const PCS& pcs) {
-    return base::EstimateSize(pcs.g1_powers_of_tau()) +
-           base::EstimateSize(pcs.g1_powers_of_tau_lagrange());
+    return EstimatePointsSize(pcs.g1_powers_of_tau()) +
+           EstimatePointsSize(pcs.g1_powers_of_tau_lagrange());
+  }
+
+ private:
+  // Same as the serialization of |std::vector<G1Point>|.
+  static bool WritePoints(absl::Span<const G1Point> points, Buffer* buffer) {
+    if (!buffer->Write(points.size())) return false;
+    for (const G1Point& point : points) {
+      if (!buffer->Write(point)) return false;
+    }
+    return true;
+  }
+
+  static size_t EstimatePointsSize(absl::Span<const G1Point> points) {
+    size_t size = sizeof(size_t);
+    for (const G1Point& point : points) {
+      size += base::EstimateSize(point);
+    }
+    return size;
   }
 };
 
@@ -0,0 +1,88 @@
+#ifndef TACHYON_CRYPTO_COMMITMENTS_KZG_KZG_PAIRING_ACCUMULATOR_H_
+#define TACHYON_CRYPTO_COMMITMENTS_KZG_KZG_PAIRING_ACCUMULATOR_H_
+
+#include <stddef.h>
+
+#include <array>
+#include <utility>
+#include <vector>
+
+#include "tachyon/base/logging.h"
+#include "tachyon/math/elliptic_curves/msm/variable_base_msm.h"
+#include "tachyon/math/elliptic_curves/pairing/pairing.h"
+
+namespace tachyon::crypto {
+
+// Accumulates the pairing checks of KZG opening proofs, each of which is in
+// the form of
+//
+//   e(Lᵢ, [1]₂) * e(Rᵢ, [-𝜏]₂) ≟ 1
+//
+// so that they are checked at once. Every check is scaled by a random rᵢ,
+//
+//   e(Σᵢ rᵢ * Lᵢ, [1]₂) * e(Σᵢ rᵢ * Rᵢ, [-𝜏]₂) ≟ 1
+//
+// which holds only if every check holds except with a negligible probability.
+// The sums are computed with MSMs, so only a single multi miller loop and a
+// single final exponentiation are needed no matter how many checks there are.
+template <typename Curve>
+class KZGPairingAccumulator {
+ public:
+  using G1Point = typename Curve::G1Curve::AffinePoint;
+  using G1JacobianPoint = math::JacobianPoint<typename G1Point::Curve>;
+  using G2Prepared = typename Curve::G2Prepared;
+  using Field = typename G1Point::ScalarField;
+
+  size_t size() const { return scalars_.size(); }
+  bool empty() const { return scalars_.empty(); }
+
+  // Adds e(|lhs|, [1]₂) * e(|rhs|, [-𝜏]₂) ≟ 1.
+  void Add(const G1JacobianPoint& lhs, const G1Point& rhs) {
+    // NOTE: The first check doesn't need to be scaled since only
+    // the ratios between the scalars matter.
+    scalars_.push_back(scalars_.empty() ? Field::One() : Field::Random());
+    lhs_.push_back(lhs);
+    rhs_.push_back(rhs);
+  }
+
+  void Clear() {
+    scalars_.clear();
+    lhs_.clear();
+    rhs_.clear();
+  }
+
+  // Checks every accumulated check against |g2_arr|, which is
+  // [[1]₂, [-𝜏]₂]. Returns true if nothing is accumulated.
+  [[nodiscard]] bool Check(const std::array<G2Prepared, 2>& g2_arr) const {
+    if (empty()) return true;
+
+    std::array<G1Point, 2> g1_arr;
+    if (size() == 1) {
+      g1_arr = {lhs_[0].ToAffine(), rhs_[0]};
+    } else {
+      std::vector<G1Point> lhs(size());
+      if (!G1JacobianPoint::BatchNormalize(lhs_, &lhs)) return false;
+
+      using Bucket = typename math::VariableBaseMSM<G1Point>::Bucket;
+      math::VariableBaseMSM<G1Point> msm;
+      Bucket lhs_sum;
+      Bucket rhs_sum;
+      if (!msm.Run(lhs, scalars_, &lhs_sum)) return false;
+      if (!msm.Run(rhs_, scalars_, &rhs_sum)) return false;
+      g1_arr = {lhs_sum.ToAffine(), rhs_sum.ToAffine()};
+    }
+    return math::Pairing<Curve>(g1_arr, g2_arr).IsOne();
+  }
+
+ private:
+  // rᵢ
+  std::vector<Field> scalars_;
+  // Lᵢ
+  std::vector<G1JacobianPoint> lhs_;
+  // Rᵢ
+  std::vector<G1Point> rhs_;
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_COMMITMENTS_KZG_KZG_PAIRING_ACCUMULATOR_H_
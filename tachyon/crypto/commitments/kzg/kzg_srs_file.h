@@ -0,0 +1,342 @@
+#ifndef TACHYON_CRYPTO_COMMITMENTS_KZG_KZG_SRS_FILE_H_
+#define TACHYON_CRYPTO_COMMITMENTS_KZG_KZG_SRS_FILE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "absl/crc/crc32c.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/files/file.h"
+#include "tachyon/base/files/file_path.h"
+#include "tachyon/base/files/memory_mapped_file.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+
+namespace tachyon::crypto {
+
+// The header of a KZG SRS file. The file is laid out as follows.
+//
+// clang-format off
+// | header (64 bytes) | checksums | padding | 𝜏ⁱg₁ (n points) | Lᵢ(𝜏)g₁ (n points) |
+// clang-format on
+//
+// The points are stored in the exact in-memory layout, i.e., affine points
+// whose coordinates are in the Montgomery form, and the points start at a
+// page boundary, so the file can be mapped and used without a copy. The
+// checksums are the CRC32C of every |chunk_size| points of each section.
+struct KZGSRSFileHeader {
+  constexpr static char kMagic[8] = {'T', 'C', 'H', 'Y', 'N', 'S', 'R', 'S'};
+  constexpr static uint32_t kVersion = 1;
+  // Written in the native byte order to detect a file of the other one.
+  constexpr static uint32_t kByteOrderMark = 0x01020304;
+
+  char magic[8];
+  uint32_t version;
+  uint32_t byte_order_mark;
+  uint32_t flags;
+  // The size of a point in bytes.
+  uint32_t point_size;
+  // The number of points covered by a checksum.
+  uint32_t chunk_size;
+  uint32_t reserved0;
+  // The number of points in each section.
+  uint64_t size;
+  // The offset of the first point from the beginning of the file.
+  uint64_t data_offset;
+  uint8_t reserved1[16];
+};
+
+static_assert(sizeof(KZGSRSFileHeader) == 64);
+
+// Reads and writes the SRS of |KZG| in the format of |KZGSRSFileHeader|.
+// A file opened by |Open()| is mapped into memory read-only, so several
+// processes opening the same file share the pages in the page cache.
+template <typename G1Point>
+class KZGSRSFile {
+ public:
+  static_assert(std::is_trivially_copyable_v<G1Point>,
+                "Only a trivially copyable point can be mapped");
+
+  enum Flag : uint32_t {
+    // The writer has checked that every point is in the prime order subgroup.
+    kSubgroupChecked = 1 << 0,
+  };
+
+  constexpr static size_t kDefaultChunkSize = size_t{1} << 16;
+
+  struct Options {
+    // Verifies the checksums of the chunks.
+    bool verify_checksums = true;
+    // Checks that every point is on the curve.
+    bool check_on_curve = false;
+    // Checks that every point is in the prime order subgroup. This is much
+    // slower than |check_on_curve|, since a point is multiplied by the order
+    // of the subgroup, and it is needed only if the curve has a cofactor and
+    // the file doesn't have |kSubgroupChecked|.
+    bool check_subgroup = false;
+  };
+
+  size_t size() const { return static_cast<size_t>(header().size); }
+  uint32_t flags() const { return header().flags; }
+
+  absl::Span<const G1Point> g1_powers_of_tau() const {
+    return GetSection(0);
+  }
+
+  absl::Span<const G1Point> g1_powers_of_tau_lagrange() const {
+    return GetSection(1);
+  }
+
+  // Writes |g1_powers_of_tau| and |g1_powers_of_tau_lagrange| to |path|.
+  [[nodiscard]] static bool Write(
+      const base::FilePath& path, absl::Span<const G1Point> g1_powers_of_tau,
+      absl::Span<const G1Point> g1_powers_of_tau_lagrange, uint32_t flags = 0,
+      size_t chunk_size = kDefaultChunkSize) {
+    if (g1_powers_of_tau.size() != g1_powers_of_tau_lagrange.size()) {
+      LOG(ERROR) << "The sizes of the sections don't match";
+      return false;
+    }
+    if (g1_powers_of_tau.empty()) {
+      LOG(ERROR) << "The sections are empty";
+      return false;
+    }
+    if (chunk_size == 0 || chunk_size > UINT32_MAX) {
+      LOG(ERROR) << "Invalid chunk size: " << chunk_size;
+      return false;
+    }
+    size_t size = g1_powers_of_tau.size();
+    size_t num_chunks = GetNumChunks(size, chunk_size);
+
+    KZGSRSFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, KZGSRSFileHeader::kMagic, sizeof(header.magic));
+    header.version = KZGSRSFileHeader::kVersion;
+    header.byte_order_mark = KZGSRSFileHeader::kByteOrderMark;
+    header.flags = flags;
+    header.point_size = sizeof(G1Point);
+    header.chunk_size = static_cast<uint32_t>(chunk_size);
+    header.size = size;
+    header.data_offset = GetDataOffset(num_chunks);
+
+    std::vector<uint32_t> checksums(2 * num_chunks);
+    ComputeChecksums(g1_powers_of_tau, chunk_size,
+                     absl::MakeSpan(checksums).first(num_chunks));
+    ComputeChecksums(g1_powers_of_tau_lagrange, chunk_size,
+                     absl::MakeSpan(checksums).last(num_chunks));
+
+    base::File file(path, base::File::FLAG_CREATE_ALWAYS |
+                              base::File::FLAG_WRITE);
+    if (!file.IsValid()) {
+      LOG(ERROR) << "Failed to create " << path.value();
+      return false;
+    }
+    if (!file.WriteAndCheck(0, AsBytes(absl::MakeConstSpan(&header, 1))) ||
+        !file.WriteAndCheck(sizeof(header),
+                            AsBytes(absl::MakeConstSpan(checksums)))) {
+      LOG(ERROR) << "Failed to write the header";
+      return false;
+    }
+    int64_t offset = static_cast<int64_t>(header.data_offset);
+    for (absl::Span<const G1Point> section :
+         {g1_powers_of_tau, g1_powers_of_tau_lagrange}) {
+      for (size_t i = 0; i < size; i += chunk_size) {
+        absl::Span<const uint8_t> bytes =
+            AsBytes(section.subspan(i, chunk_size));
+        if (!file.WriteAndCheck(offset, bytes)) {
+          LOG(ERROR) << "Failed to write the points";
+          return false;
+        }
+        offset += static_cast<int64_t>(bytes.size());
+      }
+    }
+    // A file without points is still extended to |data_offset|.
+    return file.SetLength(offset);
+  }
+
+  // Maps the file at |path| and validates it according to |options|. Returns
+  // nullptr if the file is invalid.
+  static std::unique_ptr<KZGSRSFile> Open(const base::FilePath& path,
+                                          const Options& options = {}) {
+    std::unique_ptr<KZGSRSFile> ret(new KZGSRSFile);
+    if (!ret->file_.Initialize(path)) {
+      LOG(ERROR) << "Failed to map " << path.value();
+      return nullptr;
+    }
+    if (!ret->CheckHeader()) return nullptr;
+    if (options.verify_checksums && !ret->VerifyChecksums()) return nullptr;
+    if ((options.check_on_curve || options.check_subgroup) &&
+        !ret->CheckPoints(options.check_subgroup)) {
+      return nullptr;
+    }
+    return ret;
+  }
+
+ private:
+  KZGSRSFile() = default;
+
+  const KZGSRSFileHeader& header() const {
+    return *reinterpret_cast<const KZGSRSFileHeader*>(file_.data());
+  }
+
+  absl::Span<const uint32_t> checksums() const {
+    size_t num_chunks = GetNumChunks(size(), header().chunk_size);
+    return absl::Span<const uint32_t>(
+        reinterpret_cast<const uint32_t*>(file_.data() +
+                                          sizeof(KZGSRSFileHeader)),
+        2 * num_chunks);
+  }
+
+  absl::Span<const G1Point> GetSection(size_t section) const {
+    const uint8_t* data = file_.data() + header().data_offset +
+                          section * size() * sizeof(G1Point);
+    return absl::Span<const G1Point>(reinterpret_cast<const G1Point*>(data),
+                                     size());
+  }
+
+  template <typename T>
+  static absl::Span<const uint8_t> AsBytes(absl::Span<const T> values) {
+    return absl::Span<const uint8_t>(
+        reinterpret_cast<const uint8_t*>(values.data()),
+        values.size() * sizeof(T));
+  }
+
+  static size_t GetNumChunks(size_t size, size_t chunk_size) {
+    return (size + chunk_size - 1) / chunk_size;
+  }
+
+  static uint64_t GetDataOffset(size_t num_chunks) {
+    // NOTE: 4096 is a multiple of the page size on most of the
+    // platforms, so the mapped points are aligned to a page.
+    uint64_t size = static_cast<uint64_t>(sizeof(KZGSRSFileHeader) +
+                                          2 * num_chunks * sizeof(uint32_t));
+    return base::bits::AlignUp(size, uint64_t{4096});
+  }
+
+  static uint32_t ComputeChecksum(absl::Span<const G1Point> points) {
+    absl::Span<const uint8_t> bytes = AsBytes(points);
+    return static_cast<uint32_t>(absl::ComputeCrc32c(absl::string_view(
+        reinterpret_cast<const char*>(bytes.data()), bytes.size())));
+  }
+
+  static void ComputeChecksums(absl::Span<const G1Point> points,
+                               size_t chunk_size,
+                               absl::Span<uint32_t> checksums) {
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < checksums.size(); ++i) {
+      checksums[i] =
+          ComputeChecksum(points.subspan(i * chunk_size, chunk_size));
+    }
+  }
+
+  bool CheckHeader() const {
+    if (file_.length() < sizeof(KZGSRSFileHeader)) {
+      LOG(ERROR) << "The file is too short";
+      return false;
+    }
+    const KZGSRSFileHeader& header = this->header();
+    if (memcmp(header.magic, KZGSRSFileHeader::kMagic, sizeof(header.magic)) !=
+        0) {
+      LOG(ERROR) << "Not a KZG SRS file";
+      return false;
+    }
+    if (header.version != KZGSRSFileHeader::kVersion) {
+      LOG(ERROR) << "Unsupported version: " << header.version;
+      return false;
+    }
+    if (header.byte_order_mark != KZGSRSFileHeader::kByteOrderMark) {
+      LOG(ERROR) << "The byte order doesn't match";
+      return false;
+    }
+    if (header.point_size != sizeof(G1Point)) {
+      LOG(ERROR) << "The size of the point doesn't match: "
+                 << header.point_size;
+      return false;
+    }
+    if (header.chunk_size == 0) {
+      LOG(ERROR) << "Invalid chunk size";
+      return false;
+    }
+    if (header.size == 0) {
+      LOG(ERROR) << "The file has no points";
+      return false;
+    }
+    // The size must be checked before it is multiplied below.
+    uint64_t max_size = file_.length() / (2 * sizeof(G1Point));
+    if (header.size > max_size) {
+      LOG(ERROR) << "The file is too short for " << header.size << " points";
+      return false;
+    }
+    size_t num_chunks = GetNumChunks(header.size, header.chunk_size);
+    if (header.data_offset != GetDataOffset(num_chunks) ||
+        header.data_offset + 2 * header.size * sizeof(G1Point) !=
+            file_.length()) {
+      LOG(ERROR) << "The size of the file doesn't match";
+      return false;
+    }
+    return true;
+  }
+
+  bool VerifyChecksums() const {
+    size_t chunk_size = header().chunk_size;
+    absl::Span<const uint32_t> checksums = this->checksums();
+    size_t num_chunks = checksums.size() / 2;
+    std::atomic<bool> valid = true;
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < checksums.size(); ++i) {
+      if (!valid.load(std::memory_order_relaxed)) continue;
+      absl::Span<const G1Point> section = GetSection(i / num_chunks);
+      size_t from = (i % num_chunks) * chunk_size;
+      if (ComputeChecksum(section.subspan(from, chunk_size)) != checksums[i]) {
+        valid.store(false, std::memory_order_relaxed);
+      }
+    }
+    if (!valid.load()) {
+      LOG(ERROR) << "The checksums don't match";
+      return false;
+    }
+    return true;
+  }
+
+  // Checks the points chunk by chunk in parallel.
+  bool CheckPoints(bool check_subgroup) const {
+    using ScalarField = typename G1Point::ScalarField;
+
+    size_t chunk_size = header().chunk_size;
+    size_t num_chunks = GetNumChunks(size(), chunk_size);
+    std::atomic<bool> valid = true;
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < 2 * num_chunks; ++i) {
+      if (!valid.load(std::memory_order_relaxed)) continue;
+      absl::Span<const G1Point> section = GetSection(i / num_chunks);
+      absl::Span<const G1Point> points =
+          section.subspan((i % num_chunks) * chunk_size, chunk_size);
+      for (const G1Point& point : points) {
+        if (!G1Point::Curve::IsOnCurve(point) ||
+            (check_subgroup &&
+             !point.ScalarMul(ScalarField::Config::kModulus).IsZero())) {
+          valid.store(false, std::memory_order_relaxed);
+          break;
+        }
+      }
+    }
+    if (!valid.load()) {
+      LOG(ERROR) << "Invalid point";
+      return false;
+    }
+    return true;
+  }
+
+  base::MemoryMappedFile file_;
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_COMMITMENTS_KZG_KZG_SRS_FILE_H_
@@ -0,0 +1,126 @@
+#include "tachyon/crypto/commitments/kzg/kzg_srs_file.h"
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/files/file.h"
+#include "tachyon/base/files/scoped_temp_dir.h"
+#include "tachyon/crypto/commitments/kzg/kzg.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/polynomials/univariate/univariate_evaluation_domain_factory.h"
+
+namespace tachyon::crypto {
+
+namespace {
+
+constexpr size_t K = 4;
+constexpr size_t N = size_t{1} << K;
+constexpr size_t kMaxDegree = N - 1;
+
+class KZGSRSFileTest : public testing::Test {
+ public:
+  using G1Point = math::bn254::G1AffinePoint;
+  using SRSFile = KZGSRSFile<G1Point>;
+  using PCS = KZG<G1Point, kMaxDegree, G1Point>;
+
+  static void SetUpTestSuite() { math::bn254::G1Curve::Init(); }
+
+  void SetUp() override {
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+    path_ = temp_dir_.GetPath().Append("srs");
+    ASSERT_TRUE(pcs_.UnsafeSetup(N));
+  }
+
+ protected:
+  // Flips a bit of the byte at |offset| of the file.
+  void Corrupt(int64_t offset) {
+    base::File file(path_, base::File::FLAG_OPEN | base::File::FLAG_READ |
+                               base::File::FLAG_WRITE);
+    ASSERT_TRUE(file.IsValid());
+    uint8_t byte;
+    ASSERT_TRUE(file.ReadAndCheck(offset, absl::MakeSpan(&byte, 1)));
+    byte ^= 1;
+    ASSERT_TRUE(file.WriteAndCheck(offset, absl::MakeConstSpan(&byte, 1)));
+  }
+
+  base::ScopedTempDir temp_dir_;
+  base::FilePath path_;
+  PCS pcs_;
+};
+
+}  // namespace
+
+TEST_F(KZGSRSFileTest, WriteAndOpen) {
+  // 16 points are covered by 3 checksums with the last partial chunk.
+  ASSERT_TRUE(SRSFile::Write(path_, pcs_.g1_powers_of_tau(),
+                             pcs_.g1_powers_of_tau_lagrange(),
+                             SRSFile::kSubgroupChecked, 7));
+
+  SRSFile::Options options;
+  options.check_on_curve = true;
+  options.check_subgroup = true;
+  std::unique_ptr<SRSFile> srs_file = SRSFile::Open(path_, options);
+  ASSERT_TRUE(srs_file);
+  EXPECT_EQ(srs_file->size(), N);
+  EXPECT_EQ(srs_file->flags(), uint32_t{SRSFile::kSubgroupChecked});
+  EXPECT_EQ(srs_file->g1_powers_of_tau(), pcs_.g1_powers_of_tau());
+  EXPECT_EQ(srs_file->g1_powers_of_tau_lagrange(),
+            pcs_.g1_powers_of_tau_lagrange());
+  // The points are aligned to a page.
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(srs_file->g1_powers_of_tau().data()) %
+                4096,
+            uintptr_t{0});
+}
+
+TEST_F(KZGSRSFileTest, WriteEmpty) {
+  EXPECT_FALSE(SRSFile::Write(path_, {}, {}));
+}
+
+TEST_F(KZGSRSFileTest, Corrupted) {
+  ASSERT_TRUE(SRSFile::Write(path_, pcs_.g1_powers_of_tau(),
+                             pcs_.g1_powers_of_tau_lagrange()));
+  // Flips a bit of the x coordinate of the second lagrange point.
+  Corrupt(4096 + (N + 1) * sizeof(G1Point));
+  EXPECT_FALSE(SRSFile::Open(path_));
+
+  // Without the checksums, the point is found to be off the curve.
+  SRSFile::Options options;
+  options.verify_checksums = false;
+  EXPECT_TRUE(SRSFile::Open(path_, options));
+  options.check_on_curve = true;
+  EXPECT_FALSE(SRSFile::Open(path_, options));
+
+  // Invalid magic.
+  Corrupt(0);
+  options.check_on_curve = false;
+  EXPECT_FALSE(SRSFile::Open(path_, options));
+}
+
+TEST_F(KZGSRSFileTest, KZG) {
+  ASSERT_TRUE(SRSFile::Write(path_, pcs_.g1_powers_of_tau(),
+                             pcs_.g1_powers_of_tau_lagrange()));
+  std::shared_ptr<const SRSFile> srs_file = SRSFile::Open(path_);
+  ASSERT_TRUE(srs_file);
+  PCS pcs(srs_file);
+  EXPECT_EQ(pcs.N(), N);
+  // No copy is made.
+  EXPECT_EQ(pcs.g1_powers_of_tau().data(),
+            srs_file->g1_powers_of_tau().data());
+
+  std::vector<math::bn254::Fr> scalars =
+      base::CreateVector(N, []() { return math::bn254::Fr::Random(); });
+  G1Point commitment;
+  ASSERT_TRUE(pcs.Commit(scalars, &commitment));
+  G1Point expected_commitment;
+  ASSERT_TRUE(pcs_.Commit(scalars, &expected_commitment));
+  EXPECT_EQ(commitment, expected_commitment);
+
+  ASSERT_TRUE(pcs.Downsize(N / 2));
+  EXPECT_EQ(pcs.N(), N / 2);
+  EXPECT_EQ(pcs.g1_powers_of_tau_lagrange().size(), N / 2);
+}
+
+}  // namespace tachyon::crypto
@@ -36,6 +36,30 @@ TEST_F(KZGTest, UnsafeSetup) {
   EXPECT_EQ(pcs.g1_powers_of_tau_lagrange().size(), size_t{N});
 }
 
+TEST_F(KZGTest, Setup) {
+  // Large enough to pass through the layers outside of the cache blocks.
+  constexpr size_t kLargeMaxDegree = (size_t{1} << 11) - 1;
+  using LargePCS = KZG<math::bn254::G1AffinePoint, kLargeMaxDegree,
+                       math::bn254::G1AffinePoint>;
+
+  for (size_t n : {size_t{1}, N, kLargeMaxDegree + 1}) {
+    LargePCS expected;
+    ASSERT_TRUE(expected.UnsafeSetup(n));
+
+    LargePCS pcs;
+    std::vector<math::bn254::G1AffinePoint> g1_powers_of_tau(
+        expected.g1_powers_of_tau().begin(), expected.g1_powers_of_tau().end());
+    ASSERT_TRUE(pcs.Setup(std::move(g1_powers_of_tau)));
+    EXPECT_EQ(pcs.g1_powers_of_tau(), expected.g1_powers_of_tau());
+    EXPECT_EQ(pcs.g1_powers_of_tau_lagrange(),
+              expected.g1_powers_of_tau_lagrange());
+  }
+
+  PCS pcs;
+  std::vector<math::bn254::G1AffinePoint> g1_powers_of_tau(N - 1);
+  EXPECT_FALSE(pcs.Setup(std::move(g1_powers_of_tau)));
+}
+
 TEST_F(KZGTest, CommitLagrange) {
   PCS pcs;
   ASSERT_TRUE(pcs.UnsafeSetup(N));
@@ -0,0 +1,168 @@
+#ifndef TACHYON_CRYPTO_COMMITMENTS_KZG_MULTI_OPENING_TEST_H_
+#define TACHYON_CRYPTO_COMMITMENTS_KZG_MULTI_OPENING_TEST_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/buffer/buffer.h"
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/crypto/commitments/kzg/kzg.h"
+#include "tachyon/crypto/commitments/kzg/kzg_pairing_accumulator.h"
+#include "tachyon/crypto/commitments/polynomial_openings.h"
+#include "tachyon/crypto/transcripts/simple_transcript.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/bn254.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g2.h"
+#include "tachyon/math/polynomials/univariate/univariate_evaluation_domain_factory.h"
+
+namespace tachyon::crypto {
+
+// A fixture shared by the multi opening schemes of KZG, |PCS|, which opens
+// 5 polynomials at 5 points.
+template <typename PCS>
+class MultiOpeningTest : public testing::Test {
+ public:
+  constexpr static size_t K = 3;
+  constexpr static size_t N = size_t{1} << K;
+  constexpr static size_t kMaxDegree = N - 1;
+
+  using F = typename PCS::Field;
+  using Poly = typename PCS::Poly;
+  using Commitment = typename PCS::Commitment;
+  using Point = typename Poly::Point;
+  using PolyRef = base::DeepRef<const Poly>;
+  using PointRef = base::DeepRef<const Point>;
+  using CommitmentRef = base::DeepRef<const Commitment>;
+
+  static void SetUpTestSuite() { math::bn254::BN254Curve::Init(); }
+
+  MultiOpeningTest() : writer_(base::Uint8VectorBuffer()) {}
+
+  void SetUp() override {
+    KZG<math::bn254::G1AffinePoint, kMaxDegree, math::bn254::G1AffinePoint> kzg;
+    pcs_ = PCS(std::move(kzg));
+    ASSERT_TRUE(pcs_.UnsafeSetup(N));
+    SetUpOpenings(base::CreateVector(
+        5, []() { return Poly::Random(kMaxDegree); }));
+
+    // The challenges of |SimpleTranscript| are zero until something is
+    // written to it.
+    CHECK(writer_.WriteToTranscript(F(1)));
+  }
+
+ protected:
+  void SetUpOpenings(std::vector<Poly>&& polys) {
+    polys_ = std::move(polys);
+    points_ = {F(1), F(2), F(3), F(4), F(5)};
+
+    commitments_.clear();
+    commitments_.reserve(polys_.size());
+    for (const Poly& poly : polys_) {
+      Commitment commitment;
+      CHECK(pcs_.Commit(poly, &commitment));
+      commitments_.push_back(std::move(commitment));
+    }
+
+    prover_openings_.clear();
+    verifier_openings_.clear();
+    // clang-format off
+    // {P₀, [x₀, x₁, x₂]}
+    AddOpening(0, 0); AddOpening(0, 1); AddOpening(0, 2);
+    // {P₁, [x₀, x₁, x₂]}
+    AddOpening(1, 0); AddOpening(1, 1); AddOpening(1, 2);
+    // {P₂, [x₀, x₁, x₂]}
+    AddOpening(2, 0); AddOpening(2, 1); AddOpening(2, 2);
+    // {P₃, [x₂, x₃]}
+    AddOpening(3, 2); AddOpening(3, 3);
+    // {P₄, [x₃, x₄]}
+    AddOpening(4, 3); AddOpening(4, 4);
+    // clang-format on
+  }
+
+  void AddOpening(size_t poly_idx, size_t point_idx) {
+    F opening = polys_[poly_idx].Evaluate(points_[point_idx]);
+    prover_openings_.emplace_back(PolyRef(&polys_[poly_idx]),
+                                  PointRef(&points_[point_idx]), opening);
+    verifier_openings_.emplace_back(CommitmentRef(&commitments_[poly_idx]),
+                                    PointRef(&points_[point_idx]), opening);
+  }
+
+  // Returns a reader of |proof| whose transcript starts with |seed| like
+  // |writer_|.
+  static SimpleTranscriptReader<Commitment> CreateReader(
+      std::vector<uint8_t>& proof, const F& seed = F(1)) {
+    SimpleTranscriptReader<Commitment> reader(
+        base::Buffer(proof.data(), proof.size()));
+    CHECK(reader.WriteToTranscript(seed));
+    return reader;
+  }
+
+  // Creates a proof per transcript and checks them all with a single
+  // |KZGPairingAccumulator|.
+  void TestBatchVerifyProofs() {
+    constexpr size_t kNumProofs = 3;
+
+    // Every proof is created from a different transcript so that each has
+    // its own challenges.
+    std::vector<std::vector<uint8_t>> proofs;
+    for (size_t i = 0; i < kNumProofs; ++i) {
+      SimpleTranscriptWriter<Commitment> writer((base::Uint8VectorBuffer()));
+      ASSERT_TRUE(writer.WriteToTranscript(F(i + 1)));
+      ASSERT_TRUE(pcs_.CreateOpeningProof(prover_openings_, &writer));
+      proofs.push_back(writer.buffer().owned_buffer());
+    }
+
+    auto accumulate = [this, &proofs](
+                          size_t i, size_t proof_idx,
+                          KZGPairingAccumulator<math::bn254::BN254Curve>*
+                              accumulator) {
+      SimpleTranscriptReader<Commitment> reader =
+          CreateReader(proofs[proof_idx], F(i + 1));
+      return pcs_.AccumulateOpeningProof(verifier_openings_, &reader,
+                                         accumulator);
+    };
+
+    KZGPairingAccumulator<math::bn254::BN254Curve> accumulator;
+    EXPECT_TRUE(pcs_.VerifyAccumulator(accumulator));
+    for (size_t i = 0; i < kNumProofs; ++i) {
+      ASSERT_TRUE(accumulate(i, i, &accumulator));
+    }
+    EXPECT_EQ(accumulator.size(), kNumProofs);
+    EXPECT_TRUE(pcs_.VerifyAccumulator(accumulator));
+
+    // A proof read with a wrong transcript fails the whole batch.
+    ASSERT_TRUE(accumulate(1, 0, &accumulator));
+    EXPECT_FALSE(pcs_.VerifyAccumulator(accumulator));
+  }
+
+  // Checks that the proof fails to verify if one of its bytes is flipped.
+  void TestVerifyTamperedProof() {
+    ASSERT_TRUE(pcs_.CreateOpeningProof(prover_openings_, &writer_));
+    std::vector<uint8_t> proof = writer_.buffer().owned_buffer();
+
+    for (size_t i : {size_t{0}, proof.size() / 2, proof.size() - 1}) {
+      SCOPED_TRACE(i);
+      std::vector<uint8_t> tampered_proof = proof;
+      tampered_proof[i] ^= 1;
+      SimpleTranscriptReader<Commitment> reader = CreateReader(tampered_proof);
+      EXPECT_FALSE(pcs_.VerifyOpeningProof(verifier_openings_, &reader));
+    }
+  }
+
+  PCS pcs_;
+  std::vector<Poly> polys_;
+  std::vector<F> points_;
+  std::vector<Commitment> commitments_;
+  std::vector<PolynomialOpening<Poly>> prover_openings_;
+  std::vector<PolynomialOpening<Poly, Commitment>> verifier_openings_;
+  SimpleTranscriptWriter<Commitment> writer_;
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_COMMITMENTS_KZG_MULTI_OPENING_TEST_H_
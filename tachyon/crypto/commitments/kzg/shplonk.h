@@ -11,7 +11,11 @@
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
 #include "tachyon/crypto/commitments/kzg/kzg_family.h"
+#include "tachyon/crypto/commitments/kzg/kzg_pairing_accumulator.h"
 #include "tachyon/crypto/commitments/polynomial_openings.h"
 #include "tachyon/crypto/commitments/univariate_polynomial_commitment_scheme.h"
 #include "tachyon/crypto/transcripts/transcript.h"
@@ -61,159 +65,25 @@ class SHPlonk final : public UnivariatePolynomialCommitmentScheme<
     return this->kzg_.GetBatchCommitments(this->batch_commitment_state_);
   }
 
- private:
-  friend class VectorCommitmentScheme<SHPlonk<Curve, MaxDegree, Commitment>>;
-  friend class UnivariatePolynomialCommitmentScheme<
-      SHPlonk<Curve, MaxDegree, Commitment>>;
-  template <typename, size_t, size_t, typename>
-  friend class zk::SHPlonkExtension;
-
-  const std::vector<G1Point>& GetG1PowersOfTau() const {
-    return this->kzg_.g1_powers_of_tau();
-  }
-
-  const std::vector<G1Point>& GetG1PowersOfTauLagrange() const {
-    return this->kzg_.g1_powers_of_tau_lagrange();
-  }
+  // Returns [[1]₂, [-𝜏]₂], whose line coefficients are computed once when
+  // they are set, so that every pairing check reuses them.
+  const std::array<G2Prepared, 2>& g2_arr() const { return g2_arr_; }
 
-  // UnivariatePolynomialCommitmentScheme methods
-  template <typename Container>
-  [[nodiscard]] bool DoCreateOpeningProof(
-      const Container& poly_openings,
-      TranscriptWriter<Commitment>* writer) const {
-    PolynomialOpeningGrouper<Poly> grouper;
-    grouper.GroupByPolyOracleAndPoints(poly_openings);
-
-    // Group |poly_openings| to |grouped_poly_openings_vec|.
-    // {[P₀, P₁, P₂], [x₀, x₁, x₂]}
-    // {[P₃], [x₂, x₃]}
-    // {[P₄], [x₄]}
-    const std::vector<GroupedPolynomialOpenings<Poly>>&
-        grouped_poly_openings_vec = grouper.grouped_poly_openings_vec();
-    const absl::btree_set<PointDeepRef>& super_point_set =
-        grouper.super_point_set();
-
-    Field y = writer->SqueezeChallenge();
-
-    // Create [H₀(X), H₁(X), H₂(X)].
-    // clang-format off
-    // H₀(X) = ((P₀(X) - R₀(X)) + y(P₁(X) - R₁(X)) + y²(P₂(X) - R₂(X))) / (X - x₀)(X - x₁)(X - x₂)
-    // H₁(X) = ((P₃(X) - R₃(X)) / (X - x₂)(X - x₃)
-    // H₂(X) = ((P₄(X) - R₄(X)) / (X - x₄)
-    // clang-format on
-    std::vector<std::vector<Poly>> low_degree_extensions_vec;
-    low_degree_extensions_vec.resize(grouped_poly_openings_vec.size());
-    std::vector<Poly> h_polys = base::Map(
-        grouped_poly_openings_vec,
-        [&y, &low_degree_extensions_vec](
-            size_t i,
-            const GroupedPolynomialOpenings<Poly>& grouped_poly_openings) {
-          return grouped_poly_openings.CreateCombinedLowDegreeExtensions(
-              y, low_degree_extensions_vec[i]);
-        });
-
-    Field v = writer->SqueezeChallenge();
-
-    // Create a linear combination of polynomials [H₀(X), H₁(X), H₂(X)] with
-    // with |v|.
-    // H(X) = H₀(X) + vH₁(X) + v²H₂(X)
-    Poly& h_poly =
-        Poly::template LinearCombinationInPlace</*forward=*/false>(h_polys, v);
-
-    // Commit H(X)
-    Commitment h;
-    if (!this->Commit(h_poly, &h)) return false;
-
-    if (!writer->WriteToProof(h)) return false;
-    Field u = writer->SqueezeChallenge();
-
-    // Create [L₀(X), L₁(X), L₂(X)].
-    // clang-format off
-    // L₀(X) = Zᴛ\₀(u) * ((P₀(X) - R₀(u)) + y(P₁(X) - R₁(u)) + y²(P₂(X) - R₂(u)))
-    // L₁(X) = Zᴛ\₁(u) * (P₃(X) - R₃(u))
-    // L₂(X) = Zᴛ\₂(u) * (P₄(X) - R₄(u))
-    // clang-format on
-    Field first_z_diff;
-    std::vector<Poly> l_polys = base::Map(
-        grouped_poly_openings_vec,
-        [&y, &u, &first_z_diff, &low_degree_extensions_vec, &super_point_set](
-            size_t i,
-            const GroupedPolynomialOpenings<Poly>& grouped_poly_openings) {
-          absl::btree_set<PointDeepRef> diffs = super_point_set;
-          for (PointDeepRef point_ref : grouped_poly_openings.point_refs) {
-            diffs.erase(point_ref);
-          }
-
-          std::vector<Point> diffs_vec = base::Map(
-              diffs, [](PointDeepRef point_ref) { return *point_ref; });
-          // calculate difference vanishing polynomial evaluation
-          // |z_diff₀| = Zᴛ\₀(u) = (u - x₃)(u - x₄)
-          // |z_diff₁| = Zᴛ\₁(u) = (u - x₀)(u - x₁)(u - x₄)
-          // |z_diff₂| = Zᴛ\₂(u) = (u - x₀)(u - x₁)(u - x₂)(u - x₃)
-          Field z_diff = Poly::EvaluateVanishingPolyByRoots(diffs_vec, u);
-          if (i == 0) {
-            first_z_diff = z_diff;
-          }
-
-          const std::vector<Poly>& low_degree_extensions =
-              low_degree_extensions_vec[i];
-          std::vector<Poly> polys = base::Map(
-              grouped_poly_openings.poly_openings_vec,
-              [&u, &low_degree_extensions](
-                  size_t i, const PolynomialOpenings<Poly>& poly_openings) {
-                Poly poly = *poly_openings.poly_oracle;
-                *poly[0] -= low_degree_extensions[i].Evaluate(u);
-                return poly;
-              });
-
-          // clang-format off
-          // L₀(X) = (P₀(X) - R₀(u)) + y(P₁(X) - R₁(u)) + y²(P₂(X) - R₂(u))) * Zᴛ\₀(u)
-          // L₁(X) = (P₃(X) - R₃(u)) * Zᴛ\₁(u)
-          // L₂(X) = (P₄(X) - R₄(u)) * Zᴛ\₂(u)
-          // clang-format on
-          Poly& l = Poly::template LinearCombinationInPlace</*forward=*/false>(
-              polys, y);
-          return l *= z_diff;
-        });
-
-    // Create a linear combination of polynomials [L₀(X), L₁(X), L₂(X)] with
-    // |v|.
-    // L(X) = L₀(X) + vL₁(X) + v²L₂(X)
-    Poly& l_poly =
-        Poly::template LinearCombinationInPlace</*forward=*/false>(l_polys, v);
-
-    // Zᴛ = [x₀, x₁, x₂, x₃, x₄]
-    std::vector<Field> z_t =
-        base::Map(super_point_set, [](const PointDeepRef& p) { return *p; });
-    // Zᴛ(X) = (X - x₀)(X - x₁)(X - x₂)(X - x₃)(X - x₄)
-    // Zᴛ(u) = (u - x₀)(u - x₁)(u - x₂)(u - x₃)(u - x₄)
-    Field zt_eval = Poly::EvaluateVanishingPolyByRoots(z_t, u);
-
-    // L(X) = L₀(X) + vL₁(X) + v²L₂(X) - Zᴛ(u) * H(X)
-    h_poly *= zt_eval;
-    l_poly -= h_poly;
-
-    // L(X) should be zero in X = |u|
-    DCHECK(l_poly.Evaluate(u).IsZero());
-
-    // Q(X) = L(X) / (X - u)
-    Poly vanishing_poly = Poly::FromRoots(std::vector<Field>({u}));
-    Poly& q_poly = l_poly /= vanishing_poly;
-
-    // Normalize
-    // Q(X) = L(X) / ((X - u) * Zᴛ\₀(u))
-    q_poly /= first_z_diff;
-
-    // Commit Q(X)
-    Commitment q;
-    if (!this->Commit(q_poly, &q)) return false;
-    return writer->WriteToProof(q);
+  // Prepares [[1]₂, [-𝜏]₂] from |tau_g2| = [𝜏]₂. This needs to be called
+  // when the SRS is loaded instead of being created by |UnsafeSetup()|.
+  void SetTauG2(const G2Point& tau_g2) {
+    g2_arr_ = {G2Prepared::From(G2Point::Generator()),
+               G2Prepared::From(-tau_g2)};
   }
 
+  // Reads the opening proof of |poly_openings| from |reader| and adds its
+  // pairing check to |accumulator| instead of checking it, so that the proofs
+  // of many openings are checked at once by |VerifyAccumulator()|. Returns
+  // false if the proof can't be read.
   template <typename Container>
-  [[nodiscard]] bool DoVerifyOpeningProof(
-      const Container& poly_openings,
-      TranscriptReader<Commitment>* reader) const {
+  [[nodiscard]] bool AccumulateOpeningProof(
+      const Container& poly_openings, TranscriptReader<Commitment>* reader,
+      KZGPairingAccumulator<Curve>* accumulator) const {
     using G1JacobianPoint = math::JacobianPoint<typename G1Point::Curve>;
 
     Field y = reader->SqueezeChallenge();
@@ -340,15 +210,191 @@ class SHPlonk final : public UnivariatePolynomialCommitmentScheme<
     // (L₀(𝜏) + v * L₁(𝜏) + v² * L₂(𝜏) - Zᴛ(u) * H(𝜏)) / Zᴛ\₀(u) ≟ (𝜏 - u) * Q(𝜏)
     // L(𝜏) ≟ (𝜏 - u) * Q(𝜏) * Zᴛ\₀(u)
     // clang-format on
-    G1Point g1_arr[] = {p.ToAffine(), std::move(q)};
-    return math::Pairing<Curve>(g1_arr, g2_arr_).IsOne();
+    accumulator->Add(p, q);
+    return true;
+  }
+
+  // Returns true if all the checks accumulated by |AccumulateOpeningProof()|
+  // hold.
+  [[nodiscard]] bool VerifyAccumulator(
+      const KZGPairingAccumulator<Curve>& accumulator) const {
+    return accumulator.Check(g2_arr_);
+  }
+
+ private:
+  friend class VectorCommitmentScheme<SHPlonk<Curve, MaxDegree, Commitment>>;
+  friend class UnivariatePolynomialCommitmentScheme<
+      SHPlonk<Curve, MaxDegree, Commitment>>;
+  template <typename, size_t, size_t, typename>
+  friend class zk::SHPlonkExtension;
+
+  absl::Span<const G1Point> GetG1PowersOfTau() const {
+    return this->kzg_.g1_powers_of_tau();
+  }
+
+  absl::Span<const G1Point> GetG1PowersOfTauLagrange() const {
+    return this->kzg_.g1_powers_of_tau_lagrange();
+  }
+
+  // UnivariatePolynomialCommitmentScheme methods
+  template <typename Container>
+  [[nodiscard]] bool DoCreateOpeningProof(
+      const Container& poly_openings,
+      TranscriptWriter<Commitment>* writer) const {
+    PolynomialOpeningGrouper<Poly> grouper;
+    grouper.GroupByPolyOracleAndPoints(poly_openings);
+
+    // Group |poly_openings| to |grouped_poly_openings_vec|.
+    // {[P₀, P₁, P₂], [x₀, x₁, x₂]}
+    // {[P₃], [x₂, x₃]}
+    // {[P₄], [x₄]}
+    const std::vector<GroupedPolynomialOpenings<Poly>>&
+        grouped_poly_openings_vec = grouper.grouped_poly_openings_vec();
+    const absl::btree_set<PointDeepRef>& super_point_set =
+        grouper.super_point_set();
+
+    Field y = writer->SqueezeChallenge();
+
+    // Create [H₀(X), H₁(X), H₂(X)].
+    // clang-format off
+    // H₀(X) = ((P₀(X) - R₀(X)) + y(P₁(X) - R₁(X)) + y²(P₂(X) - R₂(X))) / (X - x₀)(X - x₁)(X - x₂)
+    // H₁(X) = ((P₃(X) - R₃(X)) / (X - x₂)(X - x₃)
+    // H₂(X) = ((P₄(X) - R₄(X)) / (X - x₄)
+    // clang-format on
+    std::vector<std::vector<Poly>> low_degree_extensions_vec;
+    low_degree_extensions_vec.resize(grouped_poly_openings_vec.size());
+    std::vector<Poly> h_polys = base::Map(
+        grouped_poly_openings_vec,
+        [&y, &low_degree_extensions_vec](
+            size_t i,
+            const GroupedPolynomialOpenings<Poly>& grouped_poly_openings) {
+          return grouped_poly_openings.CreateCombinedLowDegreeExtensions(
+              y, low_degree_extensions_vec[i]);
+        });
+
+    Field v = writer->SqueezeChallenge();
+    std::vector<Field> v_powers =
+        Field::GetSuccessivePowers(grouped_poly_openings_vec.size(), v);
+
+    // Create a linear combination of polynomials [H₀(X), H₁(X), H₂(X)] with
+    // with |v|.
+    // H(X) = H₀(X) + vH₁(X) + v²H₂(X)
+    Poly h_poly = Poly::WeightedSum(
+        base::Map(h_polys, [](const Poly& poly) { return &poly; }), v_powers);
+
+    // Commit H(X)
+    Commitment h;
+    if (!this->Commit(h_poly, &h)) return false;
+
+    if (!writer->WriteToProof(h)) return false;
+    Field u = writer->SqueezeChallenge();
+
+    // Create [L₀(X), L₁(X), L₂(X)].
+    // clang-format off
+    // L₀(X) = Zᴛ\₀(u) * ((P₀(X) - R₀(u)) + y(P₁(X) - R₁(u)) + y²(P₂(X) - R₂(u)))
+    // L₁(X) = Zᴛ\₁(u) * (P₃(X) - R₃(u))
+    // L₂(X) = Zᴛ\₂(u) * (P₄(X) - R₄(u))
+    // clang-format on
+    // Rather than creating them, every Pᵢ(X) is collected with its scalar, so
+    // that L(X) is created in a single pass below. Since Rᵢ(u) are constants,
+    // they only affect the constant term.
+    std::vector<const Poly*> l_polys;
+    std::vector<Field> l_scalars;
+    Field l_constant = Field::Zero();
+    Field first_z_diff;
+    for (size_t i = 0; i < grouped_poly_openings_vec.size(); ++i) {
+      const GroupedPolynomialOpenings<Poly>& grouped_poly_openings =
+          grouped_poly_openings_vec[i];
+      absl::btree_set<PointDeepRef> diffs = super_point_set;
+      for (PointDeepRef point_ref : grouped_poly_openings.point_refs) {
+        diffs.erase(point_ref);
+      }
+
+      std::vector<Point> diffs_vec =
+          base::Map(diffs, [](PointDeepRef point_ref) { return *point_ref; });
+      // calculate difference vanishing polynomial evaluation
+      // |z_diff₀| = Zᴛ\₀(u) = (u - x₃)(u - x₄)
+      // |z_diff₁| = Zᴛ\₁(u) = (u - x₀)(u - x₁)(u - x₄)
+      // |z_diff₂| = Zᴛ\₂(u) = (u - x₀)(u - x₁)(u - x₂)(u - x₃)
+      Field z_diff = Poly::EvaluateVanishingPolyByRoots(diffs_vec, u);
+      if (i == 0) {
+        first_z_diff = z_diff;
+      }
+
+      // The scalar of Pⱼ(X) in the i-th group is vⁱ * Zᴛ\ᵢ(u) * yʲ.
+      Field scalar = v_powers[i] * z_diff;
+      const std::vector<Poly>& low_degree_extensions =
+          low_degree_extensions_vec[i];
+      for (size_t j = 0; j < grouped_poly_openings.poly_openings_vec.size();
+           ++j) {
+        l_polys.push_back(
+            grouped_poly_openings.poly_openings_vec[j].poly_oracle.get());
+        l_constant += scalar * low_degree_extensions[j].Evaluate(u);
+        l_scalars.push_back(scalar);
+        scalar *= y;
+      }
+    }
+
+    // Zᴛ = [x₀, x₁, x₂, x₃, x₄]
+    std::vector<Field> z_t =
+        base::Map(super_point_set, [](const PointDeepRef& p) { return *p; });
+    // Zᴛ(X) = (X - x₀)(X - x₁)(X - x₂)(X - x₃)(X - x₄)
+    // Zᴛ(u) = (u - x₀)(u - x₁)(u - x₂)(u - x₃)(u - x₄)
+    Field zt_eval = Poly::EvaluateVanishingPolyByRoots(z_t, u);
+    l_polys.push_back(&h_poly);
+    l_scalars.push_back(-zt_eval);
+
+    // Normalize the scalars by Zᴛ\₀(u) in advance, so that the division of
+    // Q(X) below is skipped.
+    Field first_z_diff_inv = first_z_diff.Inverse();
+    for (Field& l_scalar : l_scalars) {
+      l_scalar *= first_z_diff_inv;
+    }
+    l_constant *= first_z_diff_inv;
+
+    // clang-format off
+    // L(X) = (L₀(X) + vL₁(X) + v²L₂(X) - Zᴛ(u) * H(X)) / Zᴛ\₀(u)
+    // clang-format on
+    Poly l_poly = Poly::WeightedSum(l_polys, l_scalars);
+    if (!l_constant.IsZero()) {
+      // If every weighted sum cancels, L(X) is zero and has no constant
+      // term. Then L(u) = -|l_constant| ≠ 0, which means the openings are
+      // wrong.
+      Field* constant = l_poly[0];
+      if (constant == nullptr) {
+        LOG(ERROR) << "L(X) doesn't vanish at u";
+        return false;
+      }
+      *constant -= l_constant;
+    }
+
+    // L(X) should be zero in X = |u|
+    DCHECK(l_poly.Evaluate(u).IsZero());
+
+    // Q(X) = L(X) / (X - u)
+    Poly& q_poly = l_poly.DivByVanishingPolyInPlace(std::vector<Field>({u}));
+
+    // Commit Q(X)
+    Commitment q;
+    if (!this->Commit(q_poly, &q)) return false;
+    return writer->WriteToProof(q);
+  }
+
+  template <typename Container>
+  [[nodiscard]] bool DoVerifyOpeningProof(
+      const Container& poly_openings,
+      TranscriptReader<Commitment>* reader) const {
+    KZGPairingAccumulator<Curve> accumulator;
+    if (!AccumulateOpeningProof(poly_openings, reader, &accumulator)) {
+      return false;
+    }
+    return VerifyAccumulator(accumulator);
   }
 
   // KZGFamily methods
   [[nodiscard]] bool DoUnsafeSetupWithTau(size_t size,
                                           const Field& tau) override {
-    g2_arr_ = {G2Prepared::From(G2Point::Generator()),
-               G2Prepared::From((G2Point::Generator() * -tau).ToAffine())};
+    SetTauG2((G2Point::Generator() * tau).ToAffine());
     return true;
   }
 
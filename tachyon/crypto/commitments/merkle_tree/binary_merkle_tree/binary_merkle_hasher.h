@@ -4,6 +4,12 @@
 #ifndef TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_BINARY_MERKLE_HASHER_H_
 #define TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_BINARY_MERKLE_HASHER_H_
 
+#include <stddef.h>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+
 namespace tachyon::crypto {
 
 template <typename Leaf, typename Hash>
@@ -14,6 +20,28 @@ class BinaryMerkleHasher {
   virtual Hash ComputeLeafHash(const Leaf& leaf) const = 0;
 
   virtual Hash ComputeParentHash(const Hash& left, const Hash& right) const = 0;
+
+  // Computes the hashes of |leaves| into |hashes|. Override this if hashing
+  // many leaves at once is faster than hashing them one by one.
+  virtual void ComputeLeafHashes(absl::Span<const Leaf> leaves,
+                                 absl::Span<Hash> hashes) const {
+    DCHECK_EQ(leaves.size(), hashes.size());
+    for (size_t i = 0; i < leaves.size(); ++i) {
+      hashes[i] = ComputeLeafHash(leaves[i]);
+    }
+  }
+
+  // Computes the hashes of the parents into |parents|, where
+  // |children[2 * i]| and |children[2 * i + 1]| are the left and the right
+  // child of |parents[i]|. Override this if hashing many nodes at once is
+  // faster than hashing them one by one.
+  virtual void ComputeParentHashes(absl::Span<const Hash> children,
+                                   absl::Span<Hash> parents) const {
+    DCHECK_EQ(children.size(), 2 * parents.size());
+    for (size_t i = 0; i < parents.size(); ++i) {
+      parents[i] = ComputeParentHash(children[2 * i], children[2 * i + 1]);
+    }
+  }
 };
 
 }  // namespace tachyon::crypto
@@ -4,6 +4,8 @@
 #ifndef TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_BINARY_MERKLE_PROOF_H_
 #define TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_BINARY_MERKLE_PROOF_H_
 
+#include <stddef.h>
+
 #include <vector>
 
 namespace tachyon::crypto {
@@ -33,6 +35,32 @@ struct BinaryMerkleProof {
   }
 };
 
+// A proof that opens several leaves at once. |siblings| only contains the
+// nodes that can't be computed from the opened leaves, from the bottom level to
+// the top and from left to right within a level. So the nodes shared by the
+// paths of the leaves appear once.
+template <typename Hash>
+struct BinaryMerkleMultiProof {
+  std::vector<Hash> siblings;
+
+  bool operator==(const BinaryMerkleMultiProof& other) const {
+    return siblings == other.siblings;
+  }
+  bool operator!=(const BinaryMerkleMultiProof& other) const {
+    return siblings != other.siblings;
+  }
+};
+
+// The leaves opened by a |BinaryMerkleMultiProof|. |leaf_hashes[i]| is the
+// hash of the leaf at |indices[i]|. |indices| may be unsorted and contain
+// duplicates.
+template <typename Hash>
+struct BinaryMerkleMultiOpening {
+  size_t leaves_size = 0;
+  std::vector<size_t> indices;
+  std::vector<Hash> leaf_hashes;
+};
+
 }  // namespace tachyon::crypto
 
 #endif  // TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_BINARY_MERKLE_PROOF_H_
@@ -5,9 +5,11 @@
 #define TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_BINARY_MERKLE_TREE_H_
 
 #include <algorithm>
+#include <numeric>
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
 #include "gtest/gtest_prod.h"
 
 #include "tachyon/base/bits.h"
@@ -27,6 +29,8 @@ class BinaryMerkleTree final
     : public VectorCommitmentScheme<BinaryMerkleTree<Leaf, Hash, MaxSize>> {
  public:
   constexpr static size_t kDefaultLeavesSizeForParallelization = 1024;
+  // The number of hashes passed to |BinaryMerkleHasher| at once.
+  constexpr static size_t kHashBatchSize = 256;
 
   BinaryMerkleTree() = default;
   BinaryMerkleTree(BinaryMerkleTreeStorage<Hash>* storage,
@@ -42,6 +46,71 @@ class BinaryMerkleTree final
     leaves_size_for_parallelization_ = leaves_size_for_parallelization;
   }
 
+  // Replaces the leaf at |index| of the committed tree with |leaf| and
+  // rehashes only the nodes on its path. |root| is populated with the new
+  // root.
+  [[nodiscard]] bool UpdateLeaf(size_t index, const Leaf& leaf,
+                                Hash* root) const {
+    return UpdateLeaves({{index, leaf}}, root);
+  }
+
+  // Replaces the leaves of the committed tree at the given indices. The nodes
+  // on the paths are rehashed level by level and a node shared by several
+  // paths is hashed once. If an index appears several times, the last leaf
+  // wins.
+  [[nodiscard]] bool UpdateLeaves(
+      const std::vector<std::pair<size_t, Leaf>>& leaves, Hash* root) const {
+    size_t size = storage_->GetSize();
+    if (size == 0) {
+      LOG(ERROR) << "Nothing is committed";
+      return false;
+    }
+    size_t leaves_size = (size + 1) >> 1;
+    std::vector<size_t> order(leaves.size());
+    std::iota(order.begin(), order.end(), 0);
+    // NOTE: |std::stable_sort()| keeps the updates of the same
+    // index in order, so the last one is taken below.
+    std::stable_sort(order.begin(), order.end(),
+                     [&leaves](size_t a, size_t b) {
+                       return leaves[a].first < leaves[b].first;
+                     });
+    std::vector<size_t> nodes;
+    std::vector<Leaf> new_leaves;
+    nodes.reserve(order.size());
+    new_leaves.reserve(order.size());
+    for (size_t i : order) {
+      size_t index = leaves[i].first;
+      if (index >= leaves_size) {
+        LOG(ERROR) << "Index is out of range: " << index;
+        return false;
+      }
+      size_t node = leaves_size - 1 + index;
+      if (!nodes.empty() && nodes.back() == node) {
+        new_leaves.back() = leaves[i].second;
+      } else {
+        nodes.push_back(node);
+        new_leaves.push_back(leaves[i].second);
+      }
+    }
+
+    std::vector<Hash> hashes(nodes.size());
+    hasher_->ComputeLeafHashes(new_leaves, absl::MakeSpan(hashes));
+    for (size_t i = 0; i < nodes.size(); ++i) {
+      storage_->SetHash(nodes[i], hashes[i]);
+    }
+    while (!nodes.empty() && nodes[0] != 0) {
+      // The parents of the sorted nodes are sorted as well, so the duplicates
+      // are next to each other.
+      for (size_t& node : nodes) {
+        node = (node - 1) >> 1;
+      }
+      nodes.erase(std::unique(nodes.begin(), nodes.end()), nodes.end());
+      UpdateParents(nodes);
+    }
+    *root = storage_->GetHash(0);
+    return true;
+  }
+
  private:
   FRIEND_TEST(BinaryMerkleTreeTest, FillLeaves);
   FRIEND_TEST(BinaryMerkleTreeTest, BuildTreeFromLeaves);
@@ -120,6 +189,166 @@ class BinaryMerkleTree final
     return hash == root;
   }
 
+  // Creates a proof for the leaves at |indices| at once. A sibling is added to
+  // the proof only if it can't be computed from the opened leaves, so the
+  // nodes shared by the paths are added once.
+  [[nodiscard]] bool DoCreateOpeningProof(
+      const std::vector<size_t>& indices,
+      BinaryMerkleMultiProof<Hash>* proof) const {
+    size_t width = (storage_->GetSize() + 1) >> 1;
+    std::vector<size_t> positions = indices;
+    std::sort(positions.begin(), positions.end());
+    positions.erase(std::unique(positions.begin(), positions.end()),
+                    positions.end());
+    if (positions.empty()) {
+      LOG(ERROR) << "No indices";
+      return false;
+    }
+    if (positions.back() >= width) {
+      LOG(ERROR) << "Index is out of range: " << positions.back();
+      return false;
+    }
+
+    proof->siblings.clear();
+    while (width > 1) {
+      size_t num_parents = 0;
+      for (size_t i = 0; i < positions.size(); ++i) {
+        size_t position = positions[i];
+        if (HasRightSibling(positions, i)) {
+          ++i;
+        } else {
+          proof->siblings.push_back(
+              storage_->GetHash(width - 1 + (position ^ 1)));
+        }
+        positions[num_parents++] = position >> 1;
+      }
+      positions.resize(num_parents);
+      width >>= 1;
+    }
+    return true;
+  }
+
+  // Recomputes the nodes on the paths of the opened leaves level by level.
+  // Each node is computed once even if it is shared by several paths, and the
+  // nodes of a level are hashed at once.
+  [[nodiscard]] bool DoVerifyOpeningProof(
+      const Hash& root, const BinaryMerkleMultiOpening<Hash>& opening,
+      const BinaryMerkleMultiProof<Hash>& proof) const {
+    if (opening.indices.size() != opening.leaf_hashes.size()) {
+      LOG(ERROR) << "The number of the leaf hashes doesn't match";
+      return false;
+    }
+    if (opening.indices.empty()) {
+      LOG(ERROR) << "No indices";
+      return false;
+    }
+    if (!base::bits::IsPowerOfTwo(opening.leaves_size)) {
+      LOG(ERROR) << opening.leaves_size << " is not a power of two";
+      return false;
+    }
+
+    std::vector<size_t> order(opening.indices.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&opening](size_t a, size_t b) {
+      return opening.indices[a] < opening.indices[b];
+    });
+    std::vector<size_t> positions;
+    std::vector<Hash> hashes;
+    positions.reserve(order.size());
+    hashes.reserve(order.size());
+    for (size_t i : order) {
+      size_t position = opening.indices[i];
+      const Hash& leaf_hash = opening.leaf_hashes[i];
+      if (!positions.empty() && positions.back() == position) {
+        if (hashes.back() != leaf_hash) {
+          LOG(ERROR) << "Different leaf hashes at the same index: "
+                     << position;
+          return false;
+        }
+        continue;
+      }
+      positions.push_back(position);
+      hashes.push_back(leaf_hash);
+    }
+    if (positions.back() >= opening.leaves_size) {
+      LOG(ERROR) << "Index is out of range: " << positions.back();
+      return false;
+    }
+
+    size_t width = opening.leaves_size;
+    size_t next_sibling = 0;
+    std::vector<Hash> children;
+    while (width > 1) {
+      children.clear();
+      size_t num_parents = 0;
+      for (size_t i = 0; i < positions.size(); ++i) {
+        size_t position = positions[i];
+        if (HasRightSibling(positions, i)) {
+          children.push_back(std::move(hashes[i]));
+          children.push_back(std::move(hashes[++i]));
+        } else {
+          if (next_sibling == proof.siblings.size()) {
+            LOG(ERROR) << "Too few siblings";
+            return false;
+          }
+          const Hash& sibling = proof.siblings[next_sibling++];
+          if (position % 2 == 0) {
+            children.push_back(std::move(hashes[i]));
+            children.push_back(sibling);
+          } else {
+            children.push_back(sibling);
+            children.push_back(std::move(hashes[i]));
+          }
+        }
+        positions[num_parents++] = position >> 1;
+      }
+      positions.resize(num_parents);
+      hashes.resize(num_parents);
+      hasher_->ComputeParentHashes(children, absl::MakeSpan(hashes));
+      width >>= 1;
+    }
+    if (next_sibling != proof.siblings.size()) {
+      LOG(ERROR) << "Too many siblings";
+      return false;
+    }
+    return hashes[0] == root;
+  }
+
+  // Recomputes the |parents|, which are at the same level, from their
+  // children. The parents are hashed |kHashBatchSize| at a time.
+  void UpdateParents(const std::vector<size_t>& parents) const {
+    size_t num_batches =
+        (parents.size() + kHashBatchSize - 1) / kHashBatchSize;
+    auto update = [this, &parents](size_t batch) {
+      size_t from = batch * kHashBatchSize;
+      size_t size = std::min(kHashBatchSize, parents.size() - from);
+      std::vector<Hash> children(2 * size);
+      std::vector<Hash> hashes(size);
+      for (size_t i = 0; i < size; ++i) {
+        storage_->GetHashes(2 * parents[from + i] + 1,
+                            absl::MakeSpan(&children[2 * i], 2));
+      }
+      hasher_->ComputeParentHashes(children, absl::MakeSpan(hashes));
+      for (size_t i = 0; i < size; ++i) {
+        storage_->SetHash(parents[from + i], hashes[i]);
+      }
+    };
+    if (parents.size() > leaves_size_for_parallelization_) {
+      OPENMP_PARALLEL_FOR(size_t i = 0; i < num_batches; ++i) { update(i); }
+    } else {
+      for (size_t i = 0; i < num_batches; ++i) {
+        update(i);
+      }
+    }
+  }
+
+  // Returns true if the node right next to |positions[i]| is also in
+  // |positions|, which is sorted and deduplicated.
+  static bool HasRightSibling(const std::vector<size_t>& positions, size_t i) {
+    return positions[i] % 2 == 0 && i + 1 < positions.size() &&
+           positions[i + 1] == positions[i] + 1;
+  }
+
   template <typename Container>
   bool FillLeaves(const Container& leaves) const {
     size_t leaves_size = std::size(leaves);
@@ -133,19 +362,36 @@ class BinaryMerkleTree final
     }
     base::CheckedNumeric<size_t> n = leaves_size;
     storage_->Allocate(((n << 1) - 1).ValueOrDie());
-    OPENMP_PARALLEL_FOR(size_t i = 0; i < leaves_size; ++i) {
-      storage_->SetHash(leaves_size + i - 1,
-                        hasher_->ComputeLeafHash(leaves[i]));
+    size_t num_batches = (leaves_size + kHashBatchSize - 1) / kHashBatchSize;
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < num_batches; ++i) {
+      size_t from = i * kHashBatchSize;
+      size_t size = std::min(kHashBatchSize, leaves_size - from);
+      std::vector<Hash> hashes(size);
+      hasher_->ComputeLeafHashes(
+          absl::MakeConstSpan(std::data(leaves) + from, size),
+          absl::MakeSpan(hashes));
+      storage_->SetHashes(leaves_size - 1 + from, hashes);
     }
     return true;
   }
 
+  // Builds the nodes above the nodes in |range| level by level. The nodes of
+  // each level are hashed |kHashBatchSize| at a time.
   void BuildTreeFromLeaves(base::Range<size_t> range) const {
+    std::vector<Hash> children;
+    std::vector<Hash> parents;
     while (range.GetSize() > 0) {
-      for (size_t i = range.from; i < range.to; i += 2) {
-        storage_->SetHash(i >> 1,
-                          hasher_->ComputeParentHash(storage_->GetHash(i),
-                                                     storage_->GetHash(i + 1)));
+      // NOTE: Except for the first level, |range.to| is the index
+      // of the last right child, not the one past it.
+      size_t num_parents = (range.GetSize() + 1) / 2;
+      for (size_t offset = 0; offset < num_parents; offset += kHashBatchSize) {
+        size_t size = std::min(kHashBatchSize, num_parents - offset);
+        size_t from = range.from + 2 * offset;
+        children.resize(2 * size);
+        parents.resize(size);
+        storage_->GetHashes(from, absl::MakeSpan(children));
+        hasher_->ComputeParentHashes(children, absl::MakeSpan(parents));
+        storage_->SetHashes(from >> 1, parents);
       }
       range = base::Range<size_t>(range.from >> 1, (range.to >> 1) - 1);
     }
@@ -6,8 +6,13 @@
 
 #include <stddef.h>
 
+#include "absl/types/span.h"
+
 namespace tachyon::crypto {
 
+// Stores the nodes of a binary merkle tree. A node is indexed in the heap
+// order, where the root is 0 and the children of the node i are 2i + 1 and
+// 2i + 2, so the nodes at the same level have consecutive indices.
 template <typename Hash>
 class BinaryMerkleTreeStorage {
  public:
@@ -17,6 +22,21 @@ class BinaryMerkleTreeStorage {
   virtual size_t GetSize() const = 0;
   virtual const Hash& GetHash(size_t i) const = 0;
   virtual void SetHash(size_t i, const Hash& hash) = 0;
+
+  // Copies the nodes from |i| to |i + hashes.size()| to |hashes|. The nodes
+  // must be at the same level. Override it if the nodes can be copied at once.
+  virtual void GetHashes(size_t i, absl::Span<Hash> hashes) const {
+    for (size_t j = 0; j < hashes.size(); ++j) {
+      hashes[j] = GetHash(i + j);
+    }
+  }
+
+  // Same as |GetHashes()| but to set the nodes.
+  virtual void SetHashes(size_t i, absl::Span<const Hash> hashes) {
+    for (size_t j = 0; j < hashes.size(); ++j) {
+      SetHash(i + j, hashes[j]);
+    }
+  }
 };
 
 }  // namespace tachyon::crypto
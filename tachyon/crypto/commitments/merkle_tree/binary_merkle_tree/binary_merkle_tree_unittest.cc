@@ -3,9 +3,14 @@
 
 #include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/binary_merkle_tree.h"
 
+#include <utility>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/files/scoped_temp_dir.h"
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/layered_binary_merkle_tree_storage.h"
 #include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/simple_binary_merkle_tree_storage.h"
 
 namespace tachyon::crypto {
@@ -111,4 +116,114 @@ TEST_F(BinaryMerkleTreeTest, CommitAndVerify) {
   ASSERT_TRUE(vcs_.VerifyOpeningProof(commitment, leaf_hash, proof));
 }
 
+TEST_F(BinaryMerkleTreeTest, CommitAndVerifyMultiProof) {
+  CreateLeaves();
+
+  int commitment;
+  ASSERT_TRUE(vcs_.Commit(leaves_, &commitment));
+
+  // The path of 1 needs 0 and the paths of 2 and 3 share 8. Only 0 and 54 are
+  // needed.
+  std::vector<size_t> indices = {3, 1, 2, 3};
+  BinaryMerkleMultiProof<int> proof;
+  ASSERT_TRUE(vcs_.CreateOpeningProof(indices, &proof));
+
+  BinaryMerkleMultiProof<int> expected_proof;
+  expected_proof.siblings = {0, 54};
+  EXPECT_EQ(proof, expected_proof);
+
+  BinaryMerkleMultiOpening<int> opening;
+  opening.leaves_size = N;
+  opening.indices = indices;
+  opening.leaf_hashes = base::Map(indices, [this](size_t i) {
+    return hasher_.ComputeLeafHash(leaves_[i]);
+  });
+  ASSERT_TRUE(vcs_.VerifyOpeningProof(commitment, opening, proof));
+
+  BinaryMerkleMultiOpening<int> invalid_opening = opening;
+  invalid_opening.leaf_hashes[0] += 1;
+  EXPECT_FALSE(vcs_.VerifyOpeningProof(commitment, invalid_opening, proof));
+  invalid_opening = opening;
+  invalid_opening.indices[1] = 0;
+  EXPECT_FALSE(vcs_.VerifyOpeningProof(commitment, invalid_opening, proof));
+
+  BinaryMerkleMultiProof<int> invalid_proof = proof;
+  invalid_proof.siblings.pop_back();
+  EXPECT_FALSE(vcs_.VerifyOpeningProof(commitment, opening, invalid_proof));
+  invalid_proof = proof;
+  invalid_proof.siblings.push_back(0);
+  EXPECT_FALSE(vcs_.VerifyOpeningProof(commitment, opening, invalid_proof));
+
+  std::vector<size_t> all_indices = base::CreateRangedVector<size_t>(0, N);
+  ASSERT_TRUE(vcs_.CreateOpeningProof(all_indices, &proof));
+  EXPECT_TRUE(proof.siblings.empty());
+
+  std::vector<size_t> invalid_indices = {N};
+  EXPECT_FALSE(vcs_.CreateOpeningProof(invalid_indices, &proof));
+}
+
+TEST_F(BinaryMerkleTreeTest, UpdateLeaves) {
+  CreateLeaves();
+
+  int commitment;
+  EXPECT_FALSE(vcs_.UpdateLeaf(0, 1, &commitment));
+  ASSERT_TRUE(vcs_.Commit(leaves_, &commitment));
+
+  ASSERT_TRUE(vcs_.UpdateLeaf(2, 10, &commitment));
+  leaves_[2] = 10;
+  std::vector<int> nodes = storage_.hashes();
+  SimpleBinaryMerkleTreeStorage<int> storage;
+  VCS vcs(&storage, &hasher_);
+  int expected_commitment;
+  ASSERT_TRUE(vcs.Commit(leaves_, &expected_commitment));
+  EXPECT_EQ(commitment, expected_commitment);
+  EXPECT_EQ(nodes, storage.hashes());
+
+  // 3 and 2 share the parent and the last update of 3 wins.
+  std::vector<std::pair<size_t, int>> updates = {
+      {7, 3}, {3, 5}, {2, 4}, {3, 6}};
+  ASSERT_TRUE(vcs_.UpdateLeaves(updates, &commitment));
+  leaves_[7] = 3;
+  leaves_[2] = 4;
+  leaves_[3] = 6;
+  ASSERT_TRUE(vcs.Commit(leaves_, &expected_commitment));
+  EXPECT_EQ(commitment, expected_commitment);
+  EXPECT_EQ(storage_.hashes(), storage.hashes());
+
+  EXPECT_FALSE(vcs_.UpdateLeaf(N, 0, &commitment));
+}
+
+TEST_F(BinaryMerkleTreeTest, LayeredStorage) {
+  CreateLeaves();
+  int expected_commitment;
+  ASSERT_TRUE(vcs_.Commit(leaves_, &expected_commitment));
+  std::vector<int> expected_nodes = storage_.hashes();
+  int expected_updated_commitment;
+  ASSERT_TRUE(vcs_.UpdateLeaf(5, 1, &expected_updated_commitment));
+
+  base::ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+  for (bool mapped : {false, true}) {
+    SCOPED_TRACE(mapped);
+    LayeredBinaryMerkleTreeStorage<int> storage =
+        mapped ? LayeredBinaryMerkleTreeStorage<int>(
+                     temp_dir.GetPath().Append("tree"))
+               : LayeredBinaryMerkleTreeStorage<int>();
+    VCS vcs(&storage, &hasher_);
+    vcs.set_leaves_size_for_parallelization(N >> 1);
+    int commitment;
+    ASSERT_TRUE(vcs.Commit(leaves_, &commitment));
+    EXPECT_EQ(commitment, expected_commitment);
+    for (size_t i = 0; i < storage.GetSize(); ++i) {
+      EXPECT_EQ(storage.GetHash(i), expected_nodes[i]);
+    }
+    EXPECT_EQ(std::vector<int>(storage.GetLevel(2).begin(),
+                               storage.GetLevel(2).end()),
+              std::vector<int>({2, 8, 14, 20}));
+
+    ASSERT_TRUE(vcs.UpdateLeaf(5, 1, &commitment));
+    EXPECT_EQ(commitment, expected_updated_commitment);
+  }
+}
+
 }  // namespace tachyon::crypto
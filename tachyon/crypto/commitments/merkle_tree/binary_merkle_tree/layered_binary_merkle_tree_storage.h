@@ -0,0 +1,116 @@
+#ifndef TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_LAYERED_BINARY_MERKLE_TREE_STORAGE_H_
+#define TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_LAYERED_BINARY_MERKLE_TREE_STORAGE_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/files/file.h"
+#include "tachyon/base/files/file_path.h"
+#include "tachyon/base/files/memory_mapped_file.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/numerics/checked_math.h"
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/binary_merkle_tree_storage.h"
+
+namespace tachyon::crypto {
+
+// Stores the levels of the tree one after another from the leaves to the
+// root, so the nodes hashed together are next to each other and a level is
+// read or written with a single copy.
+//
+// clang-format off
+//      0              [3, 4, 5, 6, 1, 2, 0]
+//    1   2        ->   ───────────  ────  ─
+//   3 4 5 6            leaves       level root
+// clang-format on
+//
+// If a file is given, the nodes are stored in the file mapped into memory
+// instead of the heap, so a tree larger than the memory can be built. The
+// pages are loaded by the OS on demand and the tree remains in the file.
+template <typename Hash>
+class LayeredBinaryMerkleTreeStorage : public BinaryMerkleTreeStorage<Hash> {
+ public:
+  LayeredBinaryMerkleTreeStorage() = default;
+  explicit LayeredBinaryMerkleTreeStorage(const base::FilePath& path)
+      : path_(path) {
+    static_assert(std::is_trivially_copyable_v<Hash>,
+                  "Only a trivially copyable hash can be mapped to a file");
+  }
+
+  const base::FilePath& path() const { return path_; }
+
+  // Returns the nodes at |depth|, where the root is at depth 0.
+  absl::Span<const Hash> GetLevel(size_t depth) const {
+    size_t size = size_t{1} << depth;
+    return absl::Span<const Hash>(&hashes_[GetOffset(size - 1)], size);
+  }
+
+  // BinaryMerkleTreeStorage<Hash> methods
+  void Allocate(size_t size) override {
+    CHECK(base::bits::IsPowerOfTwo(size + 1));
+    size_ = size;
+    if (path_.empty()) {
+      buffer_.resize(size);
+      hashes_ = buffer_.data();
+      return;
+    }
+    mapped_file_ = std::make_unique<base::MemoryMappedFile>();
+    base::File file(path_, base::File::FLAG_CREATE_ALWAYS |
+                               base::File::FLAG_READ | base::File::FLAG_WRITE);
+    CHECK(file.IsValid()) << "Failed to create " << path_.value();
+    base::CheckedNumeric<size_t> length = size;
+    length *= sizeof(Hash);
+    CHECK(mapped_file_->Initialize(
+        std::move(file), {0, length.ValueOrDie()},
+        base::MemoryMappedFile::READ_WRITE_EXTEND))
+        << "Failed to map " << path_.value();
+    hashes_ = reinterpret_cast<Hash*>(mapped_file_->data());
+  }
+
+  size_t GetSize() const override { return size_; }
+
+  const Hash& GetHash(size_t i) const override {
+    return hashes_[GetOffset(i)];
+  }
+
+  void SetHash(size_t i, const Hash& hash) override {
+    hashes_[GetOffset(i)] = hash;
+  }
+
+  void GetHashes(size_t i, absl::Span<Hash> hashes) const override {
+    const Hash* from = &hashes_[GetOffset(i)];
+    std::copy(from, from + hashes.size(), hashes.data());
+  }
+
+  void SetHashes(size_t i, absl::Span<const Hash> hashes) override {
+    std::copy(hashes.begin(), hashes.end(), &hashes_[GetOffset(i)]);
+  }
+
+ private:
+  // Returns the position of the node |i| in |hashes_|. The levels deeper than
+  // the level of depth d at which |i| lies occupy |size_| + 1 - 2ᵈ⁺¹ nodes and
+  // |i| is the (|i| + 1 - 2ᵈ)-th node of its level.
+  size_t GetOffset(size_t i) const {
+    DCHECK_LT(i, size_);
+    size_t level_size = size_t{1} << base::bits::Log2Floor(i + 1);
+    return size_ + 2 + i - 3 * level_size;
+  }
+
+  base::FilePath path_;
+  size_t size_ = 0;
+  // Points to either |buffer_| or the memory of |mapped_file_|.
+  Hash* hashes_ = nullptr;
+  std::vector<Hash> buffer_;
+  std::unique_ptr<base::MemoryMappedFile> mapped_file_;
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_LAYERED_BINARY_MERKLE_TREE_STORAGE_H_
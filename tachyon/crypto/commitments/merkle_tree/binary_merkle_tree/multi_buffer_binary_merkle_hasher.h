@@ -0,0 +1,95 @@
+#ifndef TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_MULTI_BUFFER_BINARY_MERKLE_HASHER_H_
+#define TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_MULTI_BUFFER_BINARY_MERKLE_HASHER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/binary_merkle_hasher.h"
+#include "tachyon/crypto/hashes/multi_buffer/blake2s_multi_buffer.h"
+#include "tachyon/crypto/hashes/multi_buffer/keccak256_multi_buffer.h"
+#include "tachyon/crypto/hashes/multi_buffer/sha256_multi_buffer.h"
+
+namespace tachyon::crypto {
+
+// Hashes the leaves and the nodes of a |BinaryMerkleTree| whose nodes are byte
+// digests. A leaf of |LeafSize| bytes is hashed as H(leaf) and a node as
+// H(left || right). Since the inputs of each level have the same size, the
+// batch methods hash |MultiBufferHash::kNumLanes| of them at once.
+// |MultiBufferHash| has to provide |kDigestSize| and
+// |Hash(messages, message_size, digests)|. See |Sha256MultiBuffer| for
+// example.
+template <typename MultiBufferHash,
+          size_t LeafSize = MultiBufferHash::kDigestSize>
+class MultiBufferBinaryMerkleHasher
+    : public BinaryMerkleHasher<std::array<uint8_t, LeafSize>,
+                                std::array<uint8_t,
+                                           MultiBufferHash::kDigestSize>> {
+ public:
+  using Leaf = std::array<uint8_t, LeafSize>;
+  using Digest = std::array<uint8_t, MultiBufferHash::kDigestSize>;
+
+  // BinaryMerkleHasher<Leaf, Digest> methods
+  Digest ComputeLeafHash(const Leaf& leaf) const override {
+    Digest ret;
+    ComputeLeafHashes(absl::MakeConstSpan(&leaf, 1), absl::MakeSpan(&ret, 1));
+    return ret;
+  }
+
+  Digest ComputeParentHash(const Digest& left,
+                           const Digest& right) const override {
+    Digest children[] = {left, right};
+    Digest ret;
+    ComputeParentHashes(children, absl::MakeSpan(&ret, 1));
+    return ret;
+  }
+
+  void ComputeLeafHashes(absl::Span<const Leaf> leaves,
+                         absl::Span<Digest> hashes) const override {
+    DCHECK_EQ(leaves.size(), hashes.size());
+    MultiBufferHash::Hash(AsBytes(leaves), LeafSize, AsBytes(hashes));
+  }
+
+  void ComputeParentHashes(absl::Span<const Digest> children,
+                           absl::Span<Digest> parents) const override {
+    DCHECK_EQ(children.size(), 2 * parents.size());
+    MultiBufferHash::Hash(AsBytes(children), 2 * sizeof(Digest),
+                          AsBytes(parents));
+  }
+
+ private:
+  static_assert(sizeof(Leaf) == LeafSize);
+  static_assert(sizeof(Digest) == MultiBufferHash::kDigestSize);
+
+  template <size_t N>
+  static absl::Span<const uint8_t> AsBytes(
+      absl::Span<const std::array<uint8_t, N>> arrays) {
+    return {reinterpret_cast<const uint8_t*>(arrays.data()), N * arrays.size()};
+  }
+
+  template <size_t N>
+  static absl::Span<uint8_t> AsBytes(
+      absl::Span<std::array<uint8_t, N>> arrays) {
+    return {reinterpret_cast<uint8_t*>(arrays.data()), N * arrays.size()};
+  }
+};
+
+template <size_t LeafSize = 32>
+using Sha256BinaryMerkleHasher =
+    MultiBufferBinaryMerkleHasher<Sha256MultiBuffer<>, LeafSize>;
+
+template <size_t LeafSize = 32>
+using Keccak256BinaryMerkleHasher =
+    MultiBufferBinaryMerkleHasher<Keccak256MultiBuffer<>, LeafSize>;
+
+template <size_t LeafSize = 32>
+using Blake2sBinaryMerkleHasher =
+    MultiBufferBinaryMerkleHasher<Blake2sMultiBuffer<>, LeafSize>;
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_MULTI_BUFFER_BINARY_MERKLE_HASHER_H_
@@ -0,0 +1,95 @@
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/multi_buffer_binary_merkle_hasher.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/random.h"
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/binary_merkle_tree.h"
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/simple_binary_merkle_tree_storage.h"
+
+namespace tachyon::crypto {
+
+namespace {
+
+template <typename Hasher>
+class MultiBufferBinaryMerkleHasherTest : public testing::Test {
+ public:
+  using Leaf = typename Hasher::Leaf;
+
+  static Leaf RandomLeaf() {
+    Leaf leaf;
+    for (uint8_t& byte : leaf) {
+      byte = base::Uniform(base::Range<uint8_t>::All());
+    }
+    return leaf;
+  }
+};
+
+}  // namespace
+
+using HasherTypes =
+    testing::Types<Sha256BinaryMerkleHasher<>, Keccak256BinaryMerkleHasher<>,
+                   Blake2sBinaryMerkleHasher<>, Sha256BinaryMerkleHasher<100>>;
+TYPED_TEST_SUITE(MultiBufferBinaryMerkleHasherTest, HasherTypes);
+
+TYPED_TEST(MultiBufferBinaryMerkleHasherTest, ComputeHash) {
+  using Hasher = TypeParam;
+  using Leaf = typename Hasher::Leaf;
+  using Digest = typename Hasher::Digest;
+
+  Hasher hasher;
+  // More than the number of the lanes to test the last partial batch.
+  size_t n = 20;
+  std::vector<Leaf> leaves =
+      base::CreateVector(n, []() { return TestFixture::RandomLeaf(); });
+  std::vector<Digest> leaf_hashes(n);
+  hasher.ComputeLeafHashes(leaves, absl::MakeSpan(leaf_hashes));
+  for (size_t i = 0; i < n; ++i) {
+    EXPECT_EQ(leaf_hashes[i], hasher.ComputeLeafHash(leaves[i]));
+  }
+
+  std::vector<Digest> parent_hashes(n / 2);
+  hasher.ComputeParentHashes(leaf_hashes, absl::MakeSpan(parent_hashes));
+  for (size_t i = 0; i < n / 2; ++i) {
+    EXPECT_EQ(parent_hashes[i],
+              hasher.ComputeParentHash(leaf_hashes[2 * i],
+                                       leaf_hashes[2 * i + 1]));
+  }
+}
+
+TYPED_TEST(MultiBufferBinaryMerkleHasherTest, CommitAndVerify) {
+  using Hasher = TypeParam;
+  using Leaf = typename Hasher::Leaf;
+  using Digest = typename Hasher::Digest;
+  constexpr size_t kN = 1024;
+
+  Hasher hasher;
+  SimpleBinaryMerkleTreeStorage<Digest> storage;
+  BinaryMerkleTree<Leaf, Digest, kN> tree(&storage, &hasher);
+
+  std::vector<Leaf> leaves =
+      base::CreateVector(kN, []() { return TestFixture::RandomLeaf(); });
+  Digest commitment;
+  ASSERT_TRUE(tree.Commit(leaves, &commitment));
+
+  std::vector<Digest> nodes = base::Map(leaves, [&hasher](const Leaf& leaf) {
+    return hasher.ComputeLeafHash(leaf);
+  });
+  while (nodes.size() > 1) {
+    std::vector<Digest> parents;
+    for (size_t i = 0; i < nodes.size(); i += 2) {
+      parents.push_back(hasher.ComputeParentHash(nodes[i], nodes[i + 1]));
+    }
+    nodes = std::move(parents);
+  }
+  EXPECT_EQ(commitment, nodes[0]);
+
+  BinaryMerkleProof<Digest> proof;
+  ASSERT_TRUE(tree.CreateOpeningProof(555, &proof));
+  EXPECT_TRUE(tree.VerifyOpeningProof(
+      commitment, hasher.ComputeLeafHash(leaves[555]), proof));
+}
+
+}  // namespace tachyon::crypto
@@ -0,0 +1,122 @@
+#ifndef TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_POSEIDON2_BINARY_MERKLE_HASHER_H_
+#define TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_POSEIDON2_BINARY_MERKLE_HASHER_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "absl/container/inlined_vector.h"
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/binary_merkle_hasher.h"
+#include "tachyon/crypto/hashes/sponge/poseidon2/poseidon2.h"
+
+namespace tachyon::crypto {
+
+// Hashes the leaves and the nodes of a |BinaryMerkleTree| over a prime field
+// with a single Poseidon2 permutation. The inputs are put into the rate and
+// the first element of the rate is taken as the output after the permutation.
+// To separate a leaf from a node, the capacity is initialized with the number
+// of the inputs, i.e., 1 for a leaf and 2 for a node. This is equal to
+// absorbing the inputs into a fresh |Poseidon2Sponge| whose capacity is
+// initialized in the same way and squeezing a single element.
+// The batch methods permute up to |kNumLanes| states at once with
+// |Poseidon2Sponge::PermuteBatch()|.
+template <typename F>
+class Poseidon2BinaryMerkleHasher : public BinaryMerkleHasher<F, F> {
+ public:
+  // 64 states of width 3 over a 256-bit field take 6KiB, which fits in L1
+  // cache.
+  constexpr static size_t kNumLanes = 64;
+
+  explicit Poseidon2BinaryMerkleHasher(const Poseidon2Config<F>& config)
+      : config_(config) {
+    CHECK(config_.IsValid());
+    CHECK_GE(config_.rate, size_t{2});
+  }
+  explicit Poseidon2BinaryMerkleHasher(Poseidon2Config<F>&& config)
+      : config_(std::move(config)) {
+    CHECK(config_.IsValid());
+    CHECK_GE(config_.rate, size_t{2});
+  }
+
+  const Poseidon2Config<F>& config() const { return config_; }
+
+  // BinaryMerkleHasher<F, F> methods
+  F ComputeLeafHash(const F& leaf) const override {
+    State state = CreateState(1);
+    state[config_.capacity] = leaf;
+    return Permute(state);
+  }
+
+  F ComputeParentHash(const F& left, const F& right) const override {
+    State state = CreateState(2);
+    state[config_.capacity] = left;
+    state[config_.capacity + 1] = right;
+    return Permute(state);
+  }
+
+  void ComputeLeafHashes(absl::Span<const F> leaves,
+                         absl::Span<F> hashes) const override {
+    DCHECK_EQ(leaves.size(), hashes.size());
+    ComputeHashesInBatches(1, leaves, hashes);
+  }
+
+  void ComputeParentHashes(absl::Span<const F> children,
+                           absl::Span<F> parents) const override {
+    DCHECK_EQ(children.size(), 2 * parents.size());
+    ComputeHashesInBatches(2, children, parents);
+  }
+
+ private:
+  // Most of the widths used in practice fit without a heap allocation.
+  using State = absl::InlinedVector<F, 16>;
+
+  State CreateState(size_t num_inputs) const {
+    State state(config_.rate + config_.capacity, F::Zero());
+    state[0] = F(num_inputs);
+    return state;
+  }
+
+  F Permute(State& state) const {
+    Poseidon2Sponge<F>::Permute(config_, absl::MakeSpan(state));
+    return std::move(state[config_.capacity]);
+  }
+
+  // Computes |outputs[i]| from |inputs[i * num_inputs]|, ...,
+  // |inputs[(i + 1) * num_inputs - 1]|.
+  void ComputeHashesInBatches(size_t num_inputs, absl::Span<const F> inputs,
+                              absl::Span<F> outputs) const {
+    size_t width = config_.rate + config_.capacity;
+    F domain(num_inputs);
+    std::vector<F> states;
+    for (size_t from = 0; from < outputs.size(); from += kNumLanes) {
+      size_t num_lanes = std::min(kNumLanes, outputs.size() - from);
+      states.assign(width * num_lanes, F::Zero());
+      for (size_t l = 0; l < num_lanes; ++l) {
+        states[l] = domain;
+      }
+      for (size_t k = 0; k < num_inputs; ++k) {
+        F* row = &states[(config_.capacity + k) * num_lanes];
+        for (size_t l = 0; l < num_lanes; ++l) {
+          row[l] = inputs[(from + l) * num_inputs + k];
+        }
+      }
+      Poseidon2Sponge<F>::PermuteBatch(config_, absl::MakeSpan(states),
+                                       num_lanes);
+      const F* row = &states[config_.capacity * num_lanes];
+      for (size_t l = 0; l < num_lanes; ++l) {
+        outputs[from + l] = row[l];
+      }
+    }
+  }
+
+  Poseidon2Config<F> config_;
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_BINARY_MERKLE_TREE_POSEIDON2_BINARY_MERKLE_HASHER_H_
@@ -0,0 +1,99 @@
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/poseidon2_binary_merkle_hasher.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/binary_merkle_tree.h"
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/simple_binary_merkle_tree_storage.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+
+namespace tachyon::crypto {
+
+namespace {
+
+using F = math::bn254::Fr;
+
+class Poseidon2BinaryMerkleHasherTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { F::Init(); }
+
+  void SetUp() override {
+    config_ = Poseidon2Config<F>::CreateCustom(2, 5, 8, 56);
+  }
+
+ protected:
+  F HashWithSponge(const std::vector<F>& inputs) const {
+    Poseidon2Sponge<F> sponge(config_);
+    sponge.state[0] = F(inputs.size());
+    CHECK(sponge.Absorb(inputs));
+    return sponge.SqueezeNativeFieldElements(1)[0];
+  }
+
+  Poseidon2Config<F> config_;
+};
+
+}  // namespace
+
+TEST_F(Poseidon2BinaryMerkleHasherTest, ComputeHash) {
+  Poseidon2BinaryMerkleHasher<F> hasher(config_);
+  F a = F::Random();
+  F b = F::Random();
+  EXPECT_EQ(hasher.ComputeLeafHash(a), HashWithSponge({a}));
+  EXPECT_EQ(hasher.ComputeParentHash(a, b), HashWithSponge({a, b}));
+  EXPECT_NE(hasher.ComputeLeafHash(a), hasher.ComputeParentHash(a, F::Zero()));
+}
+
+TEST_F(Poseidon2BinaryMerkleHasherTest, ComputeHashesInBatches) {
+  Poseidon2BinaryMerkleHasher<F> hasher(config_);
+  // More than |kNumLanes| to test the last partial batch.
+  size_t n = Poseidon2BinaryMerkleHasher<F>::kNumLanes + 3;
+  std::vector<F> inputs =
+      base::CreateVector(2 * n, []() { return F::Random(); });
+
+  std::vector<F> leaf_hashes(2 * n);
+  hasher.ComputeLeafHashes(inputs, absl::MakeSpan(leaf_hashes));
+  for (size_t i = 0; i < 2 * n; ++i) {
+    EXPECT_EQ(leaf_hashes[i], hasher.ComputeLeafHash(inputs[i]));
+  }
+
+  std::vector<F> parent_hashes(n);
+  hasher.ComputeParentHashes(inputs, absl::MakeSpan(parent_hashes));
+  for (size_t i = 0; i < n; ++i) {
+    EXPECT_EQ(parent_hashes[i],
+              hasher.ComputeParentHash(inputs[2 * i], inputs[2 * i + 1]));
+  }
+}
+
+TEST_F(Poseidon2BinaryMerkleHasherTest, CommitAndVerify) {
+  // Larger than |kHashBatchSize| to hash the levels in several batches.
+  constexpr size_t kN = 1024;
+
+  Poseidon2BinaryMerkleHasher<F> hasher(config_);
+  SimpleBinaryMerkleTreeStorage<F> storage;
+  BinaryMerkleTree<F, F, kN> tree(&storage, &hasher);
+
+  std::vector<F> leaves = base::CreateVector(kN, []() { return F::Random(); });
+  F commitment;
+  ASSERT_TRUE(tree.Commit(leaves, &commitment));
+
+  std::vector<F> nodes = base::Map(leaves, [&hasher](const F& leaf) {
+    return hasher.ComputeLeafHash(leaf);
+  });
+  while (nodes.size() > 1) {
+    std::vector<F> parents;
+    for (size_t i = 0; i < nodes.size(); i += 2) {
+      parents.push_back(hasher.ComputeParentHash(nodes[i], nodes[i + 1]));
+    }
+    nodes = std::move(parents);
+  }
+  EXPECT_EQ(commitment, nodes[0]);
+
+  BinaryMerkleProof<F> proof;
+  ASSERT_TRUE(tree.CreateOpeningProof(555, &proof));
+  EXPECT_TRUE(tree.VerifyOpeningProof(
+      commitment, hasher.ComputeLeafHash(leaves[555]), proof));
+}
+
+}  // namespace tachyon::crypto
@@ -0,0 +1,51 @@
+#ifndef TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_MATRIX_MERKLE_TREE_MATRIX_MERKLE_HASHER_H_
+#define TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_MATRIX_MERKLE_TREE_MATRIX_MERKLE_HASHER_H_
+
+#include <stddef.h>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+
+namespace tachyon::crypto {
+
+template <typename F, typename Hash>
+class MatrixMerkleHasher {
+ public:
+  virtual ~MatrixMerkleHasher() = default;
+
+  // Hashes a row, which is the concatenation of the rows of the matrices of
+  // the same height at the same index.
+  virtual Hash ComputeRowHash(absl::Span<const F> row) const = 0;
+
+  // Compresses 2 hashes into 1. This is also used to inject the hash of the
+  // rows of the shorter matrices into a node.
+  virtual Hash ComputeParentHash(const Hash& left, const Hash& right) const = 0;
+
+  // Computes the hashes of the rows of |width| elements laid out contiguously
+  // in |rows| into |hashes|. Override this if hashing many rows at once is
+  // faster than hashing them one by one.
+  virtual void ComputeRowHashes(absl::Span<const F> rows, size_t width,
+                                absl::Span<Hash> hashes) const {
+    DCHECK_EQ(rows.size(), width * hashes.size());
+    for (size_t i = 0; i < hashes.size(); ++i) {
+      hashes[i] = ComputeRowHash(rows.subspan(i * width, width));
+    }
+  }
+
+  // Computes the hashes of the parents into |parents|, where
+  // |children[2 * i]| and |children[2 * i + 1]| are the left and the right
+  // child of |parents[i]|. Override this if hashing many nodes at once is
+  // faster than hashing them one by one.
+  virtual void ComputeParentHashes(absl::Span<const Hash> children,
+                                   absl::Span<Hash> parents) const {
+    DCHECK_EQ(children.size(), 2 * parents.size());
+    for (size_t i = 0; i < parents.size(); ++i) {
+      parents[i] = ComputeParentHash(children[2 * i], children[2 * i + 1]);
+    }
+  }
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_MATRIX_MERKLE_TREE_MATRIX_MERKLE_HASHER_H_
@@ -0,0 +1,42 @@
+#ifndef TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_MATRIX_MERKLE_TREE_MATRIX_MERKLE_PROOF_H_
+#define TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_MATRIX_MERKLE_TREE_MATRIX_MERKLE_PROOF_H_
+
+#include <stddef.h>
+
+#include <vector>
+
+namespace tachyon::crypto {
+
+// The position opened by a |MatrixMerkleProof|. A matrix of height h is
+// opened at the row |index >> (log₂(max_height) - log₂(h))|, where
+// |max_height| is the largest of |heights|.
+struct MatrixMerkleQuery {
+  size_t index = 0;
+  // The heights of the committed matrices in the order of the commitment.
+  std::vector<size_t> heights;
+  // The widths of the committed matrices in the order of the commitment.
+  // NOTE: The rows of the matrices of the same height are
+  // concatenated before being hashed, so the widths must be given by the
+  // verifier. Otherwise, a prover could move columns from one matrix to the
+  // next one of the same height without changing the hash.
+  std::vector<size_t> widths;
+};
+
+template <typename F, typename Hash>
+struct MatrixMerkleProof {
+  // The opened row of each committed matrix in the order of the commitment.
+  std::vector<std::vector<F>> rows;
+  // The siblings of the nodes on the path from the bottom to the cap.
+  std::vector<Hash> siblings;
+
+  bool operator==(const MatrixMerkleProof& other) const {
+    return rows == other.rows && siblings == other.siblings;
+  }
+  bool operator!=(const MatrixMerkleProof& other) const {
+    return !operator==(other);
+  }
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_MATRIX_MERKLE_TREE_MATRIX_MERKLE_PROOF_H_
@@ -0,0 +1,318 @@
+#ifndef TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_MATRIX_MERKLE_TREE_MATRIX_MERKLE_TREE_H_
+#define TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_MATRIX_MERKLE_TREE_MATRIX_MERKLE_TREE_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/crypto/commitments/merkle_tree/matrix_merkle_tree/matrix_merkle_hasher.h"
+#include "tachyon/crypto/commitments/merkle_tree/matrix_merkle_tree/matrix_merkle_proof.h"
+#include "tachyon/crypto/commitments/vector_commitment_scheme.h"
+#include "tachyon/math/matrix/matrix_types.h"
+
+namespace tachyon::crypto {
+
+// Commits to several matrices at once with a single merkle tree. Each leaf is
+// the hash of a row, where the rows of all the tallest matrices at the same
+// index are concatenated. A shorter matrix of height h is injected at the
+// level with h nodes by compressing each node with the hash of its rows.
+//
+// clang-format off
+//           [n₀, n₁]                   <- cap of size 2
+//          /        \
+//   C(C(l₀, l₁), r₀) C(C(l₂, l₃), r₁)  <- a matrix of height 2 is injected
+//      /    \          /    \
+//     l₀    l₁        l₂    l₃         <- hashes of the rows of height 4
+// clang-format on
+//
+// The top levels above |cap_size| nodes are not built and the nodes at that
+// level become the commitment. A proof opens every column of a row of every
+// matrix with a single path, which is shorter by log₂(|cap_size|) hashes.
+template <typename F, typename Hash, size_t MaxSize>
+class MatrixMerkleTree final
+    : public VectorCommitmentScheme<MatrixMerkleTree<F, Hash, MaxSize>> {
+ public:
+  using Matrix = math::RowMajorMatrix<F>;
+
+  // The number of rows or nodes hashed by a thread at once.
+  constexpr static size_t kHashBatchSize = 256;
+
+  MatrixMerkleTree() = default;
+  explicit MatrixMerkleTree(MatrixMerkleHasher<F, Hash>* hasher,
+                            size_t cap_size = 1)
+      : hasher_(hasher), cap_size_(cap_size) {
+    CHECK(base::bits::IsPowerOfTwo(cap_size));
+  }
+
+  size_t cap_size() const { return cap_size_; }
+
+  // Returns the levels of the tree from the bottom to the cap.
+  const std::vector<std::vector<Hash>>& digest_layers() const {
+    return digest_layers_;
+  }
+
+ private:
+  friend class VectorCommitmentScheme<MatrixMerkleTree<F, Hash, MaxSize>>;
+
+  // VectorCommitmentScheme methods
+  size_t N() const { return MaxSize; }
+
+  // Commits to |matrices| and populates |cap| with the nodes of the cap.
+  // |matrices| must outlive the openings, since the rows are read from them
+  // when an opening proof is created.
+  [[nodiscard]] bool DoCommit(const std::vector<Matrix>& matrices,
+                              std::vector<Hash>* cap) const {
+    std::vector<size_t> heights = GetHeights(matrices);
+    if (!CheckHeights(heights, cap_size_)) return false;
+    std::vector<size_t> order = SortByHeight(heights);
+    if (heights[order[0]] > MaxSize) {
+      LOG(ERROR) << "Too many rows";
+      return false;
+    }
+
+    digest_layers_.clear();
+    size_t next = 0;
+    std::vector<Hash> layer =
+        HashRows(matrices, order, heights[order[0]], &next);
+    while (layer.size() > cap_size_) {
+      std::vector<Hash> parents = HashParents(layer);
+      if (next < order.size() && heights[order[next]] == parents.size()) {
+        std::vector<Hash> row_hashes =
+            HashRows(matrices, order, parents.size(), &next);
+        InjectRowHashes(row_hashes, parents);
+      }
+      digest_layers_.push_back(std::move(layer));
+      layer = std::move(parents);
+    }
+    *cap = layer;
+    digest_layers_.push_back(std::move(layer));
+    matrices_ = &matrices;
+    return true;
+  }
+
+  [[nodiscard]] bool DoCreateOpeningProof(
+      size_t index, MatrixMerkleProof<F, Hash>* proof) const {
+    if (matrices_ == nullptr) {
+      LOG(ERROR) << "Nothing is committed";
+      return false;
+    }
+    size_t max_height = digest_layers_[0].size();
+    if (index >= max_height) {
+      LOG(ERROR) << "Index is out of range: " << index;
+      return false;
+    }
+
+    size_t log_max_height = base::bits::SafeLog2Ceiling(max_height);
+    proof->rows.resize(matrices_->size());
+    for (size_t i = 0; i < matrices_->size(); ++i) {
+      const Matrix& matrix = (*matrices_)[i];
+      size_t log_height =
+          base::bits::SafeLog2Ceiling(static_cast<size_t>(matrix.rows()));
+      size_t row = index >> (log_max_height - log_height);
+      const F* data = matrix.data() + row * matrix.cols();
+      proof->rows[i] = std::vector<F>(data, data + matrix.cols());
+    }
+
+    proof->siblings.resize(digest_layers_.size() - 1);
+    for (size_t i = 0; i < proof->siblings.size(); ++i) {
+      proof->siblings[i] = digest_layers_[i][index ^ 1];
+      index >>= 1;
+    }
+    return true;
+  }
+
+  [[nodiscard]] bool DoVerifyOpeningProof(
+      const std::vector<Hash>& cap, const MatrixMerkleQuery& query,
+      const MatrixMerkleProof<F, Hash>& proof) const {
+    const std::vector<size_t>& heights = query.heights;
+    if (query.widths.size() != heights.size()) {
+      LOG(ERROR) << "The number of widths doesn't match";
+      return false;
+    }
+    if (proof.rows.size() != heights.size()) {
+      LOG(ERROR) << "The number of rows doesn't match";
+      return false;
+    }
+    for (size_t i = 0; i < proof.rows.size(); ++i) {
+      if (proof.rows[i].size() != query.widths[i]) {
+        LOG(ERROR) << "The width of the row [" << i << "] doesn't match";
+        return false;
+      }
+    }
+    if (!base::bits::IsPowerOfTwo(cap.size())) {
+      LOG(ERROR) << "The size of the cap is not a power of two";
+      return false;
+    }
+    if (!CheckHeights(heights, cap.size())) return false;
+    std::vector<size_t> order = SortByHeight(heights);
+    size_t height = heights[order[0]];
+    if (query.index >= height) {
+      LOG(ERROR) << "Index is out of range: " << query.index;
+      return false;
+    }
+    if (proof.siblings.size() != base::bits::SafeLog2Ceiling(height) -
+                                     base::bits::SafeLog2Ceiling(cap.size())) {
+      LOG(ERROR) << "The number of siblings doesn't match";
+      return false;
+    }
+
+    size_t next = 0;
+    size_t index = query.index;
+    Hash hash = HashOpenedRows(proof.rows, heights, order, height, &next);
+    for (const Hash& sibling : proof.siblings) {
+      if (index % 2 == 0) {
+        hash = hasher_->ComputeParentHash(hash, sibling);
+      } else {
+        hash = hasher_->ComputeParentHash(sibling, hash);
+      }
+      index >>= 1;
+      height >>= 1;
+      if (next < order.size() && heights[order[next]] == height) {
+        hash = hasher_->ComputeParentHash(
+            hash, HashOpenedRows(proof.rows, heights, order, height, &next));
+      }
+    }
+    return hash == cap[index];
+  }
+
+  static std::vector<size_t> GetHeights(const std::vector<Matrix>& matrices) {
+    std::vector<size_t> heights(matrices.size());
+    for (size_t i = 0; i < matrices.size(); ++i) {
+      heights[i] = static_cast<size_t>(matrices[i].rows());
+    }
+    return heights;
+  }
+
+  static bool CheckHeights(const std::vector<size_t>& heights,
+                           size_t cap_size) {
+    if (heights.empty()) {
+      LOG(ERROR) << "No matrices";
+      return false;
+    }
+    for (size_t height : heights) {
+      if (!base::bits::IsPowerOfTwo(height)) {
+        LOG(ERROR) << height << " is not a power of two";
+        return false;
+      }
+      // NOTE: A matrix shorter than the cap would have to be
+      // injected above the cap, which is not built.
+      if (height < cap_size) {
+        LOG(ERROR) << "A matrix of height " << height
+                   << " is shorter than the cap";
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Returns the indices of the matrices sorted by height in descending order.
+  // The matrices of the same height keep their order.
+  static std::vector<size_t> SortByHeight(const std::vector<size_t>& heights) {
+    std::vector<size_t> order(heights.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+                     [&heights](size_t a, size_t b) {
+                       return heights[a] > heights[b];
+                     });
+    return order;
+  }
+
+  // Hashes the concatenated rows of the matrices of |height| starting at
+  // |order[*next]| and advances |*next| past them.
+  std::vector<Hash> HashRows(const std::vector<Matrix>& matrices,
+                             const std::vector<size_t>& order, size_t height,
+                             size_t* next) const {
+    size_t begin = *next;
+    size_t width = 0;
+    while (*next < order.size() &&
+           static_cast<size_t>(matrices[order[*next]].rows()) == height) {
+      width += matrices[order[*next]].cols();
+      ++(*next);
+    }
+    size_t end = *next;
+
+    std::vector<Hash> hashes(height);
+    size_t num_batches = (height + kHashBatchSize - 1) / kHashBatchSize;
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < num_batches; ++i) {
+      size_t from = i * kHashBatchSize;
+      size_t size = std::min(kHashBatchSize, height - from);
+      std::vector<F> rows;
+      rows.reserve(size * width);
+      for (size_t row = from; row < from + size; ++row) {
+        for (size_t j = begin; j < end; ++j) {
+          const Matrix& matrix = matrices[order[j]];
+          const F* data = matrix.data() + row * matrix.cols();
+          rows.insert(rows.end(), data, data + matrix.cols());
+        }
+      }
+      hasher_->ComputeRowHashes(rows, width,
+                                absl::MakeSpan(hashes).subspan(from, size));
+    }
+    return hashes;
+  }
+
+  // Same as |HashRows()| but for a single row of each matrix in |rows|.
+  Hash HashOpenedRows(const std::vector<std::vector<F>>& rows,
+                      const std::vector<size_t>& heights,
+                      const std::vector<size_t>& order, size_t height,
+                      size_t* next) const {
+    std::vector<F> row;
+    while (*next < order.size() && heights[order[*next]] == height) {
+      const std::vector<F>& opened = rows[order[*next]];
+      row.insert(row.end(), opened.begin(), opened.end());
+      ++(*next);
+    }
+    return hasher_->ComputeRowHash(row);
+  }
+
+  std::vector<Hash> HashParents(const std::vector<Hash>& children) const {
+    std::vector<Hash> parents(children.size() / 2);
+    size_t num_batches =
+        (parents.size() + kHashBatchSize - 1) / kHashBatchSize;
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < num_batches; ++i) {
+      size_t from = i * kHashBatchSize;
+      size_t size = std::min(kHashBatchSize, parents.size() - from);
+      hasher_->ComputeParentHashes(
+          absl::MakeConstSpan(children).subspan(2 * from, 2 * size),
+          absl::MakeSpan(parents).subspan(from, size));
+    }
+    return parents;
+  }
+
+  void InjectRowHashes(const std::vector<Hash>& row_hashes,
+                       std::vector<Hash>& nodes) const {
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < nodes.size(); ++i) {
+      nodes[i] = hasher_->ComputeParentHash(nodes[i], row_hashes[i]);
+    }
+  }
+
+  // not owned
+  MatrixMerkleHasher<F, Hash>* hasher_ = nullptr;
+  size_t cap_size_ = 1;
+  mutable std::vector<std::vector<Hash>> digest_layers_;
+  // not owned
+  mutable const std::vector<Matrix>* matrices_ = nullptr;
+};
+
+template <typename F, typename Hash, size_t MaxSize>
+struct VectorCommitmentSchemeTraits<MatrixMerkleTree<F, Hash, MaxSize>> {
+ public:
+  constexpr static size_t kMaxSize = MaxSize;
+  constexpr static bool kIsTransparent = true;
+  constexpr static bool kSupportsBatchMode = false;
+
+  using Field = F;
+  using Commitment = std::vector<Hash>;
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_MATRIX_MERKLE_TREE_MATRIX_MERKLE_TREE_H_
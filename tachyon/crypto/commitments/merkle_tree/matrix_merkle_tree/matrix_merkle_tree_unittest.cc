@@ -0,0 +1,197 @@
+#include "tachyon/crypto/commitments/merkle_tree/matrix_merkle_tree/matrix_merkle_tree.h"
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/crypto/commitments/merkle_tree/matrix_merkle_tree/poseidon2_matrix_merkle_hasher.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+
+namespace tachyon::crypto {
+
+namespace {
+
+using F = math::bn254::Fr;
+
+class MatrixMerkleTreeTest : public testing::Test {
+ public:
+  constexpr static size_t kMaxSize = 64;
+
+  using Tree = MatrixMerkleTree<F, F, kMaxSize>;
+  using Matrix = math::RowMajorMatrix<F>;
+
+  static void SetUpTestSuite() { F::Init(); }
+
+  void SetUp() override {
+    hasher_ = std::make_unique<Poseidon2MatrixMerkleHasher<F>>(
+        Poseidon2Config<F>::CreateCustom(2, 5, 8, 56));
+  }
+
+ protected:
+  static Matrix RandomMatrix(size_t rows, size_t cols) {
+    Matrix ret(rows, cols);
+    for (size_t i = 0; i < rows; ++i) {
+      for (size_t j = 0; j < cols; ++j) {
+        ret(i, j) = F::Random();
+      }
+    }
+    return ret;
+  }
+
+  static std::vector<F> GetRow(const Matrix& matrix, size_t row) {
+    return base::CreateVector(
+        matrix.cols(), [&matrix, row](size_t j) { return matrix(row, j); });
+  }
+
+  std::unique_ptr<Poseidon2MatrixMerkleHasher<F>> hasher_;
+};
+
+}  // namespace
+
+TEST_F(MatrixMerkleTreeTest, ComputeRowHash) {
+  for (size_t width : {0, 1, 2, 3, 5}) {
+    std::vector<F> row =
+        base::CreateVector(width, []() { return F::Random(); });
+    Poseidon2Sponge<F> sponge(hasher_->config());
+    sponge.state[0] = F(width);
+    ASSERT_TRUE(sponge.Absorb(row));
+    EXPECT_EQ(hasher_->ComputeRowHash(row),
+              sponge.SqueezeNativeFieldElements(1)[0]);
+  }
+
+  // More than |kNumLanes| to test the last partial batch.
+  size_t n = Poseidon2MatrixMerkleHasher<F>::kNumLanes + 3;
+  size_t width = 5;
+  std::vector<F> rows =
+      base::CreateVector(n * width, []() { return F::Random(); });
+  std::vector<F> hashes(n);
+  hasher_->ComputeRowHashes(rows, width, absl::MakeSpan(hashes));
+  for (size_t i = 0; i < n; ++i) {
+    EXPECT_EQ(hashes[i],
+              hasher_->ComputeRowHash(
+                  absl::MakeConstSpan(rows).subspan(i * width, width)));
+  }
+}
+
+TEST_F(MatrixMerkleTreeTest, CommitSingleColumn) {
+  // A matrix of a single column is committed in the same way as a vector of
+  // the column with |Poseidon2BinaryMerkleHasher|.
+  Tree tree(hasher_.get());
+  Matrix matrix = RandomMatrix(16, 1);
+  std::vector<Matrix> matrices = {matrix};
+  std::vector<F> cap;
+  ASSERT_TRUE(tree.Commit(matrices, &cap));
+  ASSERT_EQ(cap.size(), size_t{1});
+
+  Poseidon2BinaryMerkleHasher<F> binary_hasher(hasher_->config());
+  std::vector<F> nodes =
+      base::CreateVector(16, [&binary_hasher, &matrix](size_t i) {
+        return binary_hasher.ComputeLeafHash(matrix(i, 0));
+      });
+  while (nodes.size() > 1) {
+    std::vector<F> parents;
+    for (size_t i = 0; i < nodes.size(); i += 2) {
+      parents.push_back(
+          binary_hasher.ComputeParentHash(nodes[i], nodes[i + 1]));
+    }
+    nodes = std::move(parents);
+  }
+  EXPECT_EQ(cap[0], nodes[0]);
+}
+
+TEST_F(MatrixMerkleTreeTest, CommitAndVerify) {
+  // 2 matrices of the largest height, one of which is in the middle, and 2
+  // matrices of the smaller heights.
+  std::vector<Matrix> matrices = {
+      RandomMatrix(32, 3),
+      RandomMatrix(8, 2),
+      RandomMatrix(32, 1),
+      RandomMatrix(4, 4),
+  };
+  MatrixMerkleQuery query;
+  query.heights = {32, 8, 32, 4};
+  query.widths = {3, 2, 1, 4};
+
+  for (size_t cap_size : {1, 4}) {
+    SCOPED_TRACE(cap_size);
+    Tree tree(hasher_.get(), cap_size);
+    std::vector<F> cap;
+    ASSERT_TRUE(tree.Commit(matrices, &cap));
+    ASSERT_EQ(cap.size(), cap_size);
+
+    // Recomputes the tree from the bottom.
+    std::vector<F> nodes =
+        base::CreateVector(32, [this, &matrices](size_t i) {
+          std::vector<F> row = GetRow(matrices[0], i);
+          row.push_back(matrices[2](i, 0));
+          return hasher_->ComputeRowHash(row);
+        });
+    while (nodes.size() > cap_size) {
+      std::vector<F> parents;
+      for (size_t i = 0; i < nodes.size(); i += 2) {
+        parents.push_back(
+            hasher_->ComputeParentHash(nodes[i], nodes[i + 1]));
+      }
+      for (size_t m : {1, 3}) {
+        if (static_cast<size_t>(matrices[m].rows()) == parents.size()) {
+          for (size_t i = 0; i < parents.size(); ++i) {
+            parents[i] = hasher_->ComputeParentHash(
+                parents[i], hasher_->ComputeRowHash(GetRow(matrices[m], i)));
+          }
+        }
+      }
+      nodes = std::move(parents);
+    }
+    EXPECT_EQ(cap, nodes);
+
+    for (size_t index : {0, 13, 31}) {
+      SCOPED_TRACE(index);
+      query.index = index;
+      MatrixMerkleProof<F, F> proof;
+      ASSERT_TRUE(tree.CreateOpeningProof(index, &proof));
+      ASSERT_EQ(proof.rows.size(), matrices.size());
+      EXPECT_EQ(proof.rows[0], GetRow(matrices[0], index));
+      EXPECT_EQ(proof.rows[1], GetRow(matrices[1], index >> 2));
+      EXPECT_EQ(proof.rows[2], GetRow(matrices[2], index));
+      EXPECT_EQ(proof.rows[3], GetRow(matrices[3], index >> 3));
+      EXPECT_EQ(proof.siblings.size(),
+                size_t{5} - base::bits::SafeLog2Ceiling(cap_size));
+      EXPECT_TRUE(tree.VerifyOpeningProof(cap, query, proof));
+
+      MatrixMerkleProof<F, F> invalid_proof = proof;
+      invalid_proof.rows[3][0] += F::One();
+      EXPECT_FALSE(tree.VerifyOpeningProof(cap, query, invalid_proof));
+
+      MatrixMerkleQuery invalid_query = query;
+      invalid_query.index = index ^ 1;
+      EXPECT_FALSE(tree.VerifyOpeningProof(cap, invalid_query, proof));
+
+      // Moves the last column of |matrices[0]| to |matrices[2]|, which is of
+      // the same height. The concatenated row is hashed to the same value.
+      MatrixMerkleProof<F, F> shifted_proof = proof;
+      shifted_proof.rows[2].insert(shifted_proof.rows[2].begin(),
+                                   shifted_proof.rows[0].back());
+      shifted_proof.rows[0].pop_back();
+      EXPECT_FALSE(tree.VerifyOpeningProof(cap, query, shifted_proof));
+    }
+  }
+}
+
+TEST_F(MatrixMerkleTreeTest, InvalidHeights) {
+  Tree tree(hasher_.get(), 4);
+  std::vector<F> cap;
+  std::vector<Matrix> matrices;
+  EXPECT_FALSE(tree.Commit(matrices, &cap));
+  matrices = {RandomMatrix(12, 1)};
+  EXPECT_FALSE(tree.Commit(matrices, &cap));
+  // Shorter than the cap.
+  matrices = {RandomMatrix(16, 1), RandomMatrix(2, 1)};
+  EXPECT_FALSE(tree.Commit(matrices, &cap));
+  // Taller than |kMaxSize|.
+  matrices = {RandomMatrix(2 * kMaxSize, 1)};
+  EXPECT_FALSE(tree.Commit(matrices, &cap));
+}
+
+}  // namespace tachyon::crypto
@@ -0,0 +1,95 @@
+#ifndef TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_MATRIX_MERKLE_TREE_POSEIDON2_MATRIX_MERKLE_HASHER_H_
+#define TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_MATRIX_MERKLE_TREE_POSEIDON2_MATRIX_MERKLE_HASHER_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/crypto/commitments/merkle_tree/binary_merkle_tree/poseidon2_binary_merkle_hasher.h"
+#include "tachyon/crypto/commitments/merkle_tree/matrix_merkle_tree/matrix_merkle_hasher.h"
+#include "tachyon/crypto/hashes/sponge/poseidon2/poseidon2.h"
+
+namespace tachyon::crypto {
+
+// Hashes a row of any width by absorbing it into a |Poseidon2Sponge| whose
+// capacity is initialized with the width and squeezing a single element. The
+// nodes are compressed by |Poseidon2BinaryMerkleHasher|, so a row of a single
+// element is hashed in the same way as a leaf of it.
+template <typename F>
+class Poseidon2MatrixMerkleHasher : public MatrixMerkleHasher<F, F> {
+ public:
+  constexpr static size_t kNumLanes =
+      Poseidon2BinaryMerkleHasher<F>::kNumLanes;
+
+  explicit Poseidon2MatrixMerkleHasher(const Poseidon2Config<F>& config)
+      : compressor_(config) {}
+  explicit Poseidon2MatrixMerkleHasher(Poseidon2Config<F>&& config)
+      : compressor_(std::move(config)) {}
+
+  const Poseidon2Config<F>& config() const { return compressor_.config(); }
+
+  // MatrixMerkleHasher<F, F> methods
+  F ComputeRowHash(absl::Span<const F> row) const override {
+    F ret;
+    ComputeRowHashes(row, row.size(), absl::MakeSpan(&ret, 1));
+    return ret;
+  }
+
+  F ComputeParentHash(const F& left, const F& right) const override {
+    return compressor_.ComputeParentHash(left, right);
+  }
+
+  // Absorbs |kNumLanes| rows at once with |Poseidon2Sponge::PermuteBatch()|.
+  void ComputeRowHashes(absl::Span<const F> rows, size_t width,
+                        absl::Span<F> hashes) const override {
+    DCHECK_EQ(rows.size(), width * hashes.size());
+    const Poseidon2Config<F>& config = compressor_.config();
+    size_t state_width = config.rate + config.capacity;
+    F domain(width);
+    std::vector<F> states;
+    for (size_t from = 0; from < hashes.size(); from += kNumLanes) {
+      size_t num_lanes = std::min(kNumLanes, hashes.size() - from);
+      states.assign(state_width * num_lanes, F::Zero());
+      for (size_t l = 0; l < num_lanes; ++l) {
+        states[l] = domain;
+      }
+      // Permutes after every |config.rate| elements and once more to squeeze,
+      // which is what the sponge does.
+      size_t offset = 0;
+      while (true) {
+        size_t size = std::min(config.rate, width - offset);
+        for (size_t k = 0; k < size; ++k) {
+          F* row = &states[(config.capacity + k) * num_lanes];
+          for (size_t l = 0; l < num_lanes; ++l) {
+            row[l] += rows[(from + l) * width + offset + k];
+          }
+        }
+        Poseidon2Sponge<F>::PermuteBatch(config, absl::MakeSpan(states),
+                                         num_lanes);
+        offset += size;
+        if (offset == width) break;
+      }
+      const F* row = &states[config.capacity * num_lanes];
+      for (size_t l = 0; l < num_lanes; ++l) {
+        hashes[from + l] = row[l];
+      }
+    }
+  }
+
+  void ComputeParentHashes(absl::Span<const F> children,
+                           absl::Span<F> parents) const override {
+    compressor_.ComputeParentHashes(children, parents);
+  }
+
+ private:
+  Poseidon2BinaryMerkleHasher<F> compressor_;
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_COMMITMENTS_MERKLE_TREE_MATRIX_MERKLE_TREE_POSEIDON2_MATRIX_MERKLE_HASHER_H_
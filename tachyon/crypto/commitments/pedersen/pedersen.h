@@ -8,6 +8,7 @@
 
 #include <stddef.h>
 
+#include <atomic>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -15,8 +16,10 @@
 
 #include "tachyon/base/buffer/copyable.h"
 #include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/openmp_util.h"
 #include "tachyon/base/strings/string_util.h"
 #include "tachyon/crypto/commitments/vector_commitment_scheme.h"
+#include "tachyon/math/elliptic_curves/msm/precomputed_bases_msm.h"
 #include "tachyon/math/elliptic_curves/msm/variable_base_msm.h"
 #include "tachyon/math/elliptic_curves/point_conversions.h"
 
@@ -33,14 +36,21 @@ class Pedersen final
   using Field = typename Point::ScalarField;
   using Bucket = typename math::Pippenger<Point>::Bucket;
 
+  // NOTE: The precomputed table takes at least 16 times the
+  // memory of the generators, so it is built only up to this many generators.
+  // Beyond that, the commitments are computed by |VariableBaseMSM|.
+  constexpr static size_t kMaxPrecomputedGenerators = size_t{1} << 16;
+
   Pedersen() = default;
   Pedersen(const Point& h, const std::vector<Point>& generators)
       : h_(h), generators_(generators) {
     CHECK_LE(generators_.size(), MaxSize);
+    Precompute();
   }
   Pedersen(Point&& h, std::vector<Point>&& generators)
       : h_(h), generators_(std::move(generators)) {
     CHECK_LE(generators_.size(), MaxSize);
+    Precompute();
   }
 
   const Point& h() const { return h_; }
@@ -63,6 +73,36 @@ class Pedersen final
     return batch_commitments;
   }
 
+  // Commits to |vs[i]| with a blinding factor |rs[i]| for every i in parallel
+  // and normalizes all the commitments at once. Returns false if the sizes of
+  // |vs| and |rs| don't match or the size of any |vs[i]| doesn't match with
+  // the number of the generators.
+  [[nodiscard]] bool BatchCommit(const std::vector<std::vector<Field>>& vs,
+                                 const std::vector<Field>& rs,
+                                 std::vector<Commitment>* commitments) const {
+    if (vs.size() != rs.size()) {
+      LOG(ERROR) << "Size of |vs| and |rs| do not match";
+      return false;
+    }
+    std::vector<Bucket> results(vs.size());
+    std::atomic<bool> committed = true;
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < vs.size(); ++i) {
+      if (DoMSM(vs[i], &results[i])) {
+        results[i] += math::ConvertPoint<Bucket>(rs[i] * h_);
+      } else {
+        committed.store(false, std::memory_order_relaxed);
+      }
+    }
+    if (!committed.load()) return false;
+    if constexpr (std::is_same_v<Commitment, Bucket>) {
+      *commitments = std::move(results);
+      return true;
+    } else {
+      commitments->resize(results.size());
+      return Bucket::BatchNormalize(results, commitments);
+    }
+  }
+
   // VectorCommitmentScheme methods
   size_t N() const { return generators_.size(); }
 
@@ -83,9 +123,30 @@ class Pedersen final
 
     h_ = Point::Random();
     generators_ = base::CreateVector(size, []() { return Point::Random(); });
+    Precompute();
     return true;
   }
 
+  // Builds the table of |generators_| to commit against them repeatedly.
+  void Precompute() {
+    if (generators_.size() > kMaxPrecomputedGenerators) {
+      precomputed_msm_ = {};
+      return;
+    }
+    precomputed_msm_ = math::PrecomputedBasesMSM<Point>(
+        generators_, math::PrecomputedBasesMSM<Point>::ComputeWindowBits(
+                         generators_.size()));
+  }
+
+  // <|generators_|, |v|>
+  bool DoMSM(const std::vector<Field>& v, Bucket* out) const {
+    if (generators_.size() <= kMaxPrecomputedGenerators) {
+      return precomputed_msm_.Run(v, out);
+    }
+    math::VariableBaseMSM<Point> msm;
+    return msm.Run(generators_, v, out);
+  }
+
   // Pedersen Commitment:
   // clang-format off
   // |h|⋅|r| + <|g|, |v|> = |h|⋅|r| + |g₀|⋅|v₀| + |g₁|⋅|v₁| + ... + |gₙ₋₁|⋅|vₙ₋₁|
@@ -96,9 +157,8 @@ class Pedersen final
   // clang-format on
   bool DoCommit(const std::vector<Field>& v, const Field& r,
                 Commitment* out) const {
-    math::VariableBaseMSM<Point> msm;
     Bucket result;
-    if (!msm.Run(generators_, v, &result)) return false;
+    if (!DoMSM(v, &result)) return false;
     if constexpr (std::is_same_v<Commitment, Bucket>) {
       *out = r * h_ + result;
     } else {
@@ -109,14 +169,14 @@ class Pedersen final
 
   bool DoCommit(const std::vector<Field>& v, const Field& r,
                 BatchCommitmentState& state, size_t index) {
-    math::VariableBaseMSM<Point> msm;
     if (batch_commitments_.size() != state.batch_count)
       batch_commitments_.resize(state.batch_count);
-    return msm.Run(generators_, v, &batch_commitments_[index]);
+    return DoMSM(v, &batch_commitments_[index]);
   }
 
   Point h_;
   std::vector<Point> generators_;
+  math::PrecomputedBasesMSM<Point> precomputed_msm_;
   std::vector<Bucket> batch_commitments_;
 };
 
@@ -72,6 +72,34 @@ TEST_F(PedersenTest, BatchCommitPedersen) {
   EXPECT_EQ(batch_commitments, msm_results);
 }
 
+TEST_F(PedersenTest, BatchCommit) {
+  VCS vcs;
+  ASSERT_TRUE(vcs.Setup());
+
+  size_t num_vectors = 10;
+
+  std::vector<std::vector<math::bn254::Fr>> v_vec =
+      base::CreateVector(num_vectors, []() {
+        return base::CreateVector(kMaxSize,
+                                  []() { return math::bn254::Fr::Random(); });
+      });
+
+  std::vector<math::bn254::Fr> r_vec = base::CreateVector(
+      num_vectors, []() { return math::bn254::Fr::Random(); });
+
+  std::vector<math::bn254::G1JacobianPoint> commitments;
+  ASSERT_FALSE(vcs.BatchCommit(v_vec, std::vector<math::bn254::Fr>(1),
+                               &commitments));
+  ASSERT_TRUE(vcs.BatchCommit(v_vec, r_vec, &commitments));
+  ASSERT_EQ(commitments.size(), num_vectors);
+
+  for (size_t i = 0; i < num_vectors; ++i) {
+    math::bn254::G1JacobianPoint commitment;
+    ASSERT_TRUE(vcs.Commit(v_vec[i], r_vec[i], &commitment));
+    EXPECT_EQ(commitments[i], commitment);
+  }
+}
+
 TEST_F(PedersenTest, Copyable) {
   VCS expected;
   ASSERT_TRUE(expected.Setup());
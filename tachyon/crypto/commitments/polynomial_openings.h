@@ -111,23 +111,28 @@ struct GroupedPolynomialOpenings {
   Poly CombineLowDegreeExtensions(
       const Field& r, const std::vector<Point>& owned_points,
       const std::vector<Poly>& low_degree_extensions) const {
-    // numerators: [P₀(X) - R₀(X), P₁(X) - R₁(X), P₂(X) - R₂(X)]
-    std::vector<Poly> numerators = base::Map(
-        poly_openings_vec,
-        [&low_degree_extensions](
-            size_t i, const PolynomialOpenings<Poly>& poly_openings) {
-          return *poly_openings.poly_oracle - low_degree_extensions[i];
-        });
-
-    // Combine numerator polynomials with powers of |r|.
+    // Combine numerator polynomials with powers of |r| in a single pass
+    // without copying |poly_openings_vec|.
     // N(X) = (P₀(X) - R₀(X)) + r(P₁(X) - R₁(X)) + r²(P₂(X) - R₂(X))
-    Poly& n = Poly::template LinearCombinationInPlace</*forward=*/false>(
-        numerators, r);
+    size_t size = poly_openings_vec.size();
+    std::vector<const Poly*> polys;
+    std::vector<Field> scalars;
+    polys.reserve(2 * size);
+    scalars.reserve(2 * size);
+    Field power = Field::One();
+    for (size_t i = 0; i < size; ++i) {
+      polys.push_back(poly_openings_vec[i].poly_oracle.get());
+      scalars.push_back(power);
+      polys.push_back(&low_degree_extensions[i]);
+      scalars.push_back(-power);
+      power *= r;
+    }
+    Poly n = Poly::WeightedSum(polys, scalars);
 
     // Divide combined polynomial by vanishing polynomial of evaluation points.
     // H(X) = N(X) / (X - x₀)(X - x₁)(X - x₂)
-    Poly vanishing_poly = Poly::FromRoots(owned_points);
-    return n /= vanishing_poly;
+    n.DivByVanishingPolyInPlace(owned_points);
+    return n;
   }
 };
 
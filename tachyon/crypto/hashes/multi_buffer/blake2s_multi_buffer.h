@@ -0,0 +1,189 @@
+#ifndef TACHYON_CRYPTO_HASHES_MULTI_BUFFER_BLAKE2S_MULTI_BUFFER_H_
+#define TACHYON_CRYPTO_HASHES_MULTI_BUFFER_BLAKE2S_MULTI_BUFFER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/crypto/hashes/multi_buffer/multi_buffer_lanes.h"
+
+namespace tachyon::crypto {
+
+// Computes unkeyed BLAKE2s-256 of |NumLanes| messages of the same size at
+// once. Since the sizes are the same, the block counter and the finalization
+// flag are shared by all the lanes and only the message words differ.
+// See https://www.rfc-editor.org/rfc/rfc7693.
+template <size_t NumLanes = GetDefaultNumLanes<uint32_t>()>
+class Blake2sMultiBuffer {
+ public:
+  constexpr static size_t kNumLanes = NumLanes;
+  constexpr static size_t kBlockSize = 64;
+  constexpr static size_t kDigestSize = 32;
+
+  // Hashes the messages of |message_size| bytes laid out contiguously in
+  // |messages| and writes their digests contiguously to |digests|. The number
+  // of the messages is |digests.size() / kDigestSize| and may be greater than
+  // |kNumLanes|.
+  static void Hash(absl::Span<const uint8_t> messages, size_t message_size,
+                   absl::Span<uint8_t> digests) {
+    DCHECK_EQ(digests.size() % kDigestSize, size_t{0});
+    size_t num_messages = digests.size() / kDigestSize;
+    DCHECK_EQ(messages.size(), num_messages * message_size);
+    for (size_t i = 0; i < num_messages; i += kNumLanes) {
+      HashLanes(messages.data() + i * message_size, message_size,
+                std::min(kNumLanes, num_messages - i),
+                digests.data() + i * kDigestSize);
+    }
+  }
+
+ private:
+  using Lanes = uint32_t[kNumLanes];
+
+  constexpr static uint32_t kIV[8] = {
+      0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+      0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19,
+  };
+
+  constexpr static uint8_t kSigma[10][16] = {
+      {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+      {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3},
+      {11, 8, 12, 0, 5, 2, 15, 13, 10, 14, 3, 6, 7, 1, 9, 4},
+      {7, 9, 3, 1, 13, 12, 11, 14, 2, 6, 5, 10, 4, 0, 15, 8},
+      {9, 0, 5, 7, 2, 4, 10, 15, 14, 1, 11, 12, 6, 8, 3, 13},
+      {2, 12, 6, 10, 0, 11, 8, 3, 4, 13, 7, 5, 15, 14, 1, 9},
+      {12, 5, 1, 15, 14, 13, 4, 10, 0, 7, 6, 3, 9, 2, 8, 11},
+      {13, 11, 7, 14, 12, 1, 3, 9, 5, 0, 15, 4, 8, 6, 2, 10},
+      {6, 15, 14, 9, 11, 3, 0, 8, 12, 2, 13, 7, 1, 4, 10, 5},
+      {10, 2, 8, 4, 7, 6, 1, 5, 15, 11, 9, 14, 3, 12, 13, 0},
+  };
+
+  static uint32_t RotateRight(uint32_t x, uint32_t n) {
+    return (x >> n) | (x << (32 - n));
+  }
+
+  static uint32_t LoadLittleEndian(const uint8_t* src) {
+    return uint32_t{src[0]} | (uint32_t{src[1]} << 8) |
+           (uint32_t{src[2]} << 16) | (uint32_t{src[3]} << 24);
+  }
+
+  static void StoreLittleEndian(uint32_t value, uint8_t* dst) {
+    dst[0] = static_cast<uint8_t>(value);
+    dst[1] = static_cast<uint8_t>(value >> 8);
+    dst[2] = static_cast<uint8_t>(value >> 16);
+    dst[3] = static_cast<uint8_t>(value >> 24);
+  }
+
+  // Returns the |index|-th block of |message| padded with zeros. The block is
+  // copied to |buffer| only if it is shorter than |kBlockSize|.
+  static const uint8_t* GetPaddedBlock(const uint8_t* message,
+                                       size_t message_size, size_t index,
+                                       uint8_t* buffer) {
+    size_t offset = index * kBlockSize;
+    if (offset + kBlockSize <= message_size) return message + offset;
+
+    size_t remaining = message_size - offset;
+    memset(buffer, 0, kBlockSize);
+    if (remaining > 0) memcpy(buffer, message + offset, remaining);
+    return buffer;
+  }
+
+  static void HashLanes(const uint8_t* messages, size_t message_size,
+                        size_t num_lanes, uint8_t* digests) {
+    Lanes h[8];
+    for (size_t i = 0; i < 8; ++i) {
+      for (size_t l = 0; l < kNumLanes; ++l) {
+        h[i][l] = kIV[i];
+      }
+    }
+    // Sets the parameter block: a digest of 32 bytes without a key and
+    // sequential mode, i.e., fanout and depth of 1.
+    for (size_t l = 0; l < kNumLanes; ++l) {
+      h[0][l] ^= 0x01010000 ^ kDigestSize;
+    }
+
+    // An empty message is hashed as a single block of zeros.
+    size_t num_blocks =
+        std::max(size_t{1}, (message_size + kBlockSize - 1) / kBlockSize);
+    Lanes m[16];
+    uint8_t buffer[kBlockSize];
+    for (size_t b = 0; b < num_blocks; ++b) {
+      for (size_t l = 0; l < kNumLanes; ++l) {
+        const uint8_t* message =
+            messages + (l < num_lanes ? l : 0) * message_size;
+        const uint8_t* block =
+            GetPaddedBlock(message, message_size, b, buffer);
+        for (size_t i = 0; i < 16; ++i) {
+          m[i][l] = LoadLittleEndian(block + 4 * i);
+        }
+      }
+      bool is_last = b == num_blocks - 1;
+      uint64_t counter =
+          is_last ? uint64_t{message_size} : uint64_t{(b + 1) * kBlockSize};
+      Compress(m, counter, is_last, h);
+    }
+
+    for (size_t l = 0; l < num_lanes; ++l) {
+      for (size_t i = 0; i < 8; ++i) {
+        StoreLittleEndian(h[i][l], digests + l * kDigestSize + 4 * i);
+      }
+    }
+  }
+
+  // Mixes |x| and |y| into |a|, |b|, |c| and |d| of every lane.
+  static void G(Lanes& a, Lanes& b, Lanes& c, Lanes& d, const Lanes& x,
+                const Lanes& y) {
+    for (size_t l = 0; l < kNumLanes; ++l) {
+      a[l] += b[l] + x[l];
+      d[l] = RotateRight(d[l] ^ a[l], 16);
+      c[l] += d[l];
+      b[l] = RotateRight(b[l] ^ c[l], 12);
+      a[l] += b[l] + y[l];
+      d[l] = RotateRight(d[l] ^ a[l], 8);
+      c[l] += d[l];
+      b[l] = RotateRight(b[l] ^ c[l], 7);
+    }
+  }
+
+  static void Compress(const Lanes* m, uint64_t counter, bool is_last,
+                       Lanes* h) {
+    Lanes v[16];
+    for (size_t i = 0; i < 8; ++i) {
+      for (size_t l = 0; l < kNumLanes; ++l) {
+        v[i][l] = h[i][l];
+        v[i + 8][l] = kIV[i];
+      }
+    }
+    for (size_t l = 0; l < kNumLanes; ++l) {
+      v[12][l] ^= static_cast<uint32_t>(counter);
+      v[13][l] ^= static_cast<uint32_t>(counter >> 32);
+      if (is_last) v[14][l] = ~v[14][l];
+    }
+
+    for (size_t round = 0; round < 10; ++round) {
+      const uint8_t* s = kSigma[round];
+      G(v[0], v[4], v[8], v[12], m[s[0]], m[s[1]]);
+      G(v[1], v[5], v[9], v[13], m[s[2]], m[s[3]]);
+      G(v[2], v[6], v[10], v[14], m[s[4]], m[s[5]]);
+      G(v[3], v[7], v[11], v[15], m[s[6]], m[s[7]]);
+      G(v[0], v[5], v[10], v[15], m[s[8]], m[s[9]]);
+      G(v[1], v[6], v[11], v[12], m[s[10]], m[s[11]]);
+      G(v[2], v[7], v[8], v[13], m[s[12]], m[s[13]]);
+      G(v[3], v[4], v[9], v[14], m[s[14]], m[s[15]]);
+    }
+
+    for (size_t i = 0; i < 8; ++i) {
+      for (size_t l = 0; l < kNumLanes; ++l) {
+        h[i][l] ^= v[i][l] ^ v[i + 8][l];
+      }
+    }
+  }
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_HASHES_MULTI_BUFFER_BLAKE2S_MULTI_BUFFER_H_
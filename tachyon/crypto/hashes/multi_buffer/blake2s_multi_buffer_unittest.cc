@@ -0,0 +1,69 @@
+#include "tachyon/crypto/hashes/multi_buffer/blake2s_multi_buffer.h"
+
+#include <string_view>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/random.h"
+#include "tachyon/base/strings/string_number_conversions.h"
+
+namespace tachyon::crypto {
+
+namespace {
+
+std::string HashToHex(std::string_view message) {
+  std::vector<uint8_t> digest(Blake2sMultiBuffer<>::kDigestSize);
+  Blake2sMultiBuffer<>::Hash(
+      absl::MakeConstSpan(reinterpret_cast<const uint8_t*>(message.data()),
+                          message.size()),
+      message.size(), absl::MakeSpan(digest));
+  return base::HexEncode(digest, /*use_lower_case=*/true);
+}
+
+}  // namespace
+
+TEST(Blake2sMultiBufferTest, KnownAnswers) {
+  struct {
+    std::string_view message;
+    std::string_view digest;
+  } tests[] = {
+      {"",
+       "69217a3079908094e11121d042354a7c1f55b6482ca1a51e1b250dfd1ed0eef9"},
+      {"abc",
+       "508c5e8c327c14e2e1a72ba34eeb452f37458b209ed63a294d999b4c86675982"},
+  };
+
+  for (const auto& test : tests) {
+    EXPECT_EQ(HashToHex(test.message), test.digest);
+  }
+}
+
+TEST(Blake2sMultiBufferTest, Hash) {
+  // The number of the lanes is fixed regardless of the SIMD extensions.
+  using Hasher = Blake2sMultiBuffer<4>;
+  // More than |kNumLanes| to test the last partial batch.
+  size_t num_messages = Hasher::kNumLanes + 3;
+
+  for (size_t message_size : {size_t{0}, size_t{64}, size_t{200}}) {
+    std::vector<uint8_t> messages =
+        base::CreateVector(num_messages * message_size, []() {
+          return base::Uniform(base::Range<uint8_t>::All());
+        });
+    std::vector<uint8_t> digests(num_messages * Hasher::kDigestSize);
+    Hasher::Hash(messages, message_size, absl::MakeSpan(digests));
+
+    for (size_t i = 0; i < num_messages; ++i) {
+      std::vector<uint8_t> expected(Hasher::kDigestSize);
+      Blake2sMultiBuffer<1>::Hash(
+          absl::MakeConstSpan(messages).subspan(i * message_size, message_size),
+          message_size, absl::MakeSpan(expected));
+      EXPECT_EQ(absl::MakeConstSpan(digests).subspan(i * Hasher::kDigestSize,
+                                                     Hasher::kDigestSize),
+                absl::MakeConstSpan(expected));
+    }
+  }
+}
+
+}  // namespace tachyon::crypto
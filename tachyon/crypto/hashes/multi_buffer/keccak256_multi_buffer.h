@@ -0,0 +1,224 @@
+#ifndef TACHYON_CRYPTO_HASHES_MULTI_BUFFER_KECCAK256_MULTI_BUFFER_H_
+#define TACHYON_CRYPTO_HASHES_MULTI_BUFFER_KECCAK256_MULTI_BUFFER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <utility>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/crypto/hashes/multi_buffer/multi_buffer_lanes.h"
+
+namespace tachyon::crypto {
+
+// NOTE: SSE has no 64-bit rotation, so 2 lanes on SSE are slower
+// than a scalar lane, which rotates with a single instruction. The lanes are
+// used only if AVX2 or AVX-512 is enabled.
+constexpr size_t GetDefaultKeccakNumLanes() {
+  constexpr size_t kNumLanes = GetDefaultNumLanes<uint64_t>();
+  return kNumLanes > 2 ? kNumLanes : 1;
+}
+
+// Computes Keccak-256 of |NumLanes| messages of the same size at once by
+// running Keccak-f[1600] in lockstep over all the lanes. This is the variant
+// used by Ethereum, which pads with 0x01 instead of 0x06 of SHA3-256.
+// See https://keccak.team/keccak_specs_summary.html.
+template <size_t NumLanes = GetDefaultKeccakNumLanes()>
+class Keccak256MultiBuffer {
+ public:
+  constexpr static size_t kNumLanes = NumLanes;
+  // The rate is 1600 - 2 * 256 bits.
+  constexpr static size_t kBlockSize = 136;
+  constexpr static size_t kDigestSize = 32;
+
+  // Hashes the messages of |message_size| bytes laid out contiguously in
+  // |messages| and writes their digests contiguously to |digests|. The number
+  // of the messages is |digests.size() / kDigestSize| and may be greater than
+  // |kNumLanes|.
+  static void Hash(absl::Span<const uint8_t> messages, size_t message_size,
+                   absl::Span<uint8_t> digests) {
+    DCHECK_EQ(digests.size() % kDigestSize, size_t{0});
+    size_t num_messages = digests.size() / kDigestSize;
+    DCHECK_EQ(messages.size(), num_messages * message_size);
+    for (size_t i = 0; i < num_messages; i += kNumLanes) {
+      HashLanes(messages.data() + i * message_size, message_size,
+                std::min(kNumLanes, num_messages - i),
+                digests.data() + i * kDigestSize);
+    }
+  }
+
+ private:
+  using Lanes = uint64_t[kNumLanes];
+
+  constexpr static uint64_t kRoundConstants[24] = {
+      0x0000000000000001, 0x0000000000008082, 0x800000000000808a,
+      0x8000000080008000, 0x000000000000808b, 0x0000000080000001,
+      0x8000000080008081, 0x8000000000008009, 0x000000000000008a,
+      0x0000000000000088, 0x0000000080008009, 0x000000008000000a,
+      0x000000008000808b, 0x800000000000008b, 0x8000000000008089,
+      0x8000000000008003, 0x8000000000008002, 0x8000000000000080,
+      0x000000000000800a, 0x800000008000000a, 0x8000000080008081,
+      0x8000000000008080, 0x0000000080000001, 0x8000000080008008,
+  };
+
+  // The rotation offsets of ρ indexed by x + 5y.
+  constexpr static uint32_t kRotations[25] = {
+      0,  1,  62, 28, 27, 36, 44, 6,  55, 20, 3,  10, 43,
+      25, 39, 41, 45, 15, 21, 8,  18, 2,  61, 56, 14,
+  };
+
+  // The destinations of π indexed by x + 5y, i.e., y + 5((2x + 3y) mod 5).
+  constexpr static size_t kPiDestinations[25] = {
+      0,  10, 20, 5,  15, 16, 1,  11, 21, 6,  7,  17, 2,
+      12, 22, 23, 8,  18, 3,  13, 14, 24, 9,  19, 4,
+  };
+
+  template <uint32_t N>
+  static uint64_t RotateLeft(uint64_t x) {
+    if constexpr (N == 0) {
+      return x;
+    } else {
+      return (x << N) | (x >> (64 - N));
+    }
+  }
+
+  static uint64_t LoadLittleEndian(const uint8_t* src) {
+    uint64_t ret = 0;
+    for (size_t i = 0; i < 8; ++i) {
+      ret |= uint64_t{src[i]} << (8 * i);
+    }
+    return ret;
+  }
+
+  static void StoreLittleEndian(uint64_t value, uint8_t* dst) {
+    for (size_t i = 0; i < 8; ++i) {
+      dst[i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+  }
+
+  // Returns the |index|-th block of |message| after padding. The block is
+  // copied to |buffer| only if it contains the padding.
+  static const uint8_t* GetPaddedBlock(const uint8_t* message,
+                                       size_t message_size, size_t index,
+                                       uint8_t* buffer) {
+    size_t offset = index * kBlockSize;
+    if (offset + kBlockSize <= message_size) return message + offset;
+
+    // Since the padding takes at least a byte, the last block always
+    // contains the rest of the message.
+    size_t remaining = message_size - offset;
+    memset(buffer, 0, kBlockSize);
+    if (remaining > 0) memcpy(buffer, message + offset, remaining);
+    buffer[remaining] |= 0x01;
+    buffer[kBlockSize - 1] |= 0x80;
+    return buffer;
+  }
+
+  static void HashLanes(const uint8_t* messages, size_t message_size,
+                        size_t num_lanes, uint8_t* digests) {
+    Lanes state[25] = {};
+    size_t num_blocks = message_size / kBlockSize + 1;
+    uint8_t buffer[kBlockSize];
+    for (size_t b = 0; b < num_blocks; ++b) {
+      for (size_t l = 0; l < kNumLanes; ++l) {
+        const uint8_t* message =
+            messages + (l < num_lanes ? l : 0) * message_size;
+        const uint8_t* block =
+            GetPaddedBlock(message, message_size, b, buffer);
+        for (size_t i = 0; i < kBlockSize / 8; ++i) {
+          state[i][l] ^= LoadLittleEndian(block + 8 * i);
+        }
+      }
+      Permute(state);
+    }
+
+    for (size_t l = 0; l < num_lanes; ++l) {
+      for (size_t i = 0; i < kDigestSize / 8; ++i) {
+        StoreLittleEndian(state[i][l], digests + l * kDigestSize + 8 * i);
+      }
+    }
+  }
+
+  template <size_t X>
+  static void ComputeColumnParity(const Lanes* state, Lanes* c) {
+    for (size_t l = 0; l < kNumLanes; ++l) {
+      c[X][l] = state[X][l] ^ state[X + 5][l] ^ state[X + 10][l] ^
+                state[X + 15][l] ^ state[X + 20][l];
+    }
+  }
+
+  template <size_t X>
+  static void AddColumnParity(const Lanes* c, Lanes* state) {
+    for (size_t l = 0; l < kNumLanes; ++l) {
+      uint64_t d = c[(X + 4) % 5][l] ^ RotateLeft<1>(c[(X + 1) % 5][l]);
+      state[X][l] ^= d;
+      state[X + 5][l] ^= d;
+      state[X + 10][l] ^= d;
+      state[X + 15][l] ^= d;
+      state[X + 20][l] ^= d;
+    }
+  }
+
+  // Applies θ. The steps are unrolled so that every index is a constant.
+  template <size_t... X>
+  static void ApplyTheta(Lanes* state, Lanes* c, std::index_sequence<X...>) {
+    (ComputeColumnParity<X>(state, c), ...);
+    (AddColumnParity<X>(c, state), ...);
+  }
+
+  template <size_t I>
+  static void RotateAndMove(const Lanes* state, Lanes* b) {
+    for (size_t l = 0; l < kNumLanes; ++l) {
+      b[kPiDestinations[I]][l] = RotateLeft<kRotations[I]>(state[I][l]);
+    }
+  }
+
+  // Applies ρ and π. The steps are unrolled so that every rotation is by a
+  // constant.
+  template <size_t... I>
+  static void ApplyRhoAndPi(const Lanes* state, Lanes* b,
+                            std::index_sequence<I...>) {
+    (RotateAndMove<I>(state, b), ...);
+  }
+
+  template <size_t I>
+  static void ChiStep(const Lanes* b, Lanes* state) {
+    constexpr size_t kX = I % 5;
+    constexpr size_t kY = I - kX;
+    for (size_t l = 0; l < kNumLanes; ++l) {
+      state[I][l] =
+          b[I][l] ^ (~b[kY + (kX + 1) % 5][l] & b[kY + (kX + 2) % 5][l]);
+    }
+  }
+
+  // Applies χ. The steps are unrolled so that every index is a constant.
+  template <size_t... I>
+  static void ApplyChi(const Lanes* b, Lanes* state,
+                       std::index_sequence<I...>) {
+    (ChiStep<I>(b, state), ...);
+  }
+
+  // Applies Keccak-f[1600] to every lane. The state is indexed by x + 5y.
+  static void Permute(Lanes* state) {
+    Lanes c[5];
+    Lanes b[25];
+    for (size_t round = 0; round < 24; ++round) {
+      ApplyTheta(state, c, std::make_index_sequence<5>());
+      // B[y, 2x + 3y] = rot(A[x, y], r[x, y])
+      ApplyRhoAndPi(state, b, std::make_index_sequence<25>());
+      ApplyChi(b, state, std::make_index_sequence<25>());
+      // ι
+      for (size_t l = 0; l < kNumLanes; ++l) {
+        state[0][l] ^= kRoundConstants[round];
+      }
+    }
+  }
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_HASHES_MULTI_BUFFER_KECCAK256_MULTI_BUFFER_H_
@@ -0,0 +1,101 @@
+#include "tachyon/crypto/hashes/multi_buffer/keccak256_multi_buffer.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/random.h"
+#include "tachyon/base/strings/string_number_conversions.h"
+
+namespace tachyon::crypto {
+
+namespace {
+
+std::string HashToHex(std::string_view message) {
+  std::vector<uint8_t> digest(Keccak256MultiBuffer<>::kDigestSize);
+  Keccak256MultiBuffer<>::Hash(
+      absl::MakeConstSpan(reinterpret_cast<const uint8_t*>(message.data()),
+                          message.size()),
+      message.size(), absl::MakeSpan(digest));
+  return base::HexEncode(digest, /*use_lower_case=*/true);
+}
+
+}  // namespace
+
+TEST(Keccak256MultiBufferTest, KnownAnswers) {
+  struct {
+    std::string_view message;
+    std::string_view digest;
+  } tests[] = {
+      {"",
+       "c5d2460186f7233c927e7db2dcc703c0e500b653ca82273b7bfad8045d85a470"},
+      {"abc",
+       "4e03657aea45a94fc7d47ba826c8d667c0d1e6e33a64a036ec44f58fa12d6c45"},
+      {"The quick brown fox jumps over the lazy dog",
+       "4d741b6f1eb29cb2a9b9911c82f56fa8d73b04959d3d9d222895df6c0b28aa15"},
+  };
+
+  for (const auto& test : tests) {
+    EXPECT_EQ(HashToHex(test.message), test.digest);
+  }
+}
+
+TEST(Keccak256MultiBufferTest, KnownAnswersAtRateBoundaries) {
+  // The rate of Keccak-256 is 136 bytes. A message of 135 bytes is padded
+  // with a single byte 0x81, a message of 136 bytes is followed by a block of
+  // padding only and the other messages span multiple blocks. Every message
+  // is the lowercase alphabet repeated up to |size|.
+  struct {
+    size_t size;
+    std::string_view digest;
+  } tests[] = {
+      {135,
+       "8d237f5df8929398beb5240705b61f6c35b8e03a02fa7d691701f356facafb16"},
+      {136,
+       "b98753581a7e73d753e1863f91847255c9a0dc6d4f751cbe191e70ce272a3565"},
+      {272,
+       "2b0ea46cfb00cf48974dc4c219cd38840fe4ad17c810042b2124466850180160"},
+      {300,
+       "5208eae4d1b18a827690de04c51656186bde5137d13950f9069add8853c0c6af"},
+  };
+
+  for (const auto& test : tests) {
+    SCOPED_TRACE(test.size);
+    std::string message(test.size, '\0');
+    for (size_t i = 0; i < test.size; ++i) {
+      message[i] = 'a' + i % 26;
+    }
+    EXPECT_EQ(HashToHex(message), test.digest);
+  }
+}
+
+TEST(Keccak256MultiBufferTest, Hash) {
+  // The number of the lanes is fixed regardless of the SIMD extensions.
+  using Hasher = Keccak256MultiBuffer<4>;
+  // More than |kNumLanes| to test the last partial batch.
+  size_t num_messages = Hasher::kNumLanes + 3;
+
+  for (size_t message_size : {size_t{0}, size_t{64}, size_t{200}}) {
+    std::vector<uint8_t> messages =
+        base::CreateVector(num_messages * message_size, []() {
+          return base::Uniform(base::Range<uint8_t>::All());
+        });
+    std::vector<uint8_t> digests(num_messages * Hasher::kDigestSize);
+    Hasher::Hash(messages, message_size, absl::MakeSpan(digests));
+
+    for (size_t i = 0; i < num_messages; ++i) {
+      std::vector<uint8_t> expected(Hasher::kDigestSize);
+      Keccak256MultiBuffer<1>::Hash(
+          absl::MakeConstSpan(messages).subspan(i * message_size, message_size),
+          message_size, absl::MakeSpan(expected));
+      EXPECT_EQ(absl::MakeConstSpan(digests).subspan(i * Hasher::kDigestSize,
+                                                     Hasher::kDigestSize),
+                absl::MakeConstSpan(expected));
+    }
+  }
+}
+
+}  // namespace tachyon::crypto
@@ -0,0 +1,33 @@
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "tachyon/crypto/hashes/multi_buffer/blake2s_multi_buffer.h"
+#include "tachyon/crypto/hashes/multi_buffer/keccak256_multi_buffer.h"
+#include "tachyon/crypto/hashes/multi_buffer/sha256_multi_buffer.h"
+
+namespace tachyon::crypto {
+
+// Hashes 1024 messages of 64 bytes, which is what a level of a binary merkle
+// tree of byte digests hashes. A single lane is the baseline.
+template <typename Hasher>
+void BM_MultiBufferHash(benchmark::State& state) {
+  constexpr size_t kNumMessages = 1024;
+  constexpr size_t kMessageSize = 64;
+  std::vector<uint8_t> messages(kNumMessages * kMessageSize, 0x5a);
+  std::vector<uint8_t> digests(kNumMessages * Hasher::kDigestSize);
+  for (auto _ : state) {
+    Hasher::Hash(messages, kMessageSize, absl::MakeSpan(digests));
+  }
+  benchmark::DoNotOptimize(digests);
+  state.SetItemsProcessed(state.iterations() * kNumMessages);
+}
+
+BENCHMARK_TEMPLATE(BM_MultiBufferHash, Sha256MultiBuffer<1>);
+BENCHMARK_TEMPLATE(BM_MultiBufferHash, Sha256MultiBuffer<>);
+BENCHMARK_TEMPLATE(BM_MultiBufferHash, Keccak256MultiBuffer<1>);
+BENCHMARK_TEMPLATE(BM_MultiBufferHash, Keccak256MultiBuffer<>);
+BENCHMARK_TEMPLATE(BM_MultiBufferHash, Blake2sMultiBuffer<1>);
+BENCHMARK_TEMPLATE(BM_MultiBufferHash, Blake2sMultiBuffer<>);
+
+}  // namespace tachyon::crypto
@@ -0,0 +1,27 @@
+#ifndef TACHYON_CRYPTO_HASHES_MULTI_BUFFER_MULTI_BUFFER_LANES_H_
+#define TACHYON_CRYPTO_HASHES_MULTI_BUFFER_MULTI_BUFFER_LANES_H_
+
+#include <stddef.h>
+
+namespace tachyon::crypto {
+
+// Returns the number of |Word|s that fit in the widest SIMD register enabled
+// at compile time. A multi-buffer hash stores the i-th word of the state of
+// every message contiguously, so that a round step over all the lanes maps to
+// a single SIMD instruction. Build with --config avx2_linux or
+// --config avx512_linux to widen the lanes.
+template <typename Word>
+constexpr size_t GetDefaultNumLanes() {
+#if defined(__AVX512F__)
+  constexpr size_t kSimdWidthInBytes = 64;
+#elif defined(__AVX2__)
+  constexpr size_t kSimdWidthInBytes = 32;
+#else
+  constexpr size_t kSimdWidthInBytes = 16;
+#endif
+  return kSimdWidthInBytes / sizeof(Word);
+}
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_HASHES_MULTI_BUFFER_MULTI_BUFFER_LANES_H_
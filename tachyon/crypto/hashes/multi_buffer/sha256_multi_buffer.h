@@ -0,0 +1,193 @@
+#ifndef TACHYON_CRYPTO_HASHES_MULTI_BUFFER_SHA256_MULTI_BUFFER_H_
+#define TACHYON_CRYPTO_HASHES_MULTI_BUFFER_SHA256_MULTI_BUFFER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/crypto/hashes/multi_buffer/multi_buffer_lanes.h"
+
+namespace tachyon::crypto {
+
+// Computes SHA-256 of |NumLanes| messages of the same size at once. Since the
+// sizes are the same, every message is padded into the same number of blocks
+// and the compression function runs in lockstep over all the lanes.
+// See https://nvlpubs.nist.gov/nistpubs/FIPS/NIST.FIPS.180-4.pdf.
+template <size_t NumLanes = GetDefaultNumLanes<uint32_t>()>
+class Sha256MultiBuffer {
+ public:
+  constexpr static size_t kNumLanes = NumLanes;
+  constexpr static size_t kBlockSize = 64;
+  constexpr static size_t kDigestSize = 32;
+
+  // Hashes the messages of |message_size| bytes laid out contiguously in
+  // |messages| and writes their digests contiguously to |digests|. The number
+  // of the messages is |digests.size() / kDigestSize| and may be greater than
+  // |kNumLanes|.
+  static void Hash(absl::Span<const uint8_t> messages, size_t message_size,
+                   absl::Span<uint8_t> digests) {
+    DCHECK_EQ(digests.size() % kDigestSize, size_t{0});
+    size_t num_messages = digests.size() / kDigestSize;
+    DCHECK_EQ(messages.size(), num_messages * message_size);
+    for (size_t i = 0; i < num_messages; i += kNumLanes) {
+      HashLanes(messages.data() + i * message_size, message_size,
+                std::min(kNumLanes, num_messages - i),
+                digests.data() + i * kDigestSize);
+    }
+  }
+
+ private:
+  using Lanes = uint32_t[kNumLanes];
+
+  constexpr static uint32_t kInitialState[8] = {
+      0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+      0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19,
+  };
+
+  constexpr static uint32_t kRoundConstants[64] = {
+      0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
+      0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+      0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786,
+      0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+      0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
+      0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+      0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+      0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+      0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a,
+      0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+      0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+  };
+
+  static uint32_t RotateRight(uint32_t x, uint32_t n) {
+    return (x >> n) | (x << (32 - n));
+  }
+
+  static uint32_t LoadBigEndian(const uint8_t* src) {
+    return (uint32_t{src[0]} << 24) | (uint32_t{src[1]} << 16) |
+           (uint32_t{src[2]} << 8) | uint32_t{src[3]};
+  }
+
+  static void StoreBigEndian(uint32_t value, uint8_t* dst) {
+    dst[0] = static_cast<uint8_t>(value >> 24);
+    dst[1] = static_cast<uint8_t>(value >> 16);
+    dst[2] = static_cast<uint8_t>(value >> 8);
+    dst[3] = static_cast<uint8_t>(value);
+  }
+
+  // Returns the |index|-th block of |message| after padding. The block is
+  // copied to |buffer| only if it contains the padding.
+  static const uint8_t* GetPaddedBlock(const uint8_t* message,
+                                       size_t message_size, size_t num_blocks,
+                                       size_t index, uint8_t* buffer) {
+    size_t offset = index * kBlockSize;
+    if (offset + kBlockSize <= message_size) return message + offset;
+
+    memset(buffer, 0, kBlockSize);
+    if (offset <= message_size) {
+      size_t remaining = message_size - offset;
+      if (remaining > 0) memcpy(buffer, message + offset, remaining);
+      buffer[remaining] = 0x80;
+    }
+    if (index == num_blocks - 1) {
+      uint64_t num_bits = uint64_t{message_size} * 8;
+      StoreBigEndian(static_cast<uint32_t>(num_bits >> 32), buffer + 56);
+      StoreBigEndian(static_cast<uint32_t>(num_bits), buffer + 60);
+    }
+    return buffer;
+  }
+
+  // Hashes |num_lanes| messages. The unused lanes hash the first message
+  // again and their digests are dropped.
+  static void HashLanes(const uint8_t* messages, size_t message_size,
+                        size_t num_lanes, uint8_t* digests) {
+    Lanes state[8];
+    for (size_t i = 0; i < 8; ++i) {
+      for (size_t l = 0; l < kNumLanes; ++l) {
+        state[i][l] = kInitialState[i];
+      }
+    }
+
+    // The padding adds a byte of 0x80 and 8 bytes of the length in bits.
+    size_t num_blocks = (message_size + 9 + kBlockSize - 1) / kBlockSize;
+    Lanes schedule[64];
+    uint8_t buffer[kBlockSize];
+    for (size_t b = 0; b < num_blocks; ++b) {
+      for (size_t l = 0; l < kNumLanes; ++l) {
+        const uint8_t* message =
+            messages + (l < num_lanes ? l : 0) * message_size;
+        const uint8_t* block =
+            GetPaddedBlock(message, message_size, num_blocks, b, buffer);
+        for (size_t i = 0; i < 16; ++i) {
+          schedule[i][l] = LoadBigEndian(block + 4 * i);
+        }
+      }
+      Compress(schedule, state);
+    }
+
+    for (size_t l = 0; l < num_lanes; ++l) {
+      for (size_t i = 0; i < 8; ++i) {
+        StoreBigEndian(state[i][l], digests + l * kDigestSize + 4 * i);
+      }
+    }
+  }
+
+  // Runs a round on every lane. Instead of shifting the working variables,
+  // the callers rotate the roles of them, so only |d| and |h| are updated.
+  static void Round(const Lanes& a, const Lanes& b, const Lanes& c, Lanes& d,
+                    const Lanes& e, const Lanes& f, const Lanes& g, Lanes& h,
+                    uint32_t k, const Lanes& w) {
+    for (size_t l = 0; l < kNumLanes; ++l) {
+      uint32_t s1 =
+          RotateRight(e[l], 6) ^ RotateRight(e[l], 11) ^ RotateRight(e[l], 25);
+      uint32_t ch = (e[l] & f[l]) ^ (~e[l] & g[l]);
+      uint32_t t1 = h[l] + s1 + ch + k + w[l];
+      uint32_t s0 =
+          RotateRight(a[l], 2) ^ RotateRight(a[l], 13) ^ RotateRight(a[l], 22);
+      uint32_t maj = (a[l] & b[l]) ^ (a[l] & c[l]) ^ (b[l] & c[l]);
+      d[l] += t1;
+      h[l] = t1 + s0 + maj;
+    }
+  }
+
+  // Expands the first 16 words of |schedule| and compresses it into |state|.
+  static void Compress(Lanes* schedule, Lanes* state) {
+    for (size_t i = 16; i < 64; ++i) {
+      for (size_t l = 0; l < kNumLanes; ++l) {
+        uint32_t w15 = schedule[i - 15][l];
+        uint32_t w2 = schedule[i - 2][l];
+        uint32_t s0 = RotateRight(w15, 7) ^ RotateRight(w15, 18) ^ (w15 >> 3);
+        uint32_t s1 = RotateRight(w2, 17) ^ RotateRight(w2, 19) ^ (w2 >> 10);
+        schedule[i][l] = schedule[i - 16][l] + s0 + schedule[i - 7][l] + s1;
+      }
+    }
+
+    Lanes v[8];
+    memcpy(v, state, sizeof(v));
+    for (size_t i = 0; i < 64; i += 8) {
+      const uint32_t* k = &kRoundConstants[i];
+      const Lanes* w = &schedule[i];
+      Round(v[0], v[1], v[2], v[3], v[4], v[5], v[6], v[7], k[0], w[0]);
+      Round(v[7], v[0], v[1], v[2], v[3], v[4], v[5], v[6], k[1], w[1]);
+      Round(v[6], v[7], v[0], v[1], v[2], v[3], v[4], v[5], k[2], w[2]);
+      Round(v[5], v[6], v[7], v[0], v[1], v[2], v[3], v[4], k[3], w[3]);
+      Round(v[4], v[5], v[6], v[7], v[0], v[1], v[2], v[3], k[4], w[4]);
+      Round(v[3], v[4], v[5], v[6], v[7], v[0], v[1], v[2], k[5], w[5]);
+      Round(v[2], v[3], v[4], v[5], v[6], v[7], v[0], v[1], k[6], w[6]);
+      Round(v[1], v[2], v[3], v[4], v[5], v[6], v[7], v[0], k[7], w[7]);
+    }
+    for (size_t i = 0; i < 8; ++i) {
+      for (size_t l = 0; l < kNumLanes; ++l) {
+        state[i][l] += v[i][l];
+      }
+    }
+  }
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_HASHES_MULTI_BUFFER_SHA256_MULTI_BUFFER_H_
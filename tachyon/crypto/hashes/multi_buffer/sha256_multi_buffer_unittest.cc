@@ -0,0 +1,71 @@
+#include "tachyon/crypto/hashes/multi_buffer/sha256_multi_buffer.h"
+
+#include <string_view>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/random.h"
+#include "tachyon/base/strings/string_number_conversions.h"
+
+namespace tachyon::crypto {
+
+namespace {
+
+std::string HashToHex(std::string_view message) {
+  std::vector<uint8_t> digest(Sha256MultiBuffer<>::kDigestSize);
+  Sha256MultiBuffer<>::Hash(
+      absl::MakeConstSpan(reinterpret_cast<const uint8_t*>(message.data()),
+                          message.size()),
+      message.size(), absl::MakeSpan(digest));
+  return base::HexEncode(digest, /*use_lower_case=*/true);
+}
+
+}  // namespace
+
+TEST(Sha256MultiBufferTest, KnownAnswers) {
+  struct {
+    std::string_view message;
+    std::string_view digest;
+  } tests[] = {
+      {"",
+       "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855"},
+      {"abc",
+       "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad"},
+      {"abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",
+       "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1"},
+  };
+
+  for (const auto& test : tests) {
+    EXPECT_EQ(HashToHex(test.message), test.digest);
+  }
+}
+
+TEST(Sha256MultiBufferTest, Hash) {
+  // The number of the lanes is fixed regardless of the SIMD extensions.
+  using Hasher = Sha256MultiBuffer<4>;
+  // More than |kNumLanes| to test the last partial batch.
+  size_t num_messages = Hasher::kNumLanes + 3;
+
+  for (size_t message_size : {size_t{0}, size_t{64}, size_t{200}}) {
+    std::vector<uint8_t> messages =
+        base::CreateVector(num_messages * message_size, []() {
+          return base::Uniform(base::Range<uint8_t>::All());
+        });
+    std::vector<uint8_t> digests(num_messages * Hasher::kDigestSize);
+    Hasher::Hash(messages, message_size, absl::MakeSpan(digests));
+
+    for (size_t i = 0; i < num_messages; ++i) {
+      std::vector<uint8_t> expected(Hasher::kDigestSize);
+      Sha256MultiBuffer<1>::Hash(
+          absl::MakeConstSpan(messages).subspan(i * message_size, message_size),
+          message_size, absl::MakeSpan(expected));
+      EXPECT_EQ(absl::MakeConstSpan(digests).subspan(i * Hasher::kDigestSize,
+                                                     Hasher::kDigestSize),
+                absl::MakeConstSpan(expected));
+    }
+  }
+}
+
+}  // namespace tachyon::crypto
@@ -0,0 +1,31 @@
+#include "benchmark/benchmark.h"
+
+#include "tachyon/crypto/hashes/sponge/poseidon/poseidon.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+
+namespace tachyon::crypto {
+
+using F = math::bn254::Fr;
+
+template <bool Optimized>
+void BM_PoseidonPermute(benchmark::State& state) {
+  F::Init();
+  PoseidonSponge<F> sponge(
+      PoseidonConfig<F>::CreateCustom(state.range(0), 5, 8, 63, 0));
+  for (size_t i = 0; i < sponge.state.size(); ++i) {
+    sponge.state[i] = F::Random();
+  }
+  for (auto _ : state) {
+    if constexpr (Optimized) {
+      sponge.Permute();
+    } else {
+      sponge.PermuteUnoptimized();
+    }
+  }
+  benchmark::DoNotOptimize(sponge.state.elements);
+}
+
+BENCHMARK_TEMPLATE(BM_PoseidonPermute, false)->Arg(2)->Arg(4)->Arg(8);
+BENCHMARK_TEMPLATE(BM_PoseidonPermute, true)->Arg(2)->Arg(4)->Arg(8);
+
+}  // namespace tachyon::crypto
@@ -0,0 +1,336 @@
+#ifndef TACHYON_CRYPTO_HASHES_SPONGE_POSEIDON_POSEIDON_OPTIMIZED_PERMUTATION_H_
+#define TACHYON_CRYPTO_HASHES_SPONGE_POSEIDON_POSEIDON_OPTIMIZED_PERMUTATION_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+#include <utility>
+#include <vector>
+
+#include "tachyon/base/logging.h"
+#include "tachyon/crypto/hashes/sponge/poseidon/poseidon_config.h"
+
+namespace tachyon::crypto {
+
+// The Poseidon permutation of |PoseidonConfig| rearranged so that a partial
+// round costs O(t) instead of O(t²), where t is the width of the state. The
+// output is identical to the one of |PoseidonSponge::PermuteUnoptimized()|.
+// See appendix B of https://eprint.iacr.org/2019/458.pdf.
+//
+// Let M be the MDS matrix and cᵣ be the round constants of the round r.
+//
+// 1. Round constants: In a partial round, only the first element of the state
+//    goes through the S-box. So the constants except the first one are moved
+//    through M to the next round, i.e., M * (S(x + cᵣ)) is equal to
+//    M * (S(x + cᵣ[0])) + M * (cᵣ - cᵣ[0]). The last partial round hands its
+//    constants over to the first full round of the second half.
+// 2. MDS matrices: Any matrix A can be decomposed into A = A'' * A', where
+//
+// clang-format off
+//        | a₀₀ r |         | a₀₀ r * Â⁻¹ |        | 1 0 |
+//    A = | c   Â |,  A'' = | c   I       |,  A' = | 0 Â |.
+// clang-format on
+//
+//    A'' is sparse and A' commutes with the S-box and the addition of the
+//    first round constant of the previous partial round. Starting from M of
+//    the last partial round, A' is moved to the previous round, which makes A
+//    of the previous round A' * M. Finally, A' of the first partial round is
+//    merged into M of the last full round of the first half, which is called
+//    |pre_sparse_mds_|.
+template <typename PrimeField>
+class PoseidonOptimizedPermutation {
+ public:
+  using F = PrimeField;
+
+  PoseidonOptimizedPermutation() = default;
+
+  size_t width() const { return width_; }
+
+  // Creates the optimized permutation from |config|. Returns false if
+  // |config| is invalid or a submatrix of its MDS matrix is not invertible.
+  static bool Create(const PoseidonConfig<F>& config,
+                     PoseidonOptimizedPermutation* ret) {
+    if (!config.IsValid()) return false;
+    size_t width = config.rate + config.capacity;
+    size_t first_full_rounds = config.full_rounds / 2;
+    // The dense part of the partial rounds can't be merged if there is no
+    // full round before them.
+    if (width < 2 || (first_full_rounds == 0 && config.partial_rounds != 0)) {
+      return false;
+    }
+
+    PoseidonOptimizedPermutation permutation;
+    permutation.width_ = width;
+    permutation.full_rounds_ = config.full_rounds;
+    permutation.partial_rounds_ = config.partial_rounds;
+    permutation.alpha_ = config.alpha;
+
+    std::vector<F> mds(width * width);
+    for (size_t i = 0; i < width; ++i) {
+      for (size_t j = 0; j < width; ++j) {
+        mds[i * width + j] = config.mds(i, j);
+      }
+    }
+
+    // 1. Fold the round constants of the partial rounds.
+    permutation.full_round_constants_.reserve(config.full_rounds * width);
+    for (size_t r = 0; r < first_full_rounds; ++r) {
+      for (size_t i = 0; i < width; ++i) {
+        permutation.full_round_constants_.push_back(config.ark(r, i));
+      }
+    }
+    std::vector<F> carry(width, F::Zero());
+    std::vector<F> rest(width);
+    permutation.partial_round_constants_.reserve(config.partial_rounds);
+    for (size_t r = first_full_rounds;
+         r < first_full_rounds + config.partial_rounds; ++r) {
+      permutation.partial_round_constants_.push_back(config.ark(r, 0) +
+                                                     carry[0]);
+      rest[0] = F::Zero();
+      for (size_t i = 1; i < width; ++i) {
+        rest[i] = config.ark(r, i) + carry[i];
+      }
+      for (size_t i = 0; i < width; ++i) {
+        carry[i] = F::Zero();
+        for (size_t j = 1; j < width; ++j) {
+          carry[i] += mds[i * width + j] * rest[j];
+        }
+      }
+    }
+    for (size_t r = first_full_rounds + config.partial_rounds;
+         r < config.full_rounds + config.partial_rounds; ++r) {
+      for (size_t i = 0; i < width; ++i) {
+        permutation.full_round_constants_.push_back(config.ark(r, i) +
+                                                    carry[i]);
+        carry[i] = F::Zero();
+      }
+    }
+
+    // 2. Decompose the MDS matrices of the partial rounds. The bottom right
+    // submatrix Â of the k-th matrix from the last partial round is M̂ᵏ, so
+    // Â⁻¹ is (M̂⁻¹)ᵏ.
+    size_t n = width - 1;
+    std::vector<F> mds_hat_inverse(n * n);
+    for (size_t i = 0; i < n; ++i) {
+      for (size_t j = 0; j < n; ++j) {
+        mds_hat_inverse[i * n + j] = mds[(i + 1) * width + (j + 1)];
+      }
+    }
+    if (!InvertMatrix(n, mds_hat_inverse)) return false;
+
+    // |a| is the matrix A = A'' * A' of the current partial round.
+    std::vector<F> a = mds;
+    std::vector<F> a_hat_inverse = mds_hat_inverse;
+    permutation.sparse_mds_.resize(config.partial_rounds * (2 * width - 1));
+    for (size_t i = 0; i < config.partial_rounds; ++i) {
+      size_t r = config.partial_rounds - 1 - i;
+      F* sparse = &permutation.sparse_mds_[r * (2 * width - 1)];
+      // The first row of A'' is [a₀₀, r * Â⁻¹].
+      sparse[0] = a[0];
+      for (size_t j = 0; j < n; ++j) {
+        F sum = F::Zero();
+        for (size_t k = 0; k < n; ++k) {
+          sum += a[k + 1] * a_hat_inverse[k * n + j];
+        }
+        sparse[j + 1] = std::move(sum);
+      }
+      // The first column of A'' below a₀₀ is c.
+      for (size_t j = 0; j < n; ++j) {
+        sparse[width + j] = a[(j + 1) * width];
+      }
+
+      // A of the previous round is A' * M and its Â⁻¹ is Â⁻¹ * M̂⁻¹.
+      std::vector<F> prev_a(width * width);
+      for (size_t j = 0; j < width; ++j) {
+        prev_a[j] = mds[j];
+      }
+      for (size_t row = 1; row < width; ++row) {
+        for (size_t j = 0; j < width; ++j) {
+          F sum = F::Zero();
+          for (size_t k = 1; k < width; ++k) {
+            sum += a[row * width + k] * mds[k * width + j];
+          }
+          prev_a[row * width + j] = std::move(sum);
+        }
+      }
+      a = std::move(prev_a);
+      a_hat_inverse = MulMatrices(n, a_hat_inverse, mds_hat_inverse);
+    }
+    // NOTE: If there is no partial round, |a| is left as M.
+    permutation.mds_ = std::move(mds);
+    permutation.pre_sparse_mds_ = std::move(a);
+
+    *ret = std::move(permutation);
+    return true;
+  }
+
+  // Applies the permutation to |state|. |Width| must be equal to |width_|.
+  template <size_t Width>
+  void Apply(std::array<F, Width>* state) const {
+    DCHECK_EQ(Width, width_);
+    switch (alpha_) {
+      case 5:
+        DoApply<Width, 5>(*state);
+        return;
+      case 7:
+        DoApply<Width, 7>(*state);
+        return;
+      default:
+        DoApply<Width, 0>(*state);
+        return;
+    }
+  }
+
+ private:
+  // Computes xᵅ. |Alpha| is 0 if there is no hard-coded addition chain for
+  // |alpha_|.
+  template <uint64_t Alpha>
+  void ApplySBox(F& x) const {
+    if constexpr (Alpha == 5) {
+      // x⁵ = (x²)² * x
+      F x4 = x.Square().Square();
+      x *= x4;
+    } else if constexpr (Alpha == 7) {
+      // x⁷ = x³ * (x²)²
+      F x2 = x.Square();
+      F x3 = x2 * x;
+      x = x3 * x2.Square();
+    } else {
+      x = x.Pow(alpha_);
+    }
+  }
+
+  template <size_t Width>
+  static void ApplyDenseMatrix(const F* matrix, std::array<F, Width>& state) {
+    std::array<F, Width> result;
+    for (size_t i = 0; i < Width; ++i) {
+      F sum = matrix[i * Width] * state[0];
+      for (size_t j = 1; j < Width; ++j) {
+        sum += matrix[i * Width + j] * state[j];
+      }
+      result[i] = std::move(sum);
+    }
+    state = std::move(result);
+  }
+
+  // Applies the sparse matrix A'' whose first row is |sparse[0..Width)| and
+  // first column below the diagonal is |sparse[Width..2 * Width - 1)|.
+  template <size_t Width>
+  static void ApplySparseMatrix(const F* sparse, std::array<F, Width>& state) {
+    F first = sparse[0] * state[0];
+    for (size_t i = 1; i < Width; ++i) {
+      first += sparse[i] * state[i];
+    }
+    for (size_t i = 1; i < Width; ++i) {
+      state[i] += sparse[Width + i - 1] * state[0];
+    }
+    state[0] = std::move(first);
+  }
+
+  template <size_t Width, uint64_t Alpha>
+  void ApplyFullRound(const F* constants, const F* matrix,
+                      std::array<F, Width>& state) const {
+    for (size_t i = 0; i < Width; ++i) {
+      state[i] += constants[i];
+      ApplySBox<Alpha>(state[i]);
+    }
+    ApplyDenseMatrix(matrix, state);
+  }
+
+  template <size_t Width, uint64_t Alpha>
+  void DoApply(std::array<F, Width>& state) const {
+    size_t first_full_rounds = full_rounds_ / 2;
+    const F* constants = full_round_constants_.data();
+    for (size_t r = 0; r < first_full_rounds; ++r, constants += Width) {
+      ApplyFullRound<Width, Alpha>(
+          constants,
+          r == first_full_rounds - 1 ? pre_sparse_mds_.data() : mds_.data(),
+          state);
+    }
+    const F* sparse = sparse_mds_.data();
+    for (size_t r = 0; r < partial_rounds_; ++r, sparse += 2 * Width - 1) {
+      state[0] += partial_round_constants_[r];
+      ApplySBox<Alpha>(state[0]);
+      ApplySparseMatrix(sparse, state);
+    }
+    for (size_t r = first_full_rounds; r < full_rounds_;
+         ++r, constants += Width) {
+      ApplyFullRound<Width, Alpha>(constants, mds_.data(), state);
+    }
+  }
+
+  // Returns |a| * |b|, where both are |n| x |n| row-major matrices.
+  static std::vector<F> MulMatrices(size_t n, const std::vector<F>& a,
+                                    const std::vector<F>& b) {
+    std::vector<F> ret(n * n);
+    for (size_t i = 0; i < n; ++i) {
+      for (size_t j = 0; j < n; ++j) {
+        F sum = F::Zero();
+        for (size_t k = 0; k < n; ++k) {
+          sum += a[i * n + k] * b[k * n + j];
+        }
+        ret[i * n + j] = std::move(sum);
+      }
+    }
+    return ret;
+  }
+
+  // Inverts the |n| x |n| row-major |matrix| in place with Gauss-Jordan
+  // elimination. Returns false if |matrix| is singular.
+  static bool InvertMatrix(size_t n, std::vector<F>& matrix) {
+    std::vector<F> inverse(n * n, F::Zero());
+    for (size_t i = 0; i < n; ++i) {
+      inverse[i * n + i] = F::One();
+    }
+    for (size_t col = 0; col < n; ++col) {
+      size_t pivot = col;
+      while (pivot < n && matrix[pivot * n + col].IsZero()) ++pivot;
+      if (pivot == n) return false;
+      if (pivot != col) {
+        for (size_t j = 0; j < n; ++j) {
+          std::swap(matrix[pivot * n + j], matrix[col * n + j]);
+          std::swap(inverse[pivot * n + j], inverse[col * n + j]);
+        }
+      }
+      F pivot_inverse = matrix[col * n + col].Inverse();
+      for (size_t j = 0; j < n; ++j) {
+        matrix[col * n + j] *= pivot_inverse;
+        inverse[col * n + j] *= pivot_inverse;
+      }
+      for (size_t i = 0; i < n; ++i) {
+        if (i == col || matrix[i * n + col].IsZero()) continue;
+        F factor = matrix[i * n + col];
+        for (size_t j = 0; j < n; ++j) {
+          matrix[i * n + j] -= factor * matrix[col * n + j];
+          inverse[i * n + j] -= factor * inverse[col * n + j];
+        }
+      }
+    }
+    matrix = std::move(inverse);
+    return true;
+  }
+
+  size_t width_ = 0;
+  size_t full_rounds_ = 0;
+  size_t partial_rounds_ = 0;
+  uint64_t alpha_ = 0;
+  // |full_rounds_| rows of |width_| round constants, where the first row of
+  // the second half has the constants folded from the partial rounds.
+  std::vector<F> full_round_constants_;
+  // The round constant added to the first element of the state in each
+  // partial round.
+  std::vector<F> partial_round_constants_;
+  // Row-major |width_| x |width_| MDS matrix M.
+  std::vector<F> mds_;
+  // Row-major |width_| x |width_| matrix which replaces M in the last full
+  // round of the first half.
+  std::vector<F> pre_sparse_mds_;
+  // |partial_rounds_| sparse matrices A'', each of which has |2 * width_ - 1|
+  // elements. See |ApplySparseMatrix()|.
+  std::vector<F> sparse_mds_;
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_HASHES_SPONGE_POSEIDON_POSEIDON_OPTIMIZED_PERMUTATION_H_
@@ -0,0 +1,116 @@
+#include "tachyon/crypto/hashes/sponge/poseidon/poseidon_optimized_permutation.h"
+
+#include <array>
+
+#include "absl/strings/substitute.h"
+#include "gtest/gtest.h"
+
+#include "tachyon/crypto/hashes/sponge/poseidon/poseidon.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+
+namespace tachyon::crypto {
+
+namespace {
+
+using F = math::bn254::Fr;
+
+class PoseidonOptimizedPermutationTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { F::Init(); }
+};
+
+// Applies |PoseidonOptimizedPermutation| directly instead of
+// |PoseidonSponge::Permute()|, which falls back to the unoptimized
+// permutation if the optimized one can't be created.
+template <size_t Width>
+void ExpectSamePermutation(const PoseidonConfig<F>& config) {
+  PoseidonOptimizedPermutation<F> permutation;
+  ASSERT_TRUE(PoseidonOptimizedPermutation<F>::Create(config, &permutation));
+  ASSERT_EQ(permutation.width(), Width);
+
+  PoseidonSponge<F> sponge(config);
+  std::array<F, Width> state;
+  for (size_t i = 0; i < Width; ++i) {
+    state[i] = F::Random();
+    sponge.state[i] = state[i];
+  }
+  permutation.Apply(&state);
+  sponge.PermuteUnoptimized();
+  for (size_t i = 0; i < Width; ++i) {
+    EXPECT_EQ(state[i], sponge.state[i]);
+  }
+}
+
+void ExpectSamePermutation(const PoseidonConfig<F>& config) {
+  switch (config.rate + config.capacity) {
+    case 2:
+      ExpectSamePermutation<2>(config);
+      return;
+    case 3:
+      ExpectSamePermutation<3>(config);
+      return;
+    case 4:
+      ExpectSamePermutation<4>(config);
+      return;
+    case 5:
+      ExpectSamePermutation<5>(config);
+      return;
+    case 6:
+      ExpectSamePermutation<6>(config);
+      return;
+    case 7:
+      ExpectSamePermutation<7>(config);
+      return;
+    case 8:
+      ExpectSamePermutation<8>(config);
+      return;
+    case 9:
+      ExpectSamePermutation<9>(config);
+      return;
+  }
+  FAIL() << "Unsupported width: " << config.rate + config.capacity;
+}
+
+}  // namespace
+
+TEST_F(PoseidonOptimizedPermutationTest, DefaultConfigs) {
+  for (size_t rate = 2; rate <= 8; ++rate) {
+    for (bool optimized_for_weights : {false, true}) {
+      SCOPED_TRACE(absl::Substitute("rate: $0, optimized_for_weights: $1", rate,
+                                    optimized_for_weights));
+      ExpectSamePermutation(
+          PoseidonConfig<F>::CreateDefault(rate, optimized_for_weights));
+    }
+  }
+}
+
+TEST_F(PoseidonOptimizedPermutationTest, CustomConfigs) {
+  // Halo2 transcript
+  ExpectSamePermutation(PoseidonConfig<F>::CreateCustom(8, 5, 8, 63, 0));
+  // x⁷
+  ExpectSamePermutation(PoseidonConfig<F>::CreateCustom(2, 7, 8, 57, 0));
+  // Odd number of full rounds
+  ExpectSamePermutation(PoseidonConfig<F>::CreateCustom(3, 5, 7, 10, 0));
+  // No partial round
+  ExpectSamePermutation(PoseidonConfig<F>::CreateCustom(4, 5, 8, 0, 0));
+}
+
+TEST_F(PoseidonOptimizedPermutationTest, Create) {
+  PoseidonConfig<F> config = PoseidonConfig<F>::CreateCustom(2, 5, 8, 56, 0);
+  PoseidonOptimizedPermutation<F> permutation;
+  ASSERT_TRUE(PoseidonOptimizedPermutation<F>::Create(config, &permutation));
+  EXPECT_EQ(permutation.width(), size_t{3});
+
+  // Partial rounds without a preceding full round.
+  PoseidonConfig<F> invalid_config =
+      PoseidonConfig<F>::CreateCustom(2, 5, 1, 56, 0);
+  EXPECT_FALSE(
+      PoseidonOptimizedPermutation<F>::Create(invalid_config, &permutation));
+
+  invalid_config = config;
+  invalid_config.partial_rounds = 0;
+  EXPECT_FALSE(
+      PoseidonOptimizedPermutation<F>::Create(invalid_config, &permutation));
+}
+
+}  // namespace tachyon::crypto
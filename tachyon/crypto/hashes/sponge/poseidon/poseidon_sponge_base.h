@@ -0,0 +1,222 @@
+// Copyright 2022 arkworks contributors
+// Use of this source code is governed by a MIT/Apache-2.0 style license that
+// can be found in the LICENSE-MIT.arkworks and the LICENCE-APACHE.arkworks
+// file.
+
+#ifndef TACHYON_CRYPTO_HASHES_SPONGE_POSEIDON_POSEIDON_SPONGE_BASE_H_
+#define TACHYON_CRYPTO_HASHES_SPONGE_POSEIDON_POSEIDON_SPONGE_BASE_H_
+
+#include <bitset>
+#include <type_traits>
+#include <vector>
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/crypto/hashes/prime_field_serializable.h"
+#include "tachyon/crypto/hashes/sponge/sponge.h"
+#include "tachyon/math/matrix/matrix_types.h"
+
+namespace tachyon::crypto {
+
+template <typename F>
+struct SpongeState {
+  // Current sponge's state (current elements in the permutation block)
+  math::Vector<F> elements;
+
+  // Current mode (whether its absorbing or squeezing)
+  DuplexSpongeMode mode = DuplexSpongeMode::Absorbing();
+
+  SpongeState() = default;
+  explicit SpongeState(size_t size) : elements(size) {
+    for (size_t i = 0; i < size; ++i) {
+      elements[i] = F::Zero();
+    }
+  }
+
+  size_t size() const { return elements.size(); }
+
+  F& operator[](size_t idx) { return elements[idx]; }
+  const F& operator[](size_t idx) const { return elements[idx]; }
+};
+
+// The duplex sponge construction shared by |PoseidonSponge| and
+// |Poseidon2Sponge|. |Derived| must have |config| which has |rate| and
+// |capacity|, |state| of type |SpongeState|, and |Permute()| which permutes
+// |state|. The first |config.capacity| elements of |state| are the capacity
+// and the rest are the rate.
+template <typename Derived>
+struct PoseidonSpongeBase : public FieldBasedCryptographicSponge<Derived> {
+  using F = typename CryptographicSpongeTraits<Derived>::F;
+
+  // Absorbs everything in |elements|, this does not end in an absorbing.
+  void AbsorbInternal(size_t rate_start_index, const std::vector<F>& elements) {
+    Derived& derived = static_cast<Derived&>(*this);
+    size_t elements_idx = 0;
+    while (true) {
+      size_t remaining_size = elements.size() - elements_idx;
+      // if we can finish in this call
+      if (rate_start_index + remaining_size <= derived.config.rate) {
+        for (size_t i = 0; i < remaining_size; ++i, ++elements_idx) {
+          derived.state[derived.config.capacity + i + rate_start_index] +=
+              elements[elements_idx];
+        }
+        derived.state.mode.type = DuplexSpongeMode::Type::kAbsorbing;
+        derived.state.mode.next_index = rate_start_index + remaining_size;
+        break;
+      }
+      // otherwise absorb (|config.rate| - |rate_start_index|) elements
+      size_t num_elements_absorbed = derived.config.rate - rate_start_index;
+      for (size_t i = 0; i < num_elements_absorbed; ++i, ++elements_idx) {
+        derived.state[derived.config.capacity + i + rate_start_index] +=
+            elements[elements_idx];
+      }
+      derived.Permute();
+      rate_start_index = 0;
+    }
+  }
+
+  // Squeeze |output| many elements. This does not end in a squeezing.
+  void SqueezeInternal(size_t rate_start_index, std::vector<F>* output) {
+    Derived& derived = static_cast<Derived&>(*this);
+    size_t output_size = output->size();
+    size_t output_idx = 0;
+    while (true) {
+      size_t output_remaining_size = output_size - output_idx;
+      // if we can finish in this call
+      if (rate_start_index + output_remaining_size <= derived.config.rate) {
+        for (size_t i = 0; i < output_remaining_size; ++i) {
+          (*output)[output_idx + i] =
+              derived.state[derived.config.capacity + rate_start_index + i];
+        }
+        derived.state.mode.type = DuplexSpongeMode::Type::kSqueezing;
+        derived.state.mode.next_index =
+            rate_start_index + output_remaining_size;
+        return;
+      }
+
+      // otherwise squeeze (|config.rate| - |rate_start_index|) elements
+      size_t num_elements_squeezed = derived.config.rate - rate_start_index;
+      for (size_t i = 0; i < num_elements_squeezed; ++i) {
+        (*output)[output_idx + i] =
+            derived.state[derived.config.capacity + rate_start_index + i];
+      }
+
+      if (output_remaining_size != derived.config.rate) {
+        derived.Permute();
+      }
+      output_idx += num_elements_squeezed;
+      rate_start_index = 0;
+    }
+  }
+
+  // CryptographicSponge methods
+  template <typename T>
+  bool Absorb(const T& input) {
+    Derived& derived = static_cast<Derived&>(*this);
+    std::vector<F> elements;
+    if (!SerializeToFieldElements(input, &elements)) return false;
+
+    switch (derived.state.mode.type) {
+      case DuplexSpongeMode::Type::kAbsorbing: {
+        size_t absorb_index = derived.state.mode.next_index;
+        if (absorb_index == derived.config.rate) {
+          derived.Permute();
+          absorb_index = 0;
+        }
+        AbsorbInternal(absorb_index, elements);
+        return true;
+      }
+      case DuplexSpongeMode::Type::kSqueezing: {
+        derived.Permute();
+        AbsorbInternal(0, elements);
+        return true;
+      }
+    }
+    NOTREACHED();
+    return false;
+  }
+
+  std::vector<uint8_t> SqueezeBytes(size_t num_bytes) {
+    size_t usable_bytes = (F::kModulusBits - 1) / 8;
+
+    size_t num_elements = (num_bytes + usable_bytes - 1) / usable_bytes;
+    std::vector<F> src_elements = SqueezeNativeFieldElements(num_elements);
+
+    std::vector<F> bytes;
+    bytes.reserve(usable_bytes * num_elements);
+    for (const F& elem : src_elements) {
+      auto elem_bytes = elem.ToBigInt().ToBytesLE();
+      bytes.insert(bytes.end(), elem_bytes.begin(), elem_bytes.end());
+    }
+
+    bytes.resize(num_bytes);
+    return bytes;
+  }
+
+  std::vector<bool> SqueezeBits(size_t num_bits) {
+    size_t usable_bits = F::kModulusBits - 1;
+
+    size_t num_elements = (num_bits + usable_bits - 1) / usable_bits;
+    std::vector<F> src_elements = SqueezeNativeFieldElements(num_elements);
+
+    std::vector<bool> bits;
+    for (const F& elem : src_elements) {
+      std::bitset<F::kModulusBits> elem_bits =
+          elem.ToBigInt().template ToBitsLE<F::kModulusBits>();
+      bits.insert(bits.end(), elem_bits.begin(), elem_bits.end());
+    }
+    bits.resize(num_bits);
+    return bits;
+  }
+
+  template <typename F2 = F>
+  std::vector<F2> SqueezeFieldElementsWithSizes(
+      const std::vector<FieldElementSize>& sizes) {
+    if constexpr (F::Characteristic() == F2::Characteristic()) {
+      // native case
+      return this->SqueezeNativeFieldElementsWithSizes(sizes);
+    }
+    return this->template SqueezeFieldElementsWithSizesDefaultImpl<F2>(sizes);
+  }
+
+  template <typename F2 = F>
+  std::vector<F2> SqueezeFieldElements(size_t num_elements) {
+    if constexpr (std::is_same_v<F, F2>) {
+      return SqueezeNativeFieldElements(num_elements);
+    } else {
+      return SqueezeFieldElementsWithSizes<F2>(base::CreateVector(
+          num_elements, []() { return FieldElementSize::Full(); }));
+    }
+  }
+
+  // FieldBasedCryptographicSponge methods
+  // NOTE(TomTaehoonKim): If you ever update this, please update
+  // |Halo2PoseidonSponge| for consistency.
+  std::vector<F> SqueezeNativeFieldElements(size_t num_elements) {
+    Derived& derived = static_cast<Derived&>(*this);
+    std::vector<F> ret =
+        base::CreateVector(num_elements, []() { return F::Zero(); });
+    switch (derived.state.mode.type) {
+      case DuplexSpongeMode::Type::kAbsorbing: {
+        derived.Permute();
+        SqueezeInternal(0, &ret);
+        return ret;
+      }
+      case DuplexSpongeMode::Type::kSqueezing: {
+        size_t squeeze_index = derived.state.mode.next_index;
+        if (squeeze_index == derived.config.rate) {
+          derived.Permute();
+          squeeze_index = 0;
+        }
+        SqueezeInternal(squeeze_index, &ret);
+        return ret;
+      }
+    }
+    NOTREACHED();
+    return {};
+  }
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_HASHES_SPONGE_POSEIDON_POSEIDON_SPONGE_BASE_H_
@@ -0,0 +1,277 @@
+#ifndef TACHYON_CRYPTO_HASHES_SPONGE_POSEIDON2_POSEIDON2_H_
+#define TACHYON_CRYPTO_HASHES_SPONGE_POSEIDON2_POSEIDON2_H_
+
+#include <utility>
+
+#include "absl/container/inlined_vector.h"
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/crypto/hashes/sponge/poseidon/poseidon_sponge_base.h"
+#include "tachyon/crypto/hashes/sponge/poseidon2/poseidon2_config.h"
+
+namespace tachyon::crypto {
+
+// Poseidon2 Sponge Hash: Absorb → Permute → Squeeze
+// Poseidon2 is the same as Poseidon except for the linear layers. The dense
+// MDS matrix of Poseidon is replaced with the external matrix Mₑ in the full
+// rounds and the internal matrix Mᵢ in the partial rounds, both of which can
+// be applied in O(t), where t is the width of the state.
+// Permute: Transform the |state| using a series of operations.
+//   1. Apply Mₑ to |state|.
+//   2. Apply the first half of the full rounds: ARK, S-Box (xᵅ) and Mₑ.
+//   3. Apply the partial rounds: ARK and S-Box (xᵅ) to the first element of
+//      |state| and Mᵢ.
+//   4. Apply the second half of the full rounds.
+// See https://eprint.iacr.org/2023/323.pdf.
+template <typename PrimeField>
+struct Poseidon2Sponge final
+    : public PoseidonSpongeBase<Poseidon2Sponge<PrimeField>> {
+  using F = PrimeField;
+
+  using State = SpongeState<F>;
+
+  // Sponge Config
+  Poseidon2Config<F> config;
+
+  // Sponge State
+  State state;
+
+  Poseidon2Sponge() = default;
+  explicit Poseidon2Sponge(const Poseidon2Config<F>& config)
+      : config(config), state(config.rate + config.capacity) {
+    CHECK(config.IsValid());
+  }
+  Poseidon2Sponge(const Poseidon2Config<F>& config, const State& state)
+      : config(config), state(state) {
+    CHECK(config.IsValid());
+  }
+  Poseidon2Sponge(const Poseidon2Config<F>& config, State&& state)
+      : config(config), state(std::move(state)) {
+    CHECK(config.IsValid());
+  }
+
+  void Permute() {
+    Permute(config, absl::MakeSpan(state.elements.data(), state.size()));
+  }
+
+  // Permutes |state| with |config|. This is exposed so that the permutation
+  // can be applied without copying |config| into a sponge. See
+  // |Poseidon2BinaryMerkleHasher| for example.
+  static void Permute(const Poseidon2Config<F>& config, absl::Span<F> state) {
+    PermuteBatch(config, state, 1);
+  }
+
+  // Permutes |num_lanes| independent states at once. |states| is laid out in
+  // SoA (structure of arrays) form, i.e., the i-th element of the l-th state
+  // is |states[i * num_lanes + l]|. Every step of a round runs across the
+  // lanes, which amortizes the lookups of the round constants and lets the
+  // compiler interleave or vectorize the independent field operations.
+  static void PermuteBatch(const Poseidon2Config<F>& config,
+                           absl::Span<F> states, size_t num_lanes) {
+    size_t width = config.rate + config.capacity;
+    DCHECK_EQ(states.size(), width * num_lanes);
+    Lanes lanes{states, width, num_lanes};
+    // Used by the linear layers to keep the sums of the lanes.
+    absl::InlinedVector<F, 4> sums(4 * num_lanes);
+
+    size_t full_rounds_over_2 = config.full_rounds / 2;
+    ApplyExternalMatrix(lanes, absl::MakeSpan(sums));
+    for (size_t i = 0; i < full_rounds_over_2; ++i) {
+      ApplyFullRound(config, i, lanes, absl::MakeSpan(sums));
+    }
+    for (size_t i = full_rounds_over_2;
+         i < full_rounds_over_2 + config.partial_rounds; ++i) {
+      AddRoundConstantAndApplySBox(config.ark(i, 0), config.alpha,
+                                   lanes.row(0));
+      ApplyInternalMatrix(config, lanes, absl::MakeSpan(sums));
+    }
+    for (size_t i = full_rounds_over_2 + config.partial_rounds;
+         i < config.partial_rounds + config.full_rounds; ++i) {
+      ApplyFullRound(config, i, lanes, absl::MakeSpan(sums));
+    }
+  }
+
+ private:
+  // A view of the states in SoA form. See |PermuteBatch()|.
+  struct Lanes {
+    absl::Span<F> states;
+    size_t width;
+    size_t num_lanes;
+
+    // Returns the i-th elements of every state.
+    absl::Span<F> row(size_t i) const {
+      return states.subspan(i * num_lanes, num_lanes);
+    }
+  };
+
+  // Computes (x + c)ᵅ for every x in |row| with the addition chains for the
+  // exponents used in practice.
+  static void AddRoundConstantAndApplySBox(const F& c, uint64_t alpha,
+                                           absl::Span<F> row) {
+    switch (alpha) {
+      case 3: {
+        // x³ = x² * x
+        for (F& x : row) {
+          x += c;
+          x *= x.Square();
+        }
+        return;
+      }
+      case 5: {
+        // x⁵ = (x²)² * x
+        for (F& x : row) {
+          x += c;
+          F x4 = x.Square().Square();
+          x *= x4;
+        }
+        return;
+      }
+      case 7: {
+        // x⁷ = x³ * (x²)²
+        for (F& x : row) {
+          x += c;
+          F x2 = x.Square();
+          F x3 = x2 * x;
+          x = x3 * x2.Square();
+        }
+        return;
+      }
+    }
+    for (F& x : row) {
+      x += c;
+      x = x.Pow(alpha);
+    }
+  }
+
+  static void ApplyFullRound(const Poseidon2Config<F>& config, size_t round,
+                             const Lanes& lanes, absl::Span<F> sums) {
+    for (size_t i = 0; i < lanes.width; ++i) {
+      AddRoundConstantAndApplySBox(config.ark(round, i), config.alpha,
+                                   lanes.row(i));
+    }
+    ApplyExternalMatrix(lanes, sums);
+  }
+
+  // Stores the sums of the elements of each state to |sums|.
+  static void SumRows(const Lanes& lanes, absl::Span<F> sums) {
+    absl::Span<F> row = lanes.row(0);
+    for (size_t l = 0; l < lanes.num_lanes; ++l) {
+      sums[l] = row[l];
+    }
+    for (size_t i = 1; i < lanes.width; ++i) {
+      row = lanes.row(i);
+      for (size_t l = 0; l < lanes.num_lanes; ++l) {
+        sums[l] += row[l];
+      }
+    }
+  }
+
+  // Applies M₄ below to every chunk of 4 elements of each state.
+  //
+  // clang-format off
+  //      | 5 7 1 3 |
+  // M₄ = | 4 6 1 1 |
+  //      | 1 3 5 7 |
+  //      | 1 1 4 6 |
+  // clang-format on
+  static void ApplyM4(const Lanes& lanes) {
+    for (size_t i = 0; i < lanes.width; i += 4) {
+      absl::Span<F> x0 = lanes.row(i);
+      absl::Span<F> x1 = lanes.row(i + 1);
+      absl::Span<F> x2 = lanes.row(i + 2);
+      absl::Span<F> x3 = lanes.row(i + 3);
+      for (size_t l = 0; l < lanes.num_lanes; ++l) {
+        F t0 = x0[l] + x1[l];
+        F t1 = x2[l] + x3[l];
+        F t2 = x1[l].Double() + t1;
+        F t3 = x3[l].Double() + t0;
+        F t4 = t1.Double().Double() + t3;
+        F t5 = t0.Double().Double() + t2;
+        x0[l] = t3 + t5;
+        x1[l] = t5;
+        x2[l] = t2 + t4;
+        x3[l] = std::move(t4);
+      }
+    }
+  }
+
+  // Applies Mₑ, which is circ(2, 1) or circ(2, 1, 1) if the width is 2 or 3
+  // and M₄ if the width is 4. Otherwise, it is circ(2M₄, M₄, ..., M₄).
+  static void ApplyExternalMatrix(const Lanes& lanes, absl::Span<F> sums) {
+    if (lanes.width <= 3) {
+      SumRows(lanes, sums);
+      for (size_t i = 0; i < lanes.width; ++i) {
+        absl::Span<F> row = lanes.row(i);
+        for (size_t l = 0; l < lanes.num_lanes; ++l) {
+          row[l] += sums[l];
+        }
+      }
+      return;
+    }
+
+    ApplyM4(lanes);
+    if (lanes.width == 4) return;
+    // circ(2M₄, M₄, ..., M₄) = diag(M₄, ..., M₄) + circ(M₄, ..., M₄). So the
+    // sums of the elements at the same position in each chunk are added.
+    for (size_t k = 0; k < 4; ++k) {
+      absl::Span<F> sum = sums.subspan(k * lanes.num_lanes, lanes.num_lanes);
+      absl::Span<F> row = lanes.row(k);
+      for (size_t l = 0; l < lanes.num_lanes; ++l) {
+        sum[l] = row[l];
+      }
+      for (size_t i = k + 4; i < lanes.width; i += 4) {
+        row = lanes.row(i);
+        for (size_t l = 0; l < lanes.num_lanes; ++l) {
+          sum[l] += row[l];
+        }
+      }
+    }
+    for (size_t i = 0; i < lanes.width; ++i) {
+      absl::Span<F> sum =
+          sums.subspan((i % 4) * lanes.num_lanes, lanes.num_lanes);
+      absl::Span<F> row = lanes.row(i);
+      for (size_t l = 0; l < lanes.num_lanes; ++l) {
+        row[l] += sum[l];
+      }
+    }
+  }
+
+  // Applies Mᵢ = 1 + diag(|config.internal_diagonal_minus_one|).
+  static void ApplyInternalMatrix(const Poseidon2Config<F>& config,
+                                  const Lanes& lanes, absl::Span<F> sums) {
+    SumRows(lanes, sums);
+    if (lanes.width <= 3) {
+      // The diagonal is fixed to [1, 2] or [1, 1, 2].
+      for (size_t i = 0; i < lanes.width - 1; ++i) {
+        absl::Span<F> row = lanes.row(i);
+        for (size_t l = 0; l < lanes.num_lanes; ++l) {
+          row[l] += sums[l];
+        }
+      }
+      absl::Span<F> row = lanes.row(lanes.width - 1);
+      for (size_t l = 0; l < lanes.num_lanes; ++l) {
+        row[l].DoubleInPlace();
+        row[l] += sums[l];
+      }
+      return;
+    }
+    for (size_t i = 0; i < lanes.width; ++i) {
+      const F& diagonal = config.internal_diagonal_minus_one[i];
+      absl::Span<F> row = lanes.row(i);
+      for (size_t l = 0; l < lanes.num_lanes; ++l) {
+        row[l] *= diagonal;
+        row[l] += sums[l];
+      }
+    }
+  }
+};
+
+template <typename PrimeField>
+struct CryptographicSpongeTraits<Poseidon2Sponge<PrimeField>> {
+  using F = PrimeField;
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_HASHES_SPONGE_POSEIDON2_POSEIDON2_H_
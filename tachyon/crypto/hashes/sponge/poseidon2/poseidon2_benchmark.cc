@@ -0,0 +1,40 @@
+#include "benchmark/benchmark.h"
+
+#include "tachyon/crypto/hashes/sponge/poseidon/poseidon.h"
+#include "tachyon/crypto/hashes/sponge/poseidon2/poseidon2.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+
+namespace tachyon::crypto {
+
+using F = math::bn254::Fr;
+
+// Both permutations use the parameters of a state of width 3 over bn254 in
+// https://eprint.iacr.org/2023/323.pdf.
+void BM_PoseidonPermute(benchmark::State& state) {
+  F::Init();
+  PoseidonSponge<F> sponge(PoseidonConfig<F>::CreateCustom(2, 5, 8, 56, 0));
+  for (size_t i = 0; i < sponge.state.size(); ++i) {
+    sponge.state[i] = F::Random();
+  }
+  for (auto _ : state) {
+    sponge.Permute();
+  }
+  benchmark::DoNotOptimize(sponge.state.elements);
+}
+
+void BM_Poseidon2Permute(benchmark::State& state) {
+  F::Init();
+  Poseidon2Sponge<F> sponge(Poseidon2Config<F>::CreateCustom(2, 5, 8, 56));
+  for (size_t i = 0; i < sponge.state.size(); ++i) {
+    sponge.state[i] = F::Random();
+  }
+  for (auto _ : state) {
+    sponge.Permute();
+  }
+  benchmark::DoNotOptimize(sponge.state.elements);
+}
+
+BENCHMARK(BM_PoseidonPermute);
+BENCHMARK(BM_Poseidon2Permute);
+
+}  // namespace tachyon::crypto
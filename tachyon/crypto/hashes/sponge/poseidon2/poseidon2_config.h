@@ -0,0 +1,149 @@
+#ifndef TACHYON_CRYPTO_HASHES_SPONGE_POSEIDON2_POSEIDON2_CONFIG_H_
+#define TACHYON_CRYPTO_HASHES_SPONGE_POSEIDON2_POSEIDON2_CONFIG_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <utility>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/crypto/hashes/sponge/poseidon/grain_lfsr.h"
+#include "tachyon/math/matrix/matrix_types.h"
+
+namespace tachyon::crypto {
+
+// Returns true if Poseidon2 defines the external linear layer for |width|.
+// See section 5.1 of https://eprint.iacr.org/2023/323.pdf.
+constexpr bool IsValidPoseidon2Width(size_t width) {
+  return width == 2 || width == 3 || (width % 4 == 0 && width <= 24);
+}
+
+// Generates the round constants in the same way as the reference
+// implementation. Unlike Poseidon, a partial round only has a constant for the
+// first element, so the other elements of the rows of the partial rounds are
+// left as zero. See
+// https://github.com/HorizenLabs/poseidon2/blob/main/poseidon2_rust_params.sage
+template <typename PrimeField>
+void FindPoseidon2Ark(const PoseidonGrainLFSRConfig& config,
+                      math::Matrix<PrimeField>* ark) {
+  PoseidonGrainLFSR<PrimeField> lfsr(config);
+  size_t full_rounds_over_2 = config.num_full_rounds / 2;
+  *ark = math::Matrix<PrimeField>(
+      config.num_full_rounds + config.num_partial_rounds, config.state_len);
+  for (size_t i = 0; i < full_rounds_over_2; ++i) {
+    ark->row(i) = lfsr.GetFieldElementsRejectionSampling(config.state_len);
+  }
+  for (size_t i = full_rounds_over_2;
+       i < full_rounds_over_2 + config.num_partial_rounds; ++i) {
+    (*ark)(i, 0) = lfsr.GetFieldElementsRejectionSampling(1)[0];
+    for (size_t j = 1; j < config.state_len; ++j) {
+      (*ark)(i, j) = PrimeField::Zero();
+    }
+  }
+  for (size_t i = full_rounds_over_2 + config.num_partial_rounds;
+       i < config.num_full_rounds + config.num_partial_rounds; ++i) {
+    ark->row(i) = lfsr.GetFieldElementsRejectionSampling(config.state_len);
+  }
+}
+
+template <typename PrimeField>
+struct Poseidon2Config {
+  using F = PrimeField;
+
+  // Number of rounds in a full-round operation.
+  size_t full_rounds = 0;
+
+  // Number of rounds in a partial-round operation.
+  size_t partial_rounds = 0;
+
+  // Exponent used in S-boxes.
+  uint64_t alpha = 0;
+
+  // Additive Round Keys added before each S-box. They are indexed by
+  // |ark[round_num][state_element_index]|. Only |ark[round_num][0]| is used in
+  // the partial rounds.
+  math::Matrix<PrimeField> ark;
+
+  // The diagonal of the internal matrix minus 1. The internal matrix is
+  // 1 + diag(|internal_diagonal_minus_one|), where 1 is the matrix whose
+  // elements are all 1.
+  math::Vector<PrimeField> internal_diagonal_minus_one;
+
+  // The rate (in terms of number of field elements).
+  size_t rate = 0;
+
+  // The capacity (in terms of number of field elements).
+  size_t capacity = 0;
+
+  // Creates a config for a state of width 2 or 3, whose internal matrices are
+  // fixed to [[2, 1], [1, 3]] and [[2, 1, 1], [1, 2, 1], [1, 1, 3]].
+  static Poseidon2Config CreateCustom(size_t rate, uint64_t alpha,
+                                      size_t full_rounds,
+                                      size_t partial_rounds) {
+    size_t width = rate + 1;
+    CHECK(width == 2 || width == 3);
+    math::Vector<F> internal_diagonal_minus_one(width);
+    for (size_t i = 0; i < width - 1; ++i) {
+      internal_diagonal_minus_one[i] = F::One();
+    }
+    internal_diagonal_minus_one[width - 1] = F(2);
+    return DoCreateCustom(rate, alpha, full_rounds, partial_rounds,
+                          std::move(internal_diagonal_minus_one));
+  }
+
+  // Creates a config for a state of width greater than 3 with the internal
+  // matrix 1 + diag(|internal_diagonal_minus_one|). The diagonal has to be
+  // chosen so that the internal matrix is MDS and there is no invariant
+  // subspace. See section 5.3 of the paper.
+  static Poseidon2Config CreateCustom(
+      size_t rate, uint64_t alpha, size_t full_rounds, size_t partial_rounds,
+      absl::Span<const F> internal_diagonal_minus_one) {
+    size_t width = rate + 1;
+    CHECK_GT(width, size_t{3});
+    CHECK_EQ(internal_diagonal_minus_one.size(), width);
+    math::Vector<F> diagonal(width);
+    for (size_t i = 0; i < width; ++i) {
+      diagonal[i] = internal_diagonal_minus_one[i];
+    }
+    return DoCreateCustom(rate, alpha, full_rounds, partial_rounds,
+                          std::move(diagonal));
+  }
+
+  bool IsValid() const {
+    size_t width = rate + capacity;
+    return IsValidPoseidon2Width(width) &&
+           static_cast<size_t>(ark.rows()) == full_rounds + partial_rounds &&
+           static_cast<size_t>(ark.cols()) == width &&
+           static_cast<size_t>(internal_diagonal_minus_one.size()) == width;
+  }
+
+ private:
+  static Poseidon2Config DoCreateCustom(
+      size_t rate, uint64_t alpha, size_t full_rounds, size_t partial_rounds,
+      math::Vector<F>&& internal_diagonal_minus_one) {
+    size_t width = rate + 1;
+    CHECK(IsValidPoseidon2Width(width));
+
+    Poseidon2Config ret;
+    ret.full_rounds = full_rounds;
+    ret.partial_rounds = partial_rounds;
+    ret.alpha = alpha;
+    ret.rate = rate;
+    ret.capacity = 1;
+    ret.internal_diagonal_minus_one = std::move(internal_diagonal_minus_one);
+
+    PoseidonGrainLFSRConfig lfsr_config;
+    lfsr_config.prime_num_bits = F::kModulusBits;
+    lfsr_config.state_len = width;
+    lfsr_config.num_full_rounds = full_rounds;
+    lfsr_config.num_partial_rounds = partial_rounds;
+    FindPoseidon2Ark<F>(lfsr_config, &ret.ark);
+    return ret;
+  }
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_HASHES_SPONGE_POSEIDON2_POSEIDON2_CONFIG_H_
@@ -0,0 +1,196 @@
+#include "tachyon/crypto/hashes/sponge/poseidon2/poseidon2.h"
+
+#include <vector>
+
+#include "absl/strings/substitute.h"
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+
+namespace tachyon::crypto {
+
+namespace {
+
+using F = math::bn254::Fr;
+
+class Poseidon2Test : public testing::Test {
+ public:
+  static void SetUpTestSuite() { F::Init(); }
+};
+
+// Returns the external matrix of |width| as a dense matrix.
+math::Matrix<F> CreateExternalMatrix(size_t width) {
+  math::Matrix<F> ret(width, width);
+  if (width <= 3) {
+    for (size_t i = 0; i < width; ++i) {
+      for (size_t j = 0; j < width; ++j) {
+        ret(i, j) = i == j ? F(2) : F(1);
+      }
+    }
+    return ret;
+  }
+  const uint64_t m4[4][4] = {
+      {5, 7, 1, 3},
+      {4, 6, 1, 1},
+      {1, 3, 5, 7},
+      {1, 1, 4, 6},
+  };
+  for (size_t i = 0; i < width; ++i) {
+    for (size_t j = 0; j < width; ++j) {
+      uint64_t value = m4[i % 4][j % 4];
+      ret(i, j) = F(width > 4 && i / 4 == j / 4 ? 2 * value : value);
+    }
+  }
+  return ret;
+}
+
+// Applies the permutation with dense matrices.
+void PermuteWithDenseMatrices(const Poseidon2Config<F>& config,
+                              math::Vector<F>& state) {
+  size_t width = state.size();
+  math::Matrix<F> external = CreateExternalMatrix(width);
+  math::Matrix<F> internal(width, width);
+  for (size_t i = 0; i < width; ++i) {
+    for (size_t j = 0; j < width; ++j) {
+      internal(i, j) =
+          i == j ? config.internal_diagonal_minus_one[i] + F::One() : F::One();
+    }
+  }
+
+  size_t full_rounds_over_2 = config.full_rounds / 2;
+  state = external * state;
+  for (size_t r = 0; r < config.full_rounds + config.partial_rounds; ++r) {
+    bool is_full_round = r < full_rounds_over_2 ||
+                         r >= full_rounds_over_2 + config.partial_rounds;
+    for (size_t i = 0; i < (is_full_round ? width : 1); ++i) {
+      state[i] = (state[i] + config.ark(r, i)).Pow(config.alpha);
+    }
+    state = (is_full_round ? external : internal) * state;
+  }
+}
+
+}  // namespace
+
+TEST_F(Poseidon2Test, Config) {
+  Poseidon2Config<F> config = Poseidon2Config<F>::CreateCustom(2, 5, 8, 56);
+  ASSERT_TRUE(config.IsValid());
+  // See
+  // https://github.com/HorizenLabs/poseidon2/blob/main/plain_implementations/src/poseidon2/poseidon2_instance_bn256.rs
+  EXPECT_EQ(config.ark(0, 0),
+            F::FromHexString("0x1d066a255517b7fd8bddd3a93f7804ef7f8fcde48bb4c37"
+                             "a59a09a1a97052816"));
+  for (size_t i = 4; i < 4 + 56; ++i) {
+    EXPECT_TRUE(config.ark(i, 1).IsZero());
+    EXPECT_TRUE(config.ark(i, 2).IsZero());
+  }
+}
+
+TEST_F(Poseidon2Test, Permute) {
+  Poseidon2Config<F> config = Poseidon2Config<F>::CreateCustom(2, 5, 8, 56);
+  Poseidon2Sponge<F> sponge(config);
+  sponge.state[0] = F(0);
+  sponge.state[1] = F(1);
+  sponge.state[2] = F(2);
+  sponge.Permute();
+  // See
+  // https://github.com/HorizenLabs/poseidon2/blob/main/plain_implementations/src/poseidon2/poseidon2.rs
+  EXPECT_EQ(sponge.state[0],
+            F::FromHexString("0x0bb61d24daca55eebcb1929a82650f328134334da98ea4f"
+                             "847f760054f4a3033"));
+  EXPECT_EQ(sponge.state[1],
+            F::FromHexString("0x303b6f7c86d043bfcbcc80214f26a30277a15d3f74ca654"
+                             "992defe7ff8d03570"));
+  EXPECT_EQ(sponge.state[2],
+            F::FromHexString("0x1ed25194542b12eef8617361c3ba7c52e660b145994427c"
+                             "c86296242cf766ec8"));
+}
+
+TEST_F(Poseidon2Test, PermuteWithDenseMatrices) {
+  struct {
+    size_t rate;
+    uint64_t alpha;
+  } tests[] = {
+      {1, 5}, {2, 5}, {2, 7}, {3, 5}, {7, 5}, {11, 3}, {15, 5},
+  };
+
+  for (const auto& test : tests) {
+    SCOPED_TRACE(absl::Substitute("rate: $0, alpha: $1", test.rate,
+                                  test.alpha));
+    Poseidon2Config<F> config;
+    if (test.rate + 1 <= 3) {
+      config = Poseidon2Config<F>::CreateCustom(test.rate, test.alpha, 8, 56);
+    } else {
+      std::vector<F> diagonal = base::CreateVector(
+          test.rate + 1, []() { return F::Random(); });
+      config = Poseidon2Config<F>::CreateCustom(test.rate, test.alpha, 8, 56,
+                                                diagonal);
+    }
+    Poseidon2Sponge<F> sponge(config);
+    for (size_t i = 0; i < sponge.state.size(); ++i) {
+      sponge.state[i] = F::Random();
+    }
+    math::Vector<F> expected = sponge.state.elements;
+    PermuteWithDenseMatrices(config, expected);
+    sponge.Permute();
+    EXPECT_EQ(sponge.state.elements, expected);
+  }
+}
+
+TEST_F(Poseidon2Test, AbsorbSqueeze) {
+  Poseidon2Config<F> config = Poseidon2Config<F>::CreateCustom(2, 5, 8, 56);
+  Poseidon2Sponge<F> sponge(config);
+  std::vector<F> inputs = {F(0), F(1), F(2)};
+  ASSERT_TRUE(sponge.Absorb(inputs));
+  std::vector<F> result = sponge.SqueezeNativeFieldElements(3);
+
+  // The rate is 2, so the inputs are absorbed with 2 permutations and the 3
+  // outputs are squeezed with 2 more permutations.
+  math::Vector<F> state(3);
+  state << F(0), F(0), F(1);
+  Poseidon2Sponge<F>::Permute(config, absl::MakeSpan(state.data(), 3));
+  state[1] += F(2);
+  Poseidon2Sponge<F>::Permute(config, absl::MakeSpan(state.data(), 3));
+  std::vector<F> expected = {state[1], state[2]};
+  Poseidon2Sponge<F>::Permute(config, absl::MakeSpan(state.data(), 3));
+  expected.push_back(state[1]);
+  EXPECT_EQ(result, expected);
+}
+
+TEST_F(Poseidon2Test, PermuteBatch) {
+  constexpr size_t kNumLanes = 5;
+
+  for (size_t rate : {size_t{2}, size_t{7}}) {
+    SCOPED_TRACE(absl::Substitute("rate: $0", rate));
+    Poseidon2Config<F> config;
+    if (rate == 2) {
+      config = Poseidon2Config<F>::CreateCustom(rate, 5, 8, 56);
+    } else {
+      std::vector<F> diagonal =
+          base::CreateVector(rate + 1, []() { return F::Random(); });
+      config = Poseidon2Config<F>::CreateCustom(rate, 5, 8, 56, diagonal);
+    }
+    size_t width = rate + 1;
+
+    std::vector<std::vector<F>> states =
+        base::CreateVector(kNumLanes, [width]() {
+          return base::CreateVector(width, []() { return F::Random(); });
+        });
+    std::vector<F> lanes(width * kNumLanes);
+    for (size_t l = 0; l < kNumLanes; ++l) {
+      for (size_t i = 0; i < width; ++i) {
+        lanes[i * kNumLanes + l] = states[l][i];
+      }
+    }
+
+    Poseidon2Sponge<F>::PermuteBatch(config, absl::MakeSpan(lanes), kNumLanes);
+    for (size_t l = 0; l < kNumLanes; ++l) {
+      Poseidon2Sponge<F>::Permute(config, absl::MakeSpan(states[l]));
+      for (size_t i = 0; i < width; ++i) {
+        EXPECT_EQ(lanes[i * kNumLanes + l], states[l][i]);
+      }
+    }
+  }
+}
+
+}  // namespace tachyon::crypto
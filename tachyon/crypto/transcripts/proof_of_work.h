@@ -0,0 +1,144 @@
+#ifndef TACHYON_CRYPTO_TRANSCRIPTS_PROOF_OF_WORK_H_
+#define TACHYON_CRYPTO_TRANSCRIPTS_PROOF_OF_WORK_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/crypto/transcripts/proof_of_work_hasher.h"
+#include "tachyon/crypto/transcripts/transcript.h"
+
+namespace tachyon::crypto {
+
+// Grinding makes a prover find a nonce such that H(seed || nonce) has |bits|
+// leading zero bits, where the seed is squeezed from the transcript. Since it
+// takes 2^|bits| hashes on average, it adds |bits| bits of security to the
+// challenges squeezed after the nonce is written to the transcript.
+template <typename F>
+class ProofOfWork {
+ public:
+  constexpr static uint32_t kMaxBits = 63;
+  // The number of the nonces hashed by a thread at once.
+  constexpr static size_t kChunkSize = 1024;
+
+  // Returns true if |hash| has |bits| leading zero bits.
+  constexpr static bool IsValid(uint64_t hash, uint32_t bits) {
+    return bits == 0 || (hash >> (64 - bits)) == 0;
+  }
+
+  // Returns the number of the nonces that fit in |F|, which is the modulus if
+  // it is less than 2⁶⁴.
+  constexpr static uint64_t GetNumNonces() {
+    if constexpr (F::kLimbNums == 1) {
+      return F::Config::kModulus[0];
+    } else {
+      return std::numeric_limits<uint64_t>::max();
+    }
+  }
+
+  // Populates |nonce| with the smallest nonce for |seed| among the ones that
+  // fit in |F|. Returns false if there is none. The nonces are searched in
+  // chunks of |kChunkSize| by every thread, and a thread stops once a nonce
+  // smaller than its next chunk is found by any thread.
+  [[nodiscard]] static bool Grind(const ProofOfWorkHasher<F>& hasher,
+                                  const F& seed, uint32_t bits,
+                                  uint64_t* nonce) {
+    CHECK_LE(bits, kMaxBits);
+    constexpr uint64_t kNumNonces = GetNumNonces();
+    std::atomic<uint64_t> found(kNumNonces);
+#if defined(TACHYON_HAS_OPENMP)
+#pragma omp parallel
+#endif
+    {
+#if defined(TACHYON_HAS_OPENMP)
+      uint64_t thread = static_cast<uint64_t>(omp_get_thread_num());
+      uint64_t num_threads = static_cast<uint64_t>(omp_get_num_threads());
+#else
+      uint64_t thread = 0;
+      uint64_t num_threads = 1;
+#endif
+      std::vector<uint64_t> hashes(kChunkSize);
+      for (uint64_t from = thread * kChunkSize;
+           from < found.load(std::memory_order_relaxed);
+           from += num_threads * kChunkSize) {
+        size_t size = static_cast<size_t>(
+            std::min(uint64_t{kChunkSize}, kNumNonces - from));
+        absl::Span<uint64_t> chunk = absl::MakeSpan(hashes).first(size);
+        hasher.ComputeHashes(seed, from, chunk);
+        for (size_t i = 0; i < size; ++i) {
+          if (!IsValid(chunk[i], bits)) continue;
+          uint64_t candidate = from + i;
+          uint64_t current = found.load(std::memory_order_relaxed);
+          while (candidate < current &&
+                 !found.compare_exchange_weak(current, candidate,
+                                              std::memory_order_relaxed)) {
+          }
+          break;
+        }
+      }
+    }
+    *nonce = found.load();
+    return *nonce != kNumNonces;
+  }
+
+  static bool Verify(const ProofOfWorkHasher<F>& hasher, const F& seed,
+                     uint32_t bits, uint64_t nonce) {
+    if (bits > kMaxBits) {
+      LOG(ERROR) << "Too many bits: " << bits;
+      return false;
+    }
+    return IsValid(hasher.ComputeHash(seed, nonce), bits);
+  }
+
+  // Squeezes a seed from |writer|, grinds it and writes the nonce to the
+  // proof. It does nothing if |bits| is 0.
+  template <typename Commitment>
+  [[nodiscard]] static bool Grind(TranscriptWriter<Commitment>* writer,
+                                  const ProofOfWorkHasher<F>& hasher,
+                                  uint32_t bits) {
+    if (bits == 0) return true;
+    F seed = writer->SqueezeChallenge();
+    uint64_t nonce;
+    if (!Grind(hasher, seed, bits, &nonce)) {
+      LOG(ERROR) << "No nonce fits in the field";
+      return false;
+    }
+    return writer->WriteToProof(F::FromBigInt(typename F::BigIntTy(nonce)));
+  }
+
+  // Squeezes a seed from |reader|, reads the nonce from the proof and
+  // verifies it. It does nothing if |bits| is 0.
+  template <typename Commitment>
+  [[nodiscard]] static bool Verify(TranscriptReader<Commitment>* reader,
+                                   const ProofOfWorkHasher<F>& hasher,
+                                   uint32_t bits) {
+    if (bits == 0) return true;
+    F seed = reader->SqueezeChallenge();
+    F value;
+    if (!reader->ReadFromProof(&value)) return false;
+    typename F::BigIntTy nonce = value.ToBigInt();
+    for (size_t i = 1; i < F::kLimbNums; ++i) {
+      if (nonce[i] != 0) {
+        LOG(ERROR) << "Nonce is too big";
+        return false;
+      }
+    }
+    if (!Verify(hasher, seed, bits, nonce[0])) {
+      LOG(ERROR) << "Invalid proof of work";
+      return false;
+    }
+    return true;
+  }
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_TRANSCRIPTS_PROOF_OF_WORK_H_
@@ -0,0 +1,32 @@
+#ifndef TACHYON_CRYPTO_TRANSCRIPTS_PROOF_OF_WORK_HASHER_H_
+#define TACHYON_CRYPTO_TRANSCRIPTS_PROOF_OF_WORK_HASHER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "absl/types/span.h"
+
+namespace tachyon::crypto {
+
+// Hashes a seed drawn from a transcript with a nonce for |ProofOfWork|.
+template <typename F>
+class ProofOfWorkHasher {
+ public:
+  virtual ~ProofOfWorkHasher() = default;
+
+  // Returns the first 64 bits of H(|seed| || |nonce|) as a big-endian integer.
+  virtual uint64_t ComputeHash(const F& seed, uint64_t nonce) const = 0;
+
+  // Populates |hashes| with the hashes of the consecutive nonces starting from
+  // |nonce|. Override this to hash several nonces at once.
+  virtual void ComputeHashes(const F& seed, uint64_t nonce,
+                             absl::Span<uint64_t> hashes) const {
+    for (size_t i = 0; i < hashes.size(); ++i) {
+      hashes[i] = ComputeHash(seed, nonce + i);
+    }
+  }
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_TRANSCRIPTS_PROOF_OF_WORK_HASHER_H_
@@ -0,0 +1,123 @@
+#include "tachyon/crypto/transcripts/proof_of_work.h"
+
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/contains.h"
+#include "tachyon/crypto/transcripts/sha256_proof_of_work_hasher.h"
+#include "tachyon/crypto/transcripts/simple_transcript.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+#include "tachyon/math/finite_fields/test/gf7.h"
+
+namespace tachyon::crypto {
+
+namespace {
+
+using F = math::bn254::Fr;
+
+class ProofOfWorkTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() {
+    F::Init();
+    math::GF7::Init();
+  }
+
+ protected:
+  Sha256ProofOfWorkHasher<F> hasher_;
+};
+
+// Accepts only the nonces in |valid_nonces| regardless of the seed.
+class FixedProofOfWorkHasher : public ProofOfWorkHasher<math::GF7> {
+ public:
+  explicit FixedProofOfWorkHasher(std::vector<uint64_t> valid_nonces)
+      : valid_nonces_(std::move(valid_nonces)) {}
+
+  // ProofOfWorkHasher<math::GF7> methods
+  uint64_t ComputeHash(const math::GF7& seed, uint64_t nonce) const override {
+    return base::Contains(valid_nonces_, nonce)
+               ? 0
+               : std::numeric_limits<uint64_t>::max();
+  }
+
+ private:
+  std::vector<uint64_t> valid_nonces_;
+};
+
+}  // namespace
+
+TEST_F(ProofOfWorkTest, ComputeHashes) {
+  F seed = F::Random();
+  // More than the number of the lanes to test the last partial batch.
+  std::vector<uint64_t> hashes(37);
+  hasher_.ComputeHashes(seed, 100, absl::MakeSpan(hashes));
+  for (size_t i = 0; i < hashes.size(); ++i) {
+    EXPECT_EQ(hashes[i], hasher_.ComputeHash(seed, 100 + i));
+  }
+}
+
+TEST_F(ProofOfWorkTest, Grind) {
+  F seed = F::Random();
+  for (uint32_t bits : {0, 1, 8, 12}) {
+    SCOPED_TRACE(bits);
+    uint64_t nonce;
+    ASSERT_TRUE(ProofOfWork<F>::Grind(hasher_, seed, bits, &nonce));
+    EXPECT_TRUE(ProofOfWork<F>::Verify(hasher_, seed, bits, nonce));
+    // The smallest one is found regardless of the number of the threads.
+    for (uint64_t i = 0; i < nonce; ++i) {
+      ASSERT_FALSE(ProofOfWork<F>::Verify(hasher_, seed, bits, i));
+    }
+  }
+}
+
+TEST_F(ProofOfWorkTest, GrindOnSmallField) {
+  EXPECT_EQ(ProofOfWork<math::GF7>::GetNumNonces(), uint64_t{7});
+
+  math::GF7 seed = math::GF7::Random();
+  uint64_t nonce;
+  // Only the nonces less than the modulus are searched.
+  FixedProofOfWorkHasher hasher({7, 8});
+  EXPECT_FALSE(ProofOfWork<math::GF7>::Grind(hasher, seed, 8, &nonce));
+
+  hasher = FixedProofOfWorkHasher({6, 7});
+  ASSERT_TRUE(ProofOfWork<math::GF7>::Grind(hasher, seed, 8, &nonce));
+  EXPECT_EQ(nonce, uint64_t{6});
+}
+
+TEST_F(ProofOfWorkTest, GrindOnTranscript) {
+  constexpr uint32_t kBits = 10;
+
+  base::Uint8VectorBuffer write_buffer;
+  SimpleTranscriptWriter<F> writer(std::move(write_buffer));
+  ASSERT_TRUE(writer.WriteToProof(F::Random()));
+  ASSERT_TRUE(ProofOfWork<F>::Grind(&writer, hasher_, kBits));
+  F challenge = writer.SqueezeChallenge();
+
+  SimpleTranscriptReader<F> reader(std::move(writer).TakeBuffer());
+  reader.buffer().set_buffer_offset(0);
+  F value;
+  ASSERT_TRUE(reader.ReadFromProof(&value));
+  ASSERT_TRUE(ProofOfWork<F>::Verify(&reader, hasher_, kBits));
+  // The nonce is written to the transcript.
+  EXPECT_EQ(reader.SqueezeChallenge(), challenge);
+
+  // An invalid nonce is rejected.
+  base::Uint8VectorBuffer write_buffer2;
+  SimpleTranscriptWriter<F> writer2(std::move(write_buffer2));
+  ASSERT_TRUE(writer2.WriteToProof(value));
+  F seed = writer2.SqueezeChallenge();
+  uint64_t invalid_nonce = 0;
+  while (ProofOfWork<F>::Verify(hasher_, seed, kBits, invalid_nonce)) {
+    ++invalid_nonce;
+  }
+  ASSERT_TRUE(writer2.WriteToProof(F(invalid_nonce)));
+
+  SimpleTranscriptReader<F> reader2(std::move(writer2).TakeBuffer());
+  reader2.buffer().set_buffer_offset(0);
+  ASSERT_TRUE(reader2.ReadFromProof(&value));
+  EXPECT_FALSE(ProofOfWork<F>::Verify(&reader2, hasher_, kBits));
+}
+
+}  // namespace tachyon::crypto
@@ -0,0 +1,79 @@
+#ifndef TACHYON_CRYPTO_TRANSCRIPTS_SHA256_PROOF_OF_WORK_HASHER_H_
+#define TACHYON_CRYPTO_TRANSCRIPTS_SHA256_PROOF_OF_WORK_HASHER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include "absl/types/span.h"
+
+#include "tachyon/crypto/hashes/multi_buffer/sha256_multi_buffer.h"
+#include "tachyon/crypto/transcripts/proof_of_work_hasher.h"
+
+namespace tachyon::crypto {
+
+// Hashes the little-endian bytes of the seed followed by the 8 little-endian
+// bytes of the nonce with SHA-256. The nonces are hashed
+// |Sha256MultiBuffer<>::kNumLanes| at a time.
+template <typename F>
+class Sha256ProofOfWorkHasher : public ProofOfWorkHasher<F> {
+ public:
+  using Sha256 = Sha256MultiBuffer<>;
+
+  constexpr static size_t kSeedSize = F::kLimbNums * 8;
+  constexpr static size_t kMessageSize = kSeedSize + 8;
+
+  // ProofOfWorkHasher<F> methods
+  uint64_t ComputeHash(const F& seed, uint64_t nonce) const override {
+    uint64_t hash;
+    ComputeHashes(seed, nonce, absl::MakeSpan(&hash, 1));
+    return hash;
+  }
+
+  void ComputeHashes(const F& seed, uint64_t nonce,
+                     absl::Span<uint64_t> hashes) const override {
+    uint8_t seed_bytes[kSeedSize];
+    auto big_int = seed.ToBigInt();
+    for (size_t i = 0; i < F::kLimbNums; ++i) {
+      StoreLittleEndian(big_int[i], seed_bytes + 8 * i);
+    }
+
+    uint8_t messages[Sha256::kNumLanes * kMessageSize];
+    uint8_t digests[Sha256::kNumLanes * Sha256::kDigestSize];
+    for (size_t i = 0; i < hashes.size(); i += Sha256::kNumLanes) {
+      size_t num_lanes = std::min(Sha256::kNumLanes, hashes.size() - i);
+      for (size_t l = 0; l < num_lanes; ++l) {
+        uint8_t* message = messages + l * kMessageSize;
+        memcpy(message, seed_bytes, kSeedSize);
+        StoreLittleEndian(nonce + i + l, message + kSeedSize);
+      }
+      Sha256::Hash(absl::MakeConstSpan(messages, num_lanes * kMessageSize),
+                   kMessageSize,
+                   absl::MakeSpan(digests, num_lanes * Sha256::kDigestSize));
+      for (size_t l = 0; l < num_lanes; ++l) {
+        hashes[i + l] = LoadBigEndian(digests + l * Sha256::kDigestSize);
+      }
+    }
+  }
+
+ private:
+  static void StoreLittleEndian(uint64_t value, uint8_t* dst) {
+    for (size_t i = 0; i < 8; ++i) {
+      dst[i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+  }
+
+  static uint64_t LoadBigEndian(const uint8_t* src) {
+    uint64_t ret = 0;
+    for (size_t i = 0; i < 8; ++i) {
+      ret = (ret << 8) | src[i];
+    }
+    return ret;
+  }
+};
+
+}  // namespace tachyon::crypto
+
+#endif  // TACHYON_CRYPTO_TRANSCRIPTS_SHA256_PROOF_OF_WORK_HASHER_H_
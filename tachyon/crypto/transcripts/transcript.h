@@ -9,6 +9,8 @@
 
 #include <utility>
 
+#include "absl/types/span.h"
+
 #include "tachyon/base/buffer/vector_buffer.h"
 #include "tachyon/crypto/transcripts/transcript_traits.h"
 
@@ -44,6 +46,28 @@ class TranscriptImpl<_Commitment, false> {
   // treating it as a common input.
   [[nodiscard]] virtual bool WriteToTranscript(const Field& value) = 0;
 
+  // Write |commitments| to the transcript without writing them to the proof.
+  // This is equivalent to calling |WriteToTranscript()| for every commitment
+  // in order, but it can be overridden to hash them at once.
+  [[nodiscard]] virtual bool BatchWriteToTranscript(
+      absl::Span<const Commitment> commitments) {
+    for (const Commitment& commitment : commitments) {
+      if (!WriteToTranscript(commitment)) return false;
+    }
+    return true;
+  }
+
+  // Write |values| to the transcript without writing them to the proof.
+  // This is equivalent to calling |WriteToTranscript()| for every value in
+  // order, but it can be overridden to hash them at once.
+  [[nodiscard]] virtual bool BatchWriteToTranscript(
+      absl::Span<const Field> values) {
+    for (const Field& value : values) {
+      if (!WriteToTranscript(value)) return false;
+    }
+    return true;
+  }
+
   TranscriptWriterImpl<Commitment, false>* ToWriter() {
     return static_cast<TranscriptWriterImpl<Commitment, false>*>(this);
   }
@@ -67,6 +91,17 @@ class TranscriptImpl<_Field, true> {
   // treating it as a common input.
   [[nodiscard]] virtual bool WriteToTranscript(const Field& value) = 0;
 
+  // Write |values| to the transcript without writing them to the proof.
+  // This is equivalent to calling |WriteToTranscript()| for every value in
+  // order, but it can be overridden to hash them at once.
+  [[nodiscard]] virtual bool BatchWriteToTranscript(
+      absl::Span<const Field> values) {
+    for (const Field& value : values) {
+      if (!WriteToTranscript(value)) return false;
+    }
+    return true;
+  }
+
   TranscriptWriterImpl<Field, true>* ToWriter() {
     return static_cast<TranscriptWriterImpl<Field, true>*>(this);
   }
@@ -107,6 +142,22 @@ class TranscriptReaderImpl<Commitment, false> : public Transcript<Commitment> {
     return DoReadFromProof(value) && this->WriteToTranscript(*value);
   }
 
+  // Read |commitments| from the proof at once. Note that it also writes the
+  // |commitments| to the transcript by calling |BatchWriteToTranscript()|
+  // internally.
+  [[nodiscard]] bool BatchReadFromProof(absl::Span<Commitment> commitments) {
+    return DoBatchReadFromProof(commitments) &&
+           this->BatchWriteToTranscript(absl::MakeConstSpan(commitments));
+  }
+
+  // Read |values| from the proof at once. Note that it also writes the
+  // |values| to the transcript by calling |BatchWriteToTranscript()|
+  // internally.
+  [[nodiscard]] bool BatchReadFromProof(absl::Span<Field> values) {
+    return DoBatchReadFromProof(values) &&
+           this->BatchWriteToTranscript(absl::MakeConstSpan(values));
+  }
+
  protected:
   //  Read a |commitment| from the proof.
   [[nodiscard]] virtual bool DoReadFromProof(Commitment* commitment) const = 0;
@@ -114,6 +165,24 @@ class TranscriptReaderImpl<Commitment, false> : public Transcript<Commitment> {
   //  Read a |value| from the proof.
   [[nodiscard]] virtual bool DoReadFromProof(Field* value) const = 0;
 
+  //  Read |commitments| from the proof. By default, they are read one by one.
+  [[nodiscard]] virtual bool DoBatchReadFromProof(
+      absl::Span<Commitment> commitments) const {
+    for (Commitment& commitment : commitments) {
+      if (!DoReadFromProof(&commitment)) return false;
+    }
+    return true;
+  }
+
+  //  Read |values| from the proof. By default, they are read one by one.
+  [[nodiscard]] virtual bool DoBatchReadFromProof(
+      absl::Span<Field> values) const {
+    for (Field& value : values) {
+      if (!DoReadFromProof(&value)) return false;
+    }
+    return true;
+  }
+
   base::Buffer buffer_;
 };
 
@@ -134,10 +203,27 @@ class TranscriptReaderImpl<Field, true> : public Transcript<Field> {
     return DoReadFromProof(value) && this->WriteToTranscript(*value);
   }
 
+  // Read |values| from the proof at once. Note that it also writes the
+  // |values| to the transcript by calling |BatchWriteToTranscript()|
+  // internally.
+  [[nodiscard]] bool BatchReadFromProof(absl::Span<Field> values) {
+    return DoBatchReadFromProof(values) &&
+           this->BatchWriteToTranscript(absl::MakeConstSpan(values));
+  }
+
  protected:
   //  Read a |value| from the proof.
   [[nodiscard]] virtual bool DoReadFromProof(Field* value) const = 0;
 
+  //  Read |values| from the proof. By default, they are read one by one.
+  [[nodiscard]] virtual bool DoBatchReadFromProof(
+      absl::Span<Field> values) const {
+    for (Field& value : values) {
+      if (!DoReadFromProof(&value)) return false;
+    }
+    return true;
+  }
+
   base::Buffer buffer_;
 };
 
@@ -175,6 +261,22 @@ class TranscriptWriterImpl<Commitment, false> : public Transcript<Commitment> {
     return this->WriteToTranscript(value) && DoWriteToProof(value);
   }
 
+  // Write |commitments| to the proof at once. Note that it also writes the
+  // |commitments| to the transcript by calling |BatchWriteToTranscript()|
+  // internally.
+  [[nodiscard]] bool BatchWriteToProof(
+      absl::Span<const Commitment> commitments) {
+    return this->BatchWriteToTranscript(commitments) &&
+           DoBatchWriteToProof(commitments);
+  }
+
+  // Write |values| to the proof at once. Note that it also writes the
+  // |values| to the transcript by calling |BatchWriteToTranscript()|
+  // internally.
+  [[nodiscard]] bool BatchWriteToProof(absl::Span<const Field> values) {
+    return this->BatchWriteToTranscript(values) && DoBatchWriteToProof(values);
+  }
+
  protected:
   //  Write a |commitment| to the proof.
   [[nodiscard]] virtual bool DoWriteToProof(const Commitment& commitment) = 0;
@@ -182,6 +284,25 @@ class TranscriptWriterImpl<Commitment, false> : public Transcript<Commitment> {
   //  Write a |value| to the proof.
   [[nodiscard]] virtual bool DoWriteToProof(const Field& value) = 0;
 
+  //  Write |commitments| to the proof. By default, they are written one by
+  //  one.
+  [[nodiscard]] virtual bool DoBatchWriteToProof(
+      absl::Span<const Commitment> commitments) {
+    for (const Commitment& commitment : commitments) {
+      if (!DoWriteToProof(commitment)) return false;
+    }
+    return true;
+  }
+
+  //  Write |values| to the proof. By default, they are written one by one.
+  [[nodiscard]] virtual bool DoBatchWriteToProof(
+      absl::Span<const Field> values) {
+    for (const Field& value : values) {
+      if (!DoWriteToProof(value)) return false;
+    }
+    return true;
+  }
+
   base::Uint8VectorBuffer buffer_;
 };
 
@@ -206,10 +327,26 @@ class TranscriptWriterImpl<Field, true> : public Transcript<Field> {
     return this->WriteToTranscript(value) && DoWriteToProof(value);
   }
 
+  // Write |values| to the proof at once. Note that it also writes the
+  // |values| to the transcript by calling |BatchWriteToTranscript()|
+  // internally.
+  [[nodiscard]] bool BatchWriteToProof(absl::Span<const Field> values) {
+    return this->BatchWriteToTranscript(values) && DoBatchWriteToProof(values);
+  }
+
  protected:
   //  Write a |value| to the proof.
   [[nodiscard]] virtual bool DoWriteToProof(const Field& value) = 0;
 
+  //  Write |values| to the proof. By default, they are written one by one.
+  [[nodiscard]] virtual bool DoBatchWriteToProof(
+      absl::Span<const Field> values) {
+    for (const Field& value : values) {
+      if (!DoWriteToProof(value)) return false;
+    }
+    return true;
+  }
+
   base::Uint8VectorBuffer buffer_;
 };
 
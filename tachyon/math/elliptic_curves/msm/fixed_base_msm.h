@@ -0,0 +1,166 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_FIXED_BASE_MSM_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_MSM_FIXED_BASE_MSM_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+
+namespace tachyon::math {
+
+// Multiplies a single base point by many scalars. The scalar is split into
+// windows of |window_bits()| bits, and the multiples of the base for every
+// window are precomputed in the affine form once:
+//
+// clang-format off
+//   table[i][k] = (k + 1) * 2^(i * w) * G, where 0 ≤ k < 2^(w - 1)
+// clang-format on
+//
+// The digits of a scalar are recoded into [-2^(w - 1), 2^(w - 1)], so that
+// only the positive half of the table is needed since a negation is cheap.
+// Then s * G = Σᵢ sign(dᵢ) * table[i][|dᵢ| - 1], which costs a mixed addition
+// per window without any doubling.
+template <typename AffinePoint>
+class FixedBaseMSM {
+ public:
+  using ScalarField = typename AffinePoint::ScalarField;
+  using Bucket = decltype(std::declval<AffinePoint>().ToJacobian());
+
+  // The number of scalars mapped together, which are normalized at once.
+  constexpr static size_t kChunkSize = 1 << 12;
+  constexpr static size_t kMaxWindowBits = 16;
+
+  FixedBaseMSM() = default;
+  FixedBaseMSM(const AffinePoint& base, size_t window_bits)
+      : window_bits_(window_bits),
+        windows_count_(ScalarField::Config::kModulusBits / window_bits + 1),
+        table_size_(size_t{1} << (window_bits - 1)) {
+    CHECK_GT(window_bits_, size_t{0});
+    CHECK_LE(window_bits_, kMaxWindowBits);
+    std::vector<Bucket> table(windows_count_ * table_size_);
+    // |window_bases[i]| = 2^(i * w) * G
+    std::vector<Bucket> window_bases(windows_count_);
+    window_bases[0] = base.ToJacobian();
+    for (size_t i = 1; i < windows_count_; ++i) {
+      window_bases[i] = window_bases[i - 1];
+      for (size_t j = 0; j < window_bits_; ++j) {
+        window_bases[i].DoubleInPlace();
+      }
+    }
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < windows_count_; ++i) {
+      Bucket* row = &table[i * table_size_];
+      row[0] = window_bases[i];
+      for (size_t k = 1; k < table_size_; ++k) {
+        row[k] = row[k - 1] + window_bases[i];
+      }
+    }
+    table_.resize(table.size());
+    CHECK(BatchNormalize(table, absl::MakeSpan(table_)));
+  }
+
+  // Returns the window bits which balance the cost of building the table
+  // against the cost of mapping |num_scalars| scalars.
+  constexpr static size_t ComputeWindowBits(size_t num_scalars) {
+    if (num_scalars < 32) return 3;
+    // ln(n) = log₂(n) * ln(2)
+    size_t ln = base::bits::Log2Ceiling(num_scalars) * 69 / 100;
+    return std::min(ln, kMaxWindowBits);
+  }
+
+  size_t window_bits() const { return window_bits_; }
+  size_t windows_count() const { return windows_count_; }
+  absl::Span<const AffinePoint> table() const { return table_; }
+
+  Bucket Mul(const ScalarField& scalar) const {
+    auto bigint = scalar.ToBigInt();
+    constexpr size_t kBits = sizeof(bigint) * 8;
+    int64_t half = static_cast<int64_t>(table_size_);
+    int64_t carry = 0;
+    Bucket ret = Bucket::Zero();
+    for (size_t i = 0; i < windows_count_; ++i) {
+      size_t bit_offset = i * window_bits_;
+      int64_t digit = carry;
+      if (bit_offset < kBits) {
+        digit += static_cast<int64_t>(
+            bigint.ExtractBits64(bit_offset, window_bits_));
+      }
+      carry = 0;
+      if (digit > half) {
+        digit -= 2 * half;
+        carry = 1;
+      }
+      if (digit > 0) {
+        ret += table_[i * table_size_ + digit - 1];
+      } else if (digit < 0) {
+        ret += -table_[i * table_size_ - digit - 1];
+      }
+    }
+    DCHECK_EQ(carry, 0);
+    return ret;
+  }
+
+  // Populates |affine_points| with s * G for every scalar s in
+  // |scalar_fields|. The scalars are mapped in parallel by chunks and each
+  // chunk is normalized at once.
+  template <typename ScalarFieldContainer, typename AffineContainer>
+  [[nodiscard]] bool Run(const ScalarFieldContainer& scalar_fields,
+                         AffineContainer* affine_points) const {
+    size_t size = std::size(scalar_fields);
+    if (size != std::size(*affine_points)) {
+      LOG(ERROR) << "Size of |scalar_fields| and |affine_points| do not match";
+      return false;
+    }
+    const ScalarField* scalars = std::data(scalar_fields);
+    AffinePoint* outs = std::data(*affine_points);
+    std::atomic<bool> normalized = true;
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < size; i += kChunkSize) {
+      size_t chunk_size = std::min(kChunkSize, size - i);
+      std::vector<Bucket> buckets(chunk_size);
+      for (size_t j = 0; j < chunk_size; ++j) {
+        buckets[j] = Mul(scalars[i + j]);
+      }
+      absl::Span<AffinePoint> chunk(&outs[i], chunk_size);
+      if (!Bucket::BatchNormalize(buckets, &chunk)) {
+        normalized.store(false, std::memory_order_relaxed);
+      }
+    }
+    return normalized.load();
+  }
+
+ private:
+  // Normalizes |buckets| in parallel by chunks.
+  static bool BatchNormalize(const std::vector<Bucket>& buckets,
+                             absl::Span<AffinePoint> affine_points) {
+    size_t size = buckets.size();
+    std::atomic<bool> normalized = true;
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < size; i += kChunkSize) {
+      size_t chunk_size = std::min(kChunkSize, size - i);
+      absl::Span<AffinePoint> chunk = affine_points.subspan(i, chunk_size);
+      if (!Bucket::BatchNormalize(
+              absl::MakeConstSpan(buckets).subspan(i, chunk_size), &chunk)) {
+        normalized.store(false, std::memory_order_relaxed);
+      }
+    }
+    return normalized.load();
+  }
+
+  size_t window_bits_ = 0;
+  size_t windows_count_ = 0;
+  // The number of the points per window, which is 2^(|window_bits_| - 1).
+  size_t table_size_ = 0;
+  std::vector<AffinePoint> table_;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_MSM_FIXED_BASE_MSM_H_
@@ -0,0 +1,68 @@
+#include "tachyon/math/elliptic_curves/msm/fixed_base_msm.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/elliptic_curves/bls12/bls12_381/g1.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g2.h"
+
+namespace tachyon::math {
+
+namespace {
+
+template <typename Point>
+class FixedBaseMSMTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { Point::Curve::Init(); }
+};
+
+}  // namespace
+
+using PointTypes = testing::Types<bls12_381::G1AffinePoint,
+                                  bn254::G1AffinePoint, bn254::G2AffinePoint>;
+TYPED_TEST_SUITE(FixedBaseMSMTest, PointTypes);
+
+TYPED_TEST(FixedBaseMSMTest, Mul) {
+  using Point = TypeParam;
+  using ScalarField = typename Point::ScalarField;
+
+  Point base = Point::Random();
+  std::vector<ScalarField> scalars = {
+      ScalarField::Zero(), ScalarField::One(), -ScalarField::One(),
+      ScalarField::Random()};
+  for (size_t window_bits : {1, 3, 8, 13}) {
+    FixedBaseMSM<Point> msm(base, window_bits);
+    for (const ScalarField& scalar : scalars) {
+      EXPECT_EQ(msm.Mul(scalar), base * scalar);
+    }
+  }
+}
+
+TYPED_TEST(FixedBaseMSMTest, Run) {
+  using Point = TypeParam;
+  using ScalarField = typename Point::ScalarField;
+
+  // Spans more than one chunk.
+  size_t size = FixedBaseMSM<Point>::kChunkSize + 3;
+  Point base = Point::Random();
+  std::vector<ScalarField> scalars =
+      base::CreateVector(size, []() { return ScalarField::Random(); });
+  FixedBaseMSM<Point> msm(base, FixedBaseMSM<Point>::ComputeWindowBits(size));
+
+  std::vector<Point> points(size - 1);
+  ASSERT_FALSE(msm.Run(scalars, &points));
+
+  points.resize(size);
+  ASSERT_TRUE(msm.Run(scalars, &points));
+  // |Mul()| is checked against the scalar multiplication above, which is too
+  // slow for this many scalars.
+  FixedBaseMSM<Point> expected_msm(base, /*window_bits=*/4);
+  for (size_t i = 0; i < size; ++i) {
+    EXPECT_EQ(points[i], expected_msm.Mul(scalars[i]).ToAffine());
+  }
+}
+
+}  // namespace tachyon::math
@@ -0,0 +1,179 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_PRECOMPUTED_BASES_MSM_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_MSM_PRECOMPUTED_BASES_MSM_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/base/parallelize.h"
+#include "tachyon/math/elliptic_curves/affine_point.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger.h"
+#include "tachyon/math/elliptic_curves/point_conversions.h"
+
+namespace tachyon::math {
+
+// MSM over the bases which are fixed in advance, e.g. the generators of a
+// Pedersen commitment. The scalars are split into windows of |window_bits()|
+// bits, and every base shifted by every window is precomputed in the affine
+// form once:
+//
+// clang-format off
+//   table[i][k] = 2^(k * w) * Gᵢ
+// clang-format on
+//
+// Then Σᵢ sᵢ * Gᵢ = Σᵢ Σₖ dᵢₖ * table[i][k], where dᵢₖ is the k-th signed digit
+// of sᵢ. Since the windows don't need to be combined with doublings, all the
+// digits are accumulated into a single set of buckets, so that the bucket
+// reduction of Pippenger is done once instead of once per window. This costs
+// |windows_count()| times more memory than the bases.
+template <typename Point>
+class PrecomputedBasesMSM {
+ public:
+  using ScalarField = typename Point::ScalarField;
+  using Bucket = typename Pippenger<Point>::Bucket;
+  using AffinePointTy = AffinePoint<typename Point::Curve>;
+
+  constexpr static size_t kMaxWindowBits = 16;
+
+  PrecomputedBasesMSM() = default;
+  template <typename BaseContainer>
+  PrecomputedBasesMSM(const BaseContainer& bases, size_t window_bits)
+      : size_(std::size(bases)),
+        window_bits_(window_bits),
+        windows_count_(ScalarField::Config::kModulusBits / window_bits + 1) {
+    CHECK_GT(window_bits_, size_t{0});
+    CHECK_LE(window_bits_, kMaxWindowBits);
+    std::vector<Bucket> table(size_ * windows_count_);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < size_; ++i) {
+      Bucket* row = &table[i * windows_count_];
+      row[0] = ConvertPoint<Bucket>(bases[i]);
+      for (size_t k = 1; k < windows_count_; ++k) {
+        row[k] = row[k - 1];
+        for (size_t j = 0; j < window_bits_; ++j) {
+          row[k].DoubleInPlace();
+        }
+      }
+    }
+    table_.resize(table.size());
+    CHECK(BatchNormalize(table, absl::MakeSpan(table_)));
+  }
+
+  // Returns the window bits which minimize the number of additions to compute
+  // an MSM of |num_bases| bases, which is the number of the digits plus the
+  // cost of the bucket reduction.
+  constexpr static size_t ComputeWindowBits(size_t num_bases) {
+    size_t window_bits = 1;
+    size_t min_cost = std::numeric_limits<size_t>::max();
+    for (size_t w = 1; w <= kMaxWindowBits; ++w) {
+      size_t cost = num_bases * (ScalarField::Config::kModulusBits / w + 1) +
+                    (size_t{1} << w);
+      if (cost < min_cost) {
+        min_cost = cost;
+        window_bits = w;
+      }
+    }
+    return window_bits;
+  }
+
+  size_t size() const { return size_; }
+  size_t window_bits() const { return window_bits_; }
+  size_t windows_count() const { return windows_count_; }
+
+  // Populates |ret| with Σᵢ |scalars[i]| * Gᵢ. Returns false if the size of
+  // |scalars| doesn't match with the number of the bases.
+  template <typename ScalarContainer>
+  [[nodiscard]] bool Run(const ScalarContainer& scalars, Bucket* ret) const {
+    if (std::size(scalars) != size_) {
+      LOG(ERROR) << "Size of |scalars| and bases do not match";
+      return false;
+    }
+    // NOTE: Every chunk reduces its own buckets, which costs about
+    // 2^|window_bits_| additions, so the scalars are split only when their
+    // digits outnumber that.
+    std::vector<Bucket> sums = base::ParallelizeMap(
+        scalars,
+        [this](absl::Span<const ScalarField> chunk, size_t chunk_index,
+               size_t chunk_size) {
+          return Accumulate(chunk, chunk_index * chunk_size);
+        },
+        /*threshold=*/(size_t{1} << window_bits_) / windows_count_);
+    Bucket sum = Bucket::Zero();
+    for (const Bucket& chunk_sum : sums) {
+      sum += chunk_sum;
+    }
+    *ret = std::move(sum);
+    return true;
+  }
+
+ private:
+  // Returns Σᵢ |scalars[i]| * G_{|offset| + i}.
+  Bucket Accumulate(absl::Span<const ScalarField> scalars,
+                    size_t offset) const {
+    int64_t half = int64_t{1} << (window_bits_ - 1);
+    // |buckets[j]| accumulates the points whose digit is ±(j + 1).
+    std::vector<Bucket> buckets(half, Bucket::Zero());
+    for (size_t i = 0; i < scalars.size(); ++i) {
+      auto bigint = scalars[i].ToBigInt();
+      constexpr size_t kBits = sizeof(bigint) * 8;
+      const AffinePointTy* row = &table_[(offset + i) * windows_count_];
+      int64_t carry = 0;
+      for (size_t k = 0; k < windows_count_; ++k) {
+        size_t bit_offset = k * window_bits_;
+        int64_t digit = carry;
+        if (bit_offset < kBits) {
+          digit += static_cast<int64_t>(
+              bigint.ExtractBits64(bit_offset, window_bits_));
+        }
+        carry = 0;
+        if (digit > half) {
+          digit -= 2 * half;
+          carry = 1;
+        }
+        if (digit > 0) {
+          buckets[digit - 1] += row[k];
+        } else if (digit < 0) {
+          buckets[-digit - 1] += -row[k];
+        }
+      }
+      DCHECK_EQ(carry, 0);
+    }
+    return PippengerBase<Point>::AccumulateBuckets(buckets);
+  }
+
+  // Normalizes |buckets| in parallel by chunks.
+  static bool BatchNormalize(const std::vector<Bucket>& buckets,
+                             absl::Span<AffinePointTy> affine_points) {
+    constexpr size_t kChunkSize = 1 << 12;
+    size_t size = buckets.size();
+    std::atomic<bool> normalized = true;
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < size; i += kChunkSize) {
+      size_t chunk_size = std::min(kChunkSize, size - i);
+      absl::Span<AffinePointTy> chunk = affine_points.subspan(i, chunk_size);
+      if (!Bucket::BatchNormalize(
+              absl::MakeConstSpan(buckets).subspan(i, chunk_size), &chunk)) {
+        normalized.store(false, std::memory_order_relaxed);
+      }
+    }
+    return normalized.load();
+  }
+
+  size_t size_ = 0;
+  size_t window_bits_ = 0;
+  size_t windows_count_ = 0;
+  // |table_[i * |windows_count_| + k]| = 2^(k * |window_bits_|) * Gᵢ
+  std::vector<AffinePointTy> table_;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_MSM_PRECOMPUTED_BASES_MSM_H_
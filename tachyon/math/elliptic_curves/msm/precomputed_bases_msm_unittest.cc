@@ -0,0 +1,72 @@
+#include "tachyon/math/elliptic_curves/msm/precomputed_bases_msm.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/elliptic_curves/bls12/bls12_381/g1.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/elliptic_curves/msm/variable_base_msm.h"
+
+namespace tachyon::math {
+
+namespace {
+
+template <typename Point>
+class PrecomputedBasesMSMTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { Point::Curve::Init(); }
+};
+
+}  // namespace
+
+using PointTypes = testing::Types<bls12_381::G1AffinePoint,
+                                  bn254::G1AffinePoint, bn254::G1JacobianPoint>;
+TYPED_TEST_SUITE(PrecomputedBasesMSMTest, PointTypes);
+
+TYPED_TEST(PrecomputedBasesMSMTest, Run) {
+  using Point = TypeParam;
+  using ScalarField = typename Point::ScalarField;
+  using Bucket = typename PrecomputedBasesMSM<Point>::Bucket;
+
+  for (size_t size : {0, 1, 5, 300}) {
+    std::vector<Point> bases =
+        base::CreateVector(size, []() { return Point::Random(); });
+    std::vector<ScalarField> scalars =
+        base::CreateVector(size, []() { return ScalarField::Random(); });
+    if (size > 1) {
+      scalars[0] = ScalarField::Zero();
+      scalars[1] = -ScalarField::One();
+    }
+
+    VariableBaseMSM<Point> expected_msm;
+    Bucket expected;
+    ASSERT_TRUE(expected_msm.Run(bases, scalars, &expected));
+
+    for (size_t window_bits :
+         {size_t{1}, size_t{4},
+          PrecomputedBasesMSM<Point>::ComputeWindowBits(size)}) {
+      PrecomputedBasesMSM<Point> msm(bases, window_bits);
+      Bucket result;
+      ASSERT_TRUE(msm.Run(scalars, &result));
+      EXPECT_EQ(result, expected);
+    }
+  }
+}
+
+TYPED_TEST(PrecomputedBasesMSMTest, SizeMismatch) {
+  using Point = TypeParam;
+  using ScalarField = typename Point::ScalarField;
+  using Bucket = typename PrecomputedBasesMSM<Point>::Bucket;
+
+  std::vector<Point> bases =
+      base::CreateVector(3, []() { return Point::Random(); });
+  PrecomputedBasesMSM<Point> msm(bases, /*window_bits=*/4);
+  std::vector<ScalarField> scalars =
+      base::CreateVector(2, []() { return ScalarField::Random(); });
+  Bucket result;
+  EXPECT_FALSE(msm.Run(scalars, &result));
+}
+
+}  // namespace tachyon::math
@@ -1,19 +1,25 @@
 #ifndef TACHYON_MATH_ELLIPTIC_CURVES_PAIRING_PAIRING_H_
 #define TACHYON_MATH_ELLIPTIC_CURVES_PAIRING_PAIRING_H_
 
+#include <type_traits>
+
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/template_util.h"
 
 namespace tachyon::math {
 
+// |b| can be a container of G2 affine points, G2Prepared or pointers to
+// G2Prepared. Preparing a G2 point computes all of its line coefficients, so
+// the G2 points which are paired repeatedly, e.g. the ones in the SRS, should
+// be prepared once and passed as G2Prepared.
 template <typename Curve, typename G1AffinePointContainer,
           typename G2AffineOrPreparedPointContainer>
 auto Pairing(const G1AffinePointContainer& a,
              const G2AffineOrPreparedPointContainer& b) {
   using G2Prepared = typename Curve::G2Prepared;
-  if constexpr (std::is_same_v<
-                    base::container_value_t<G2AffineOrPreparedPointContainer>,
-                    G2Prepared>) {
+  using G2Value = base::container_value_t<G2AffineOrPreparedPointContainer>;
+  if constexpr (std::is_same_v<G2Value, G2Prepared> ||
+                std::is_same_v<G2Value, const G2Prepared*>) {
     return Curve::FinalExponentiation(Curve::MultiMillerLoop(a, b));
   } else {
     using G2AffinePoint = typename Curve::G2Curve::AffinePoint;
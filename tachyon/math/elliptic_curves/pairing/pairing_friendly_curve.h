@@ -66,6 +66,10 @@ class PairingFriendlyCurve {
     }
   }
 
+  // NOTE: |b| can be a container of either G2Prepared or pointers
+  // to G2Prepared. The latter lets the caller pair with G2Prepared which are
+  // held elsewhere, e.g. by a commitment scheme, without copying their line
+  // coefficients.
   template <typename G1AffinePointContainer, typename G2PreparedContainer>
   static std::vector<Pair> CreatePairs(const G1AffinePointContainer& a,
                                        const G2PreparedContainer& b) {
@@ -74,12 +78,24 @@ class PairingFriendlyCurve {
     std::vector<Pair> pairs;
     pairs.reserve(size);
     for (size_t i = 0; i < size; ++i) {
-      if (!a[i].infinity() && !b[i].infinity()) {
-        pairs.emplace_back(&a[i], &b[i].ell_coeffs());
+      const auto& prepared = Deref(b[i]);
+      if (!a[i].infinity() && !prepared.infinity()) {
+        pairs.emplace_back(&a[i], &prepared.ell_coeffs());
       }
     }
     return pairs;
   }
+
+ private:
+  template <typename G2Prepared>
+  static const G2Prepared& Deref(const G2Prepared& prepared) {
+    return prepared;
+  }
+
+  template <typename G2Prepared>
+  static const G2Prepared& Deref(const G2Prepared* prepared) {
+    return *prepared;
+  }
 };
 
 }  // namespace tachyon::math
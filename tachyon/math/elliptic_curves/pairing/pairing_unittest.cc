@@ -72,4 +72,22 @@ TYPED_TEST(PairingTest, Bilinearity) {
   EXPECT_EQ(result, result4);
 }
 
+TYPED_TEST(PairingTest, PreparedInputs) {
+  using Curve = TypeParam;
+  using G1AffinePoint = typename Curve::G1Curve::AffinePoint;
+  using G2AffinePoint = typename Curve::G2Curve::AffinePoint;
+  using G2Prepared = typename Curve::G2Prepared;
+  using Fp12 = typename Curve::Fp12;
+
+  G1AffinePoint g1s[] = {G1AffinePoint::Random(), G1AffinePoint::Random()};
+  G2AffinePoint g2s[] = {G2AffinePoint::Random(), G2AffinePoint::Random()};
+  Fp12 expected = Pairing<Curve>(g1s, g2s);
+
+  G2Prepared prepared[] = {G2Prepared::From(g2s[0]), G2Prepared::From(g2s[1])};
+  EXPECT_EQ(Pairing<Curve>(g1s, prepared), expected);
+
+  const G2Prepared* prepared_ptrs[] = {&prepared[0], &prepared[1]};
+  EXPECT_EQ(Pairing<Curve>(g1s, prepared_ptrs), expected);
+}
+
 }  // namespace tachyon::math
@@ -16,6 +16,7 @@
 #include "tachyon/math/elliptic_curves/affine_point.h"
 #include "tachyon/math/elliptic_curves/curve_type.h"
 #include "tachyon/math/elliptic_curves/jacobian_point.h"
+#include "tachyon/math/elliptic_curves/msm/fixed_base_msm.h"
 #include "tachyon/math/elliptic_curves/point_xyzz.h"
 #include "tachyon/math/elliptic_curves/projective_point.h"
 #include "tachyon/math/elliptic_curves/semigroups.h"
@@ -105,6 +106,9 @@ class AffinePoint<
                        point.y_);
   }
 
+  // Maps the scalars to the multiples of |point| using the precomputed
+  // tables of |FixedBaseMSM|. To map scalars to the same point more than once,
+  // use |FixedBaseMSM| directly to reuse the tables.
   template <typename ScalarFieldContainer, typename AffineContainer>
   [[nodiscard]] constexpr static bool BatchMapScalarFieldToPoint(
       const AffinePoint& point, const ScalarFieldContainer& scalar_fields,
@@ -114,10 +118,9 @@ class AffinePoint<
       LOG(ERROR) << "Size of |scalar_fields| and |affine_points| do not match";
       return false;
     }
-    std::vector<JacobianPoint<Curve>> jacobian_points = base::Map(
-        scalar_fields,
-        [&point](const ScalarField& scalar) { return scalar * point; });
-    return JacobianPoint<Curve>::BatchNormalize(jacobian_points, affine_points);
+    FixedBaseMSM<AffinePoint> msm(
+        point, FixedBaseMSM<AffinePoint>::ComputeWindowBits(size));
+    return msm.Run(scalar_fields, affine_points);
   }
 
   constexpr const BaseField& x() const { return x_; }
@@ -8,6 +8,10 @@ namespace tachyon::math {
 template <typename PrimeField>
 using Matrix = Eigen::Matrix<PrimeField, Eigen::Dynamic, Eigen::Dynamic>;
 
+template <typename PrimeField>
+using RowMajorMatrix = Eigen::Matrix<PrimeField, Eigen::Dynamic,
+                                     Eigen::Dynamic, Eigen::RowMajor>;
+
 template <typename PrimeField>
 using Vector = Eigen::Matrix<PrimeField, Eigen::Dynamic, 1>;
 
@@ -25,9 +25,9 @@
 
 #include "absl/memory/memory.h"
 
-#include "tachyon/base/bits.h"
 #include "tachyon/base/logging.h"
 #include "tachyon/base/numerics/checked_math.h"
+#include "tachyon/base/openmp_util.h"
 #include "tachyon/math/base/gmp/gmp_util.h"
 #include "tachyon/math/finite_fields/prime_field_base.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluation_domain.h"
@@ -36,11 +36,11 @@ namespace tachyon::math {
 
 template <typename F>
 constexpr size_t MaxDegreeForMixedRadixEvaluationDomain() {
-  size_t i = 1;
-  for (size_t i = 0; i <= F::Config::kSmallSubgroupAdicity; ++i) {
-    i *= F::Config::kSmallSubgroupBase;
+  size_t q_part = 1;
+  for (size_t i = 0; i < F::Config::kSmallSubgroupAdicity; ++i) {
+    q_part *= F::Config::kSmallSubgroupBase;
   }
-  return i * (size_t{1} << F::Config::kTwoAdicity) - 1;
+  return q_part * (size_t{1} << F::Config::kTwoAdicity) - 1;
 }
 
 // Defines a domain over which finite field (I)FFTs can be performed. Works only
@@ -58,6 +58,9 @@ class MixedRadixEvaluationDomain
   using SparsePoly = UnivariateSparsePolynomial<F, MaxDegree>;
 
   constexpr static size_t kMaxDegree = MaxDegree;
+  // The minimum number of butterflies of a pass that a thread handles. This
+  // prevents small passes from being split into too many chunks.
+  constexpr static size_t kMinNumButterfliesPerThread = 1 << 6;
 
   constexpr static std::unique_ptr<MixedRadixEvaluationDomain> Create(
       size_t num_coeffs) {
@@ -76,7 +79,10 @@ class MixedRadixEvaluationDomain
   }
 
  private:
-  using UnivariateEvaluationDomain<F, MaxDegree>::UnivariateEvaluationDomain;
+  constexpr MixedRadixEvaluationDomain(size_t size, uint32_t log_size_of_group)
+      : Base(size, log_size_of_group),
+        twiddles_(std::make_shared<const std::vector<F>>(
+            F::GetSuccessivePowers(size, this->group_gen_))) {}
 
   // UnivariateEvaluationDomain methods
   constexpr std::unique_ptr<UnivariateEvaluationDomain<F, MaxDegree>> Clone()
@@ -87,13 +93,22 @@ class MixedRadixEvaluationDomain
   [[nodiscard]] constexpr Evals FFT(const DensePoly& poly) const override {
     if (poly.IsZero()) return {};
 
+    // NOTE: The capacity is reserved up front, so that resizing the
+    // evaluations to |this->size_| in |FFTInPlace()| doesn't reallocate.
     Evals evals;
-    evals.evaluations_ = poly.coefficients_.coefficients_;
-    if (!this->offset_.IsOne()) {
-      Base::DistributePowers(evals, this->offset_);
-    }
-    evals.evaluations_.resize(this->size_, F::Zero());
-    BestFFT(evals, this->group_gen_);
+    evals.evaluations_.reserve(this->size_);
+    evals.evaluations_.assign(poly.coefficients_.coefficients_.begin(),
+                              poly.coefficients_.coefficients_.end());
+    FFTInPlace(evals);
+    return evals;
+  }
+
+  [[nodiscard]] constexpr Evals FFT(DensePoly&& poly) const override {
+    if (poly.IsZero()) return {};
+
+    Evals evals;
+    evals.evaluations_ = std::move(poly.coefficients_.coefficients_);
+    FFTInPlace(evals);
     return evals;
   }
 
@@ -103,9 +118,33 @@ class MixedRadixEvaluationDomain
     if (evals.IsZero()) return {};
 
     DensePoly poly;
-    poly.coefficients_.coefficients_ = evals.evaluations_;
+    poly.coefficients_.coefficients_.reserve(this->size_);
+    poly.coefficients_.coefficients_.assign(evals.evaluations_.begin(),
+                                            evals.evaluations_.end());
+    IFFTInPlace(poly);
+    return poly;
+  }
+
+  [[nodiscard]] constexpr DensePoly IFFT(Evals&& evals) const override {
+    if (evals.IsZero()) return {};
+
+    DensePoly poly;
+    poly.coefficients_.coefficients_ = std::move(evals.evaluations_);
+    IFFTInPlace(poly);
+    return poly;
+  }
+
+  constexpr void FFTInPlace(Evals& evals) const {
+    if (!this->offset_.IsOne()) {
+      Base::DistributePowers(evals, this->offset_);
+    }
+    evals.evaluations_.resize(this->size_, F::Zero());
+    MixedRadixFFTInPlace(evals, /*inverse=*/false);
+  }
+
+  constexpr void IFFTInPlace(DensePoly& poly) const {
     poly.coefficients_.coefficients_.resize(this->size_, F::Zero());
-    BestFFT(poly, this->group_gen_inv_);
+    MixedRadixFFTInPlace(poly, /*inverse=*/true);
     if (this->offset_.IsOne()) {
       // clang-format off
       OPENMP_PARALLEL_FOR(F& coeff : poly.coefficients_.coefficients_) {
@@ -117,7 +156,6 @@ class MixedRadixEvaluationDomain
                                           this->size_inv_);
     }
     poly.coefficients_.RemoveHighDegreeZeros();
-    return poly;
   }
 
   constexpr static bool ComputeSizeAndFactors(size_t num_coeffs,
@@ -177,28 +215,27 @@ class MixedRadixEvaluationDomain
     return best;
   }
 
-  template <typename PolyOrEvals>
-  void BestFFT(PolyOrEvals& poly_or_evals, const F& omega) const {
-#if defined(TACHYON_HAS_OPENMP)
-    uint32_t thread_nums = static_cast<uint32_t>(omp_get_max_threads());
-    uint32_t log_thread_nums = base::bits::Log2Floor(thread_nums);
-    if (this->log_size_of_group_ <= log_thread_nums) {
-#endif
-      return SerialFFT(poly_or_evals, omega, this->log_size_of_group_);
-#if defined(TACHYON_HAS_OPENMP)
-    } else {
-      return ParallelFFT(poly_or_evals, omega, this->log_size_of_group_,
-                         log_thread_nums);
-    }
-#endif
+  // Returns ωⁱ if |inverse| is false, otherwise ω⁻ⁱ, where ω is
+  // |this->group_gen_| and i is less than |this->size_|.
+  constexpr const F& GetTwiddle(size_t i, bool inverse) const {
+    const std::vector<F>& twiddles = *twiddles_;
+    return (inverse && i != 0) ? twiddles[this->size_ - i] : twiddles[i];
   }
 
+  // Performs the FFT, or the IFFT without the scaling by |this->size_inv_| if
+  // |inverse| is true, in place.
+  //
+  // Conceptually, this FFT first splits into 2 sub-arrays |two_adicity| many
+  // times, and then splits into q sub-arrays |q_adicity| many times. So after
+  // permuting the input, it merges the sub-FFTs q at a time |q_adicity| many
+  // times, and then 2 at a time |two_adicity| many times. Every butterfly
+  // within a pass is independent, so each pass is parallelized over the
+  // butterflies, and the twiddles are looked up from |twiddles_| instead of
+  // being accumulated by multiplications.
   template <typename PolyOrEvals>
-  static void SerialFFT(PolyOrEvals& a, const F& omega, uint32_t two_adicity) {
-    // Conceptually, this FFT first splits into 2 sub-arrays |two_adicity| many
-    // times, and then splits into q sub-arrays |q_adicity| many times.
-
+  void MixedRadixFFTInPlace(PolyOrEvals& a, bool inverse) const {
     size_t n = a.NumElements();
+    uint32_t two_adicity = this->log_size_of_group_;
     uint64_t q = uint64_t{F::Config::kSmallSubgroupBase};
     uint64_t n_u64 = n;
 
@@ -209,178 +246,157 @@ class MixedRadixEvaluationDomain
 
     CHECK_EQ(n_u64, q_part * two_part);
 
-    size_t m = 1;
     if (q_adicity > 0) {
-      // If we're using the other radix, we have to do two things differently
-      // than in the radix 2 case. 1. Applying the index permutation is a bit
-      // more complicated. It isn't an involution (like it is in the radix 2
-      // case) so we need to remember which elements we've moved as we go along
-      // and can't use the trick of just swapping when processing the first
-      // element of a 2-cycle.
-      //
-      // 2. We need to do |q_adicity| many merge passes, each of which is a bit
-      // more complicated than the specialized q=2 case.
-
-      // Applying the permutation
-      std::vector<bool> seen(n, false);
-      for (size_t k = 0; k < n; ++k) {
-        size_t i = k;
-        F& a_i = *a[i];
-        while (!seen[i]) {
-          size_t dest = MixedRadixFFTPermute(two_adicity, q_adicity, q, n, i);
-          std::swap(*a[dest], a_i);
-          seen[i] = true;
-          i = dest;
-        }
-      }
-
-      F omega_q = omega.Pow(n / q);
-      std::vector<F> qth_roots(q, F::One());
-      for (size_t i = 1; i < q; ++i) {
-        qth_roots[i] = qth_roots[i - 1] * omega_q;
-      }
-
-      std::vector<F> terms(q - 1, F::Zero());
-
-      // Doing the q_adicity passes.
-      for (size_t i = 0; i < q_adicity; ++i) {
-        F w_m = omega.Pow(n / (q * m));
-        for (size_t k = 0; k < n; k += q * m) {
-          F w_j = F::One();  // ωⱼ is ωₘʲ
-          for (size_t j = 0; j < m; ++j) {
-            const F& base_term = *a[k + j];
-            F w_j_i = w_j;
-            for (size_t i = 1; i < q; ++i) {
-              terms[i - 1] = *a[k + j + i * m];
-              terms[i - 1] *= w_j_i;
-              w_j_i *= w_j;
-            }
-
-            for (size_t i = 0; i < q; ++i) {
-              *a[k + j + i * m] = base_term;
-              for (size_t l = 1; l < q; ++l) {
-                F tmp = terms[l - 1];
-                tmp *= qth_roots[(i * l) % q];
-                *a[k + j + i * m] += tmp;
-              }
-            }
-
-            w_j *= w_m;
-          }
-        }
-        m *= q;
-      }
+      Permute(a, two_adicity, q_adicity, q);
     } else {
       // Swapping in place (from Storer's book)
       UnivariateEvaluationDomain<F, MaxDegree>::SwapElements(a, n, two_adicity);
     }
 
-    for (size_t i = 0; i < two_adicity; ++i) {
-      // ωₘ is 2ˢ-th root of unity now
-      F w_m = omega.Pow(n / (2 * m));
-      for (size_t k = 0; k < n; k += 2 * m) {
-        F w = F::One();
-        for (size_t j = 0; j < m; ++j) {
-          UnivariateEvaluationDomain<F, MaxDegree>::ButterflyFnOutIn(
-              *a[k + j], *a[(k + m) + j], w);
-          w *= w_m;
-        }
+    size_t m = 1;
+    for (uint32_t i = 0; i < q_adicity; ++i) {
+      if (q == 3) {
+        Radix3Pass(a, m, inverse);
+      } else {
+        RadixQPass(a, q, m, inverse);
       }
+      m *= q;
+    }
+    for (uint32_t i = 0; i < two_adicity; ++i) {
+      Radix2Pass(a, m, inverse);
       m *= 2;
     }
   }
 
+  // If we're using the other radix, applying the index permutation is a bit
+  // more complicated than in the radix 2 case. It isn't an involution (like it
+  // is in the radix 2 case) so we need to remember which elements we've moved
+  // as we go along and can't use the trick of just swapping when processing
+  // the first element of a 2-cycle.
+  template <typename PolyOrEvals>
+  static void Permute(PolyOrEvals& a, uint32_t two_adicity, uint32_t q_adicity,
+                      uint64_t q) {
+    size_t n = a.NumElements();
+    std::vector<bool> seen(n, false);
+    for (size_t k = 0; k < n; ++k) {
+      size_t i = k;
+      F& a_i = *a[i];
+      while (!seen[i]) {
+        size_t dest = MixedRadixFFTPermute(two_adicity, q_adicity, q, n, i);
+        std::swap(*a[dest], a_i);
+        seen[i] = true;
+        i = dest;
+      }
+    }
+  }
+
+  // Calls |callback| with the ranges of butterflies of a pass that has
+  // |num_butterflies| butterflies, splitting them evenly among the threads.
+  template <typename Callback>
+  static void ForEachButterflyChunk(size_t num_butterflies, Callback callback) {
 #if defined(TACHYON_HAS_OPENMP)
+    size_t thread_nums = static_cast<size_t>(omp_get_max_threads());
+#else
+    size_t thread_nums = 1;
+#endif
+    size_t chunk_size =
+        std::max((num_butterflies + thread_nums - 1) / thread_nums,
+                 kMinNumButterfliesPerThread);
+    OPENMP_PARALLEL_FOR(size_t start = 0; start < num_butterflies;
+                        start += chunk_size) {
+      callback(start, std::min(start + chunk_size, num_butterflies));
+    }
+  }
+
+  // Merges every 3 consecutive sub-FFTs of size |m| into a FFT of size 3 * |m|.
+  // Let ω₃ be a primitive cube root of unity. Since 1 + ω₃ + ω₃² = 0, the
+  // radix-3 butterfly takes only a single multiplication by ω₃:
+  //
+  // y₀ = a₀ + a₁ + a₂
+  // y₁ = a₀ + ω₃ * a₁ + ω₃² * a₂ = a₀ - a₂ + ω₃ * (a₁ - a₂)
+  // y₂ = a₀ + ω₃² * a₁ + ω₃ * a₂ = a₀ - a₁ - ω₃ * (a₁ - a₂)
+  //
+  // where a₁ and a₂ are already multiplied by the twiddles.
   template <typename PolyOrEvals>
-  static void ParallelFFT(PolyOrEvals& a, const F& omega, uint32_t two_adicity,
-                          uint32_t log_num_threads) {
-    CHECK_GE(two_adicity, log_num_threads);
-    // For documentation purposes, comments explain things
-    // as though |a| is a polynomial that we are trying to evaluate.
-
-    // Partition |a| equally into the number of threads.
-    // each partition is then of size m / num_threads.
-    size_t m = a.NumElements();
-    size_t num_threads = size_t{1} << (log_num_threads);
-    size_t num_cosets = num_threads;
-    CHECK_EQ(m % num_threads, size_t{0});
-    size_t coset_size = m / num_threads;
-
-    // We compute the FFT non-mutatively first in |tmp| first,
-    // and then shuffle it back into |a|.
-    // The evaluations are going to be arranged in cosets, each of size |a| /
-    // |num_threads|. so the first coset is (1, g^{|num_cosets|}, g^{2 *
-    // |num_cosets|}, etc.) the second coset is (g, g^{1 + |num_cosets|}, g^{1 +
-    // 2 * |num_cosets|}, etc.) These are cosets with generator
-    // g^{|num_cosets|}, and varying shifts.
-    std::vector<PolyOrEvals> tmp =
-        base::CreateVector(num_cosets, PolyOrEvals::UnsafeZero(coset_size - 1));
-    F new_omega = omega.Pow(num_cosets);
-    uint32_t new_two_adicity =
-        ComputeAdicity(2, gmp::FromUnsignedInt(coset_size));
-
-    // For each coset, we first build a polynomial of degree |coset size|,
-    // whose evaluations over coset k will agree with the evaluations of a over
-    // the coset. Denote the kth such polynomial as poly_k
-#pragma omp parallel for
-    for (size_t k = 0; k < tmp.size(); ++k) {
-      PolyOrEvals& kth_poly_coeffs = tmp[k];
-      // Shuffle into a sub-FFT
-      F omega_k = omega.Pow(k);
-      F omega_step = omega.Pow(k * coset_size);
-
-      F elt = F::One();
-      // Construct |kth_poly_coeffs|, which is a polynomial whose evaluations on
-      // this coset should equal the evaluations of |a| on this coset.
-      // clang-format off
-        // |kth_poly_coeffs[i] = Σ{c in num_cosets} g^{k * (i + c * |coset|)} * a[i + c * |coset|]|
-      // clang-format on
-      // Where c represents the index of the coset being considered. multiplying
-      // by g^{k * i} corresponds to the shift for just being in a different
-      // coset.
-      //
-      // TODO(chokobole): Come back and improve the speed, and make this a more
-      // 'normal'
-      // See
-      // https://github.com/arkworks-rs/algebra/blob/993a4e7ca4ac495c733397dcb7a881b53ab1b18d/poly/src/domain/utils.rs#L151
-      // Cooley-Tukey. This appears to be an FFT of the polynomial
-      // |P(x) = Σ{c in num_cosets} a[i + c |coset|] * x^c|
-      // onto this coset.
-      // However this is being evaluated in time O(N) instead of time
-      // O(|coset|log(|coset|)). If this understanding is the case, its not
-      // doing standard Cooley-Tukey. At the moment, this has time complexity
-      // of at least 2 * N field mul's per thread, so we will be getting
-      // pretty bad parallelism. Exact complexity per thread atm is
-      // |2 * N + (N / num threads)log(N / num threads)| field muls.
-      // Compare to the time complexity of serial is Nlog(N) field muls), with
-      // log(N) in [15, 25]
-      for (size_t i = 0; i < coset_size; ++i) {
-        for (size_t c = 0; c < num_threads; ++c) {
-          size_t idx = i + (c * coset_size);
-          // t = the value of a corresponding to the ith element of
-          // the sth coset.
-          F t = *a[idx];
-          // elt = g^{k * idx}
-          t *= elt;
-          *kth_poly_coeffs[i] += t;
-          elt *= omega_step;
+  void Radix3Pass(PolyOrEvals& a, size_t m, bool inverse) const {
+    size_t n = a.NumElements();
+    size_t twiddle_step = n / (3 * m);
+    const F& w3 = GetTwiddle(n / 3, inverse);
+    ForEachButterflyChunk(n / 3, [this, &a, m, inverse, twiddle_step, &w3](
+                                     size_t start, size_t end) {
+      for (size_t t = start; t < end; ++t) {
+        size_t j = t % m;
+        size_t k = (t - j) * 3;
+        F& a0 = *a[k + j];
+        F& a1 = *a[k + j + m];
+        F& a2 = *a[k + j + 2 * m];
+        if (j != 0) {
+          a1 *= GetTwiddle(j * twiddle_step, inverse);
+          a2 *= GetTwiddle(2 * j * twiddle_step, inverse);
         }
-        elt *= omega_k;
+        F w3_diff = a1 - a2;
+        w3_diff *= w3;
+        F y1 = a0 - a2;
+        y1 += w3_diff;
+        F y2 = a0 - a1;
+        y2 -= w3_diff;
+        a0 += a1;
+        a0 += a2;
+        a1 = std::move(y1);
+        a2 = std::move(y2);
       }
+    });
+  }
 
-      // Perform sub-FFT
-      // Since the sub-FFT is mutative, after this point
-      // |kth_poly_coeffs| should be renamed |kth_coset_evals|.
-      SerialFFT(kth_poly_coeffs, new_omega, new_two_adicity);
-    }
+  // Merges every |q| consecutive sub-FFTs of size |m| into a FFT of size
+  // |q| * |m|.
+  template <typename PolyOrEvals>
+  void RadixQPass(PolyOrEvals& a, size_t q, size_t m, bool inverse) const {
+    size_t n = a.NumElements();
+    size_t twiddle_step = n / (q * m);
+    size_t qth_root_step = n / q;
+    ForEachButterflyChunk(n / q, [this, &a, q, m, inverse, twiddle_step,
+                                  qth_root_step](size_t start, size_t end) {
+      std::vector<F> terms(q);
+      for (size_t t = start; t < end; ++t) {
+        size_t j = t % m;
+        size_t k = (t - j) * q;
+        terms[0] = *a[k + j];
+        for (size_t l = 1; l < q; ++l) {
+          terms[l] = *a[k + j + l * m];
+          terms[l] *= GetTwiddle(l * j * twiddle_step, inverse);
+        }
+        for (size_t i = 0; i < q; ++i) {
+          F& y = *a[k + j + i * m];
+          y = terms[0];
+          for (size_t l = 1; l < q; ++l) {
+            y += terms[l] * GetTwiddle(((i * l) % q) * qth_root_step, inverse);
+          }
+        }
+      }
+    });
+  }
 
-    // shuffle the values computed above into a
-    // The evaluations of a should be ordered as (1, g, g², ...)
-    for (size_t i = 0; i < a.NumElements(); ++i) {
-      *a[i] = *tmp[i % num_cosets][i / num_cosets];
-    }
+  // Merges every 2 consecutive sub-FFTs of size |m| into a FFT of size 2 * |m|.
+  template <typename PolyOrEvals>
+  void Radix2Pass(PolyOrEvals& a, size_t m, bool inverse) const {
+    size_t n = a.NumElements();
+    size_t twiddle_step = n / (2 * m);
+    ForEachButterflyChunk(n / 2, [this, &a, m, inverse, twiddle_step](
+                                     size_t start, size_t end) {
+      for (size_t t = start; t < end; ++t) {
+        size_t j = t % m;
+        size_t k = (t - j) * 2;
+        UnivariateEvaluationDomain<F, MaxDegree>::ButterflyFnOutIn(
+            *a[k + j], *a[k + j + m],
+            GetTwiddle(j * twiddle_step, inverse));
+      }
+    });
   }
-#endif
+
+  // |twiddles_[i]| = ωⁱ, where ω is |this->group_gen_|. This is shared among
+  // the cosets cloned from this domain.
+  std::shared_ptr<const std::vector<F>> twiddles_;
 };
 
 }  // namespace tachyon::math
@@ -0,0 +1,58 @@
+#include <memory>
+
+#include "benchmark/benchmark.h"
+
+#include "tachyon/math/elliptic_curves/bn/bn384_small_two_adicity/fq.h"
+#include "tachyon/math/polynomials/univariate/mixed_radix_evaluation_domain.h"
+
+namespace tachyon::math {
+
+namespace {
+
+using F = bn384_small_two_adicity::Fq;
+using Domain = MixedRadixEvaluationDomain<F>;
+using BaseDomain = UnivariateEvaluationDomain<F, Domain::kMaxDegree>;
+using DensePoly = Domain::DensePoly;
+using Evals = Domain::Evals;
+
+// Runs the benchmark at the sizes 2ᵃ * 3ᵇ.
+void MixedRadixSizes(benchmark::internal::Benchmark* b) {
+  for (int two_adicity : {8, 10, 12}) {
+    for (int q_adicity : {0, 1, 2}) {
+      int size = 1 << two_adicity;
+      for (int i = 0; i < q_adicity; ++i) {
+        size *= 3;
+      }
+      b->Arg(size);
+    }
+  }
+}
+
+}  // namespace
+
+void BM_MixedRadixFFT(benchmark::State& state) {
+  F::Init();
+  std::unique_ptr<BaseDomain> domain = Domain::Create(state.range(0));
+  CHECK_EQ(domain->size(), static_cast<size_t>(state.range(0)));
+  DensePoly poly = DensePoly::Random(domain->size() - 1);
+  for (auto _ : state) {
+    Evals evals = domain->FFT(poly);
+    benchmark::DoNotOptimize(evals);
+  }
+}
+
+void BM_MixedRadixIFFT(benchmark::State& state) {
+  F::Init();
+  std::unique_ptr<BaseDomain> domain = Domain::Create(state.range(0));
+  CHECK_EQ(domain->size(), static_cast<size_t>(state.range(0)));
+  Evals evals = Evals::Random(domain->size() - 1);
+  for (auto _ : state) {
+    DensePoly poly = domain->IFFT(evals);
+    benchmark::DoNotOptimize(poly);
+  }
+}
+
+BENCHMARK(BM_MixedRadixFFT)->Apply(MixedRadixSizes);
+BENCHMARK(BM_MixedRadixIFFT)->Apply(MixedRadixSizes);
+
+}  // namespace tachyon::math
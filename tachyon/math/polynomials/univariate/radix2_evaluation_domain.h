@@ -15,6 +15,7 @@
 #include <stdint.h>
 
 #include <algorithm>
+#include <atomic>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -23,9 +24,11 @@
 #include "absl/types/span.h"
 #include "gtest/gtest_prod.h"
 
+#include "tachyon/base/bits.h"
 #include "tachyon/base/containers/adapters.h"
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
 #include "tachyon/base/parallelize.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluation_domain.h"
 #include "tachyon/math/polynomials/univariate/univariate_polynomial.h"
@@ -53,6 +56,9 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
   constexpr static size_t kMinGapSizeForParallelization = 1 << 10;
   // The minimum number of chunks at which root compaction is beneficial.
   constexpr static size_t kDefaultMinNumChunksForCompaction = 1 << 7;
+  // The number of points processed together by |IFFTPoints()| once a
+  // butterfly cluster fits in it.
+  constexpr static size_t kPointFFTBlockSize = 1 << 10;
 
   enum class FFTOrder {
     // The input of the FFT must be in-order, but the output does not have to
@@ -84,6 +90,97 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
     return min_num_chunks_for_compaction_;
   }
 
+  // Computes the IFFT over |points|, which are elements of a group of order
+  // |F::Config::kModulus| in the affine form, and populates |out| with
+  //
+  //   Qᵢ = n⁻¹ * h⁻ⁱ * Σⱼ ω⁻ⁱʲ * Pⱼ
+  //
+  // where ω is |group_gen()| and h is |offset()|. For example, if Pⱼ = 𝜏ʲG,
+  // then Qᵢ = Lᵢ(𝜏)G, where Lᵢ is the i-th lagrange basis of the domain.
+  //
+  // The butterflies multiply a point by a root, so this is much slower than
+  // the IFFT over |F|. The first layer adds the affine inputs with mixed
+  // additions. Once a butterfly cluster fits in |kPointFFTBlockSize| points,
+  // the remaining layers run on each block at once, so the points of a block
+  // stay in the cache.
+  template <typename AffinePoint>
+  [[nodiscard]] bool IFFTPoints(absl::Span<const AffinePoint> points,
+                                absl::Span<AffinePoint> out) const {
+    using Point = decltype(std::declval<AffinePoint>().ToJacobian());
+
+    size_t n = this->size_;
+    if (points.size() != n || out.size() != n) {
+      LOG(ERROR) << "The number of the points doesn't match the domain";
+      return false;
+    }
+    if (n == 1) {
+      out[0] = points[0];
+      return true;
+    }
+
+    // |roots[k]| = ω⁻ᵏ
+    std::vector<F> roots = this->GetRootsOfUnity(n / 2, this->group_gen_inv_);
+    std::vector<Point> values(n);
+    size_t gap = n / 2;
+    OPENMP_PARALLEL_FOR(size_t j = 0; j < gap; ++j) {
+      Point sum = points[j].ToJacobian();
+      Point diff = sum;
+      sum += points[j + gap];
+      diff += -points[j + gap];
+      values[j] = std::move(sum);
+      values[j + gap] = j == 0 ? std::move(diff) : diff * roots[j];
+    }
+    gap /= 2;
+
+    // The layers whose butterfly cluster doesn't fit in a block.
+    for (; 2 * gap > kPointFFTBlockSize; gap /= 2) {
+      size_t step = n / (2 * gap);
+      OPENMP_PARALLEL_FOR(size_t t = 0; t < n / 2; ++t) {
+        size_t j = t % gap;
+        size_t i = (t / gap) * 2 * gap + j;
+        PointButterfly(values[i], values[i + gap], j, roots[j * step]);
+      }
+    }
+
+    if (gap > 0) {
+      size_t block_size = 2 * gap;
+      OPENMP_PARALLEL_FOR(size_t b = 0; b < n; b += block_size) {
+        for (size_t g = gap; g > 0; g /= 2) {
+          size_t step = n / (2 * g);
+          for (size_t c = b; c < b + block_size; c += 2 * g) {
+            for (size_t j = 0; j < g; ++j) {
+              PointButterfly(values[c + j], values[c + j + g], j,
+                             roots[j * step]);
+            }
+          }
+        }
+      }
+    }
+
+    // The outputs are in the bit-reversed order. |scalars[i]| = n⁻¹ * h⁻ⁱ.
+    std::vector<F> scalars =
+        this->offset_.IsOne()
+            ? std::vector<F>(n, this->size_inv_)
+            : F::GetSuccessivePowers(n, this->offset_inv_, this->size_inv_);
+    uint32_t log_n = this->log_size_of_group_;
+    std::vector<Point> results(n);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < n; ++i) {
+      size_t ridx = base::bits::BitRev(i) >> (sizeof(size_t) * 8 - log_n);
+      results[i] = values[ridx] * scalars[i];
+    }
+
+    std::atomic<bool> normalized = true;
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < n; i += kPointFFTBlockSize) {
+      size_t size = std::min(kPointFFTBlockSize, n - i);
+      absl::Span<AffinePoint> chunk = out.subspan(i, size);
+      if (!Point::BatchNormalize(absl::MakeConstSpan(results).subspan(i, size),
+                                 &chunk)) {
+        normalized.store(false, std::memory_order_relaxed);
+      }
+    }
+    return normalized.load();
+  }
+
  private:
   template <typename T>
   FRIEND_TEST(UnivariateEvaluationDomainTest, RootsOfUnity);
@@ -99,15 +196,22 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
   [[nodiscard]] constexpr Evals FFT(const DensePoly& poly) const override {
     if (poly.IsZero()) return {};
 
+    // NOTE: The capacity is reserved up front, so that resizing the
+    // evaluations to |this->size_| in |FFTInPlace()| doesn't reallocate.
     Evals evals;
-    evals.evaluations_ = poly.coefficients_.coefficients_;
-    if (evals.evaluations_.size() * kDegreeAwareFFTThresholdFactor <=
-        this->size_) {
-      DegreeAwareFFTInPlace(evals);
-    } else {
-      evals.evaluations_.resize(this->size_, F::Zero());
-      InOrderFFTInPlace(evals);
-    }
+    evals.evaluations_.reserve(this->size_);
+    evals.evaluations_.assign(poly.coefficients_.coefficients_.begin(),
+                              poly.coefficients_.coefficients_.end());
+    FFTInPlace(evals);
+    return evals;
+  }
+
+  [[nodiscard]] constexpr Evals FFT(DensePoly&& poly) const override {
+    if (poly.IsZero()) return {};
+
+    Evals evals;
+    evals.evaluations_ = std::move(poly.coefficients_.coefficients_);
+    FFTInPlace(evals);
     return evals;
   }
 
@@ -117,11 +221,36 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
     if (evals.IsZero()) return {};
 
     DensePoly poly;
-    poly.coefficients_.coefficients_ = evals.evaluations_;
+    poly.coefficients_.coefficients_.reserve(this->size_);
+    poly.coefficients_.coefficients_.assign(evals.evaluations_.begin(),
+                                            evals.evaluations_.end());
+    IFFTInPlace(poly);
+    return poly;
+  }
+
+  [[nodiscard]] constexpr DensePoly IFFT(Evals&& evals) const override {
+    if (evals.IsZero()) return {};
+
+    DensePoly poly;
+    poly.coefficients_.coefficients_ = std::move(evals.evaluations_);
+    IFFTInPlace(poly);
+    return poly;
+  }
+
+  constexpr void FFTInPlace(Evals& evals) const {
+    if (evals.evaluations_.size() * kDegreeAwareFFTThresholdFactor <=
+        this->size_) {
+      DegreeAwareFFTInPlace(evals);
+    } else {
+      evals.evaluations_.resize(this->size_, F::Zero());
+      InOrderFFTInPlace(evals);
+    }
+  }
+
+  constexpr void IFFTInPlace(DensePoly& poly) const {
     poly.coefficients_.coefficients_.resize(this->size_, F::Zero());
     InOrderIFFTInPlace(poly);
     poly.coefficients_.RemoveHighDegreeZeros();
-    return poly;
   }
 
   // Degree aware FFT that runs in O(n log d) instead of O(n log n).
@@ -188,6 +317,15 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
     OutInHelper(evals, this->group_gen_, 1);
   }
 
+  // Computes (a, b) <- (a + b, (a - b) * root), where the |j|-th root of a
+  // cluster is always one.
+  template <typename Point>
+  static void PointButterfly(Point& a, Point& b, size_t j, const F& root) {
+    Point diff = a - b;
+    a += b;
+    b = j == 0 ? std::move(diff) : diff * root;
+  }
+
   // Handles doing an IFFT with handling of being in order and out of order.
   // The results here must all be divided by |poly|, which is left up to the
   // caller to do.
@@ -254,11 +392,15 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
       bool should_compact = num_chunks >= min_num_chunks_for_compaction_;
       if (should_compact) {
         if (!first) {
+          // NOTE: The compaction can't be done in place in
+          // parallel, since |roots[i * (step * 2)]| may be overwritten by
+          // another thread before being read.
           size_t size = roots.size() / (step * 2);
+          std::vector<F> compacted_roots(size);
           OPENMP_PARALLEL_FOR(size_t i = 0; i < size; ++i) {
-            roots[i] = roots[i * (step * 2)];
+            compacted_roots[i] = roots[i * (step * 2)];
           }
-          roots.erase(roots.begin() + size, roots.end());
+          roots = std::move(compacted_roots);
         }
         step = 1;
       } else {
@@ -0,0 +1,121 @@
+#ifndef TACHYON_MATH_POLYNOMIALS_UNIVARIATE_UNIVARIATE_BATCH_EVALUATION_H_
+#define TACHYON_MATH_POLYNOMIALS_UNIVARIATE_UNIVARIATE_BATCH_EVALUATION_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/types/span.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/math/polynomials/univariate/univariate_polynomial.h"
+
+namespace tachyon::math {
+
+// The number of coefficients whose point powers are kept in a buffer at once
+// by |BatchEvaluate()|.
+constexpr size_t kBatchEvaluationBlockSize = 1 << 10;
+
+// Evaluates |polys[i]| at |points[i]| for every i and returns the results.
+//
+// Unlike calling |Evaluate()| on each polynomial, the powers of each distinct
+// point are computed only once and shared by all the polynomials evaluated at
+// that point. Each evaluation is then computed as a dot product between the
+// coefficients and the powers. The coefficients are split into chunks which
+// are processed in parallel, and each chunk is again processed block by block
+// so that the powers of the points stay in the cache:
+//
+//   pᵢ(xᵢ) = Σⱼ cᵢ,ⱼ * xᵢʲ
+template <typename F, size_t MaxDegree>
+std::vector<F> BatchEvaluate(
+    absl::Span<const UnivariateDensePolynomial<F, MaxDegree>* const> polys,
+    absl::Span<const F> points) {
+  CHECK_EQ(polys.size(), points.size());
+  size_t num_evals = polys.size();
+  if (num_evals == 0) return {};
+
+  // |point_indices[i]| is the index of |points[i]| in |distinct_points|.
+  std::vector<F> distinct_points;
+  std::vector<size_t> point_indices;
+  point_indices.reserve(num_evals);
+  absl::flat_hash_map<F, size_t> point_to_index;
+  for (const F& point : points) {
+    auto [it, inserted] =
+        point_to_index.try_emplace(point, distinct_points.size());
+    if (inserted) distinct_points.push_back(point);
+    point_indices.push_back(it->second);
+  }
+
+  size_t max_size = 0;
+  for (const UnivariateDensePolynomial<F, MaxDegree>* poly : polys) {
+    max_size = std::max(max_size, poly->coefficients().coefficients().size());
+  }
+  if (max_size == 0) return base::CreateVector(num_evals, F::Zero());
+
+#if defined(TACHYON_HAS_OPENMP)
+  size_t thread_nums = static_cast<size_t>(omp_get_max_threads());
+#else
+  size_t thread_nums = 1;
+#endif
+  size_t chunk_size = std::max((max_size + thread_nums - 1) / thread_nums,
+                               kBatchEvaluationBlockSize);
+  size_t num_chunks = (max_size + chunk_size - 1) / chunk_size;
+
+  std::vector<std::vector<F>> partial_evals(num_chunks);
+  OPENMP_PARALLEL_FOR(size_t c = 0; c < num_chunks; ++c) {
+    size_t chunk_start = c * chunk_size;
+    size_t chunk_end = std::min(chunk_start + chunk_size, max_size);
+    std::vector<F>& evals = partial_evals[c];
+    evals = base::CreateVector(num_evals, F::Zero());
+
+    // |powers[k][j]| = |distinct_points[k]|^(|block_start| + j)
+    std::vector<std::vector<F>> powers = base::CreateVector(
+        distinct_points.size(),
+        base::CreateVector(kBatchEvaluationBlockSize, F::Zero()));
+    std::vector<F> next_powers = base::Map(
+        distinct_points,
+        [chunk_start](const F& point) { return point.Pow(chunk_start); });
+
+    for (size_t block_start = chunk_start; block_start < chunk_end;
+         block_start += kBatchEvaluationBlockSize) {
+      size_t block_size =
+          std::min(kBatchEvaluationBlockSize, chunk_end - block_start);
+      for (size_t k = 0; k < distinct_points.size(); ++k) {
+        for (size_t j = 0; j < block_size; ++j) {
+          powers[k][j] = next_powers[k];
+          next_powers[k] *= distinct_points[k];
+        }
+      }
+
+      for (size_t i = 0; i < num_evals; ++i) {
+        const std::vector<F>& coefficients =
+            polys[i]->coefficients().coefficients();
+        if (coefficients.size() <= block_start) continue;
+        size_t size = std::min(block_size, coefficients.size() - block_start);
+        const std::vector<F>& point_powers = powers[point_indices[i]];
+        F sum = F::Zero();
+        for (size_t j = 0; j < size; ++j) {
+          sum += coefficients[block_start + j] * point_powers[j];
+        }
+        evals[i] += sum;
+      }
+    }
+  }
+
+  std::vector<F> ret = std::move(partial_evals[0]);
+  for (size_t c = 1; c < num_chunks; ++c) {
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < num_evals; ++i) {
+      ret[i] += partial_evals[c][i];
+    }
+  }
+  return ret;
+}
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_POLYNOMIALS_UNIVARIATE_UNIVARIATE_BATCH_EVALUATION_H_
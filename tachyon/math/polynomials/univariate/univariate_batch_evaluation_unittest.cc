@@ -0,0 +1,60 @@
+#include "tachyon/math/polynomials/univariate/univariate_batch_evaluation.h"
+
+#include "gtest/gtest.h"
+
+#include "tachyon/math/elliptic_curves/bls12/bls12_381/fr.h"
+
+namespace tachyon::math {
+
+namespace {
+
+const size_t kMaxDegree = (size_t{1} << 12) - 1;
+
+using F = bls12_381::Fr;
+using Poly = UnivariateDensePolynomial<F, kMaxDegree>;
+
+class UnivariateBatchEvaluationTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { F::Init(); }
+};
+
+}  // namespace
+
+TEST_F(UnivariateBatchEvaluationTest, BatchEvaluate) {
+  std::vector<Poly> polys = {
+      Poly::Random(kMaxDegree), Poly::Random(kMaxDegree / 3),
+      Poly::Random(1),          Poly::Zero(),
+      Poly::Random(kMaxDegree / 2),
+  };
+  std::vector<F> distinct_points = {F::Random(), F::Random(), F::Zero()};
+
+  std::vector<const Poly*> poly_ptrs;
+  std::vector<F> points;
+  for (const Poly& poly : polys) {
+    for (const F& point : distinct_points) {
+      poly_ptrs.push_back(&poly);
+      points.push_back(point);
+    }
+  }
+
+  std::vector<F> evals = BatchEvaluate(absl::MakeConstSpan(poly_ptrs),
+                                       absl::MakeConstSpan(points));
+  ASSERT_EQ(evals.size(), points.size());
+  for (size_t i = 0; i < evals.size(); ++i) {
+    EXPECT_EQ(evals[i], poly_ptrs[i]->Evaluate(points[i]));
+  }
+}
+
+TEST_F(UnivariateBatchEvaluationTest, BatchEvaluateZeros) {
+  Poly zero = Poly::Zero();
+  std::vector<const Poly*> poly_ptrs = {&zero, &zero};
+  std::vector<F> points = {F::Random(), F::Random()};
+  std::vector<F> evals = BatchEvaluate(absl::MakeConstSpan(poly_ptrs),
+                                       absl::MakeConstSpan(points));
+  EXPECT_EQ(evals, std::vector<F>({F::Zero(), F::Zero()}));
+  EXPECT_TRUE(BatchEvaluate(absl::Span<const Poly* const>(),
+                            absl::Span<const F>())
+                  .empty());
+}
+
+}  // namespace tachyon::math
@@ -2,6 +2,7 @@
 #include "gtest/gtest.h"
 
 #include "tachyon/base/buffer/buffer.h"
+#include "tachyon/base/containers/container_util.h"
 #include "tachyon/math/finite_fields/test/gf7.h"
 #include "tachyon/math/polynomials/univariate/univariate_polynomial.h"
 
@@ -312,6 +313,79 @@ TEST_F(UnivariateDensePolynomialTest, DivScalar) {
   EXPECT_EQ(poly, expected);
 }
 
+TEST_F(UnivariateDensePolynomialTest, DivByLinear) {
+  // poly = 2x⁴ + x² + 3
+  const Poly& poly = polys_[0];
+  for (const GF7& a : {GF7(1), GF7(3)}) {
+    for (const GF7& b : {GF7(0), GF7(2), GF7(5)}) {
+      Poly linear(Coeffs({b, a}));
+      DivResult<Poly> result = poly.DivMod(linear);
+      EXPECT_EQ(result.quotient.Degree(), poly.Degree() - 1);
+      EXPECT_LE(result.remainder.Degree(), 0);
+      EXPECT_EQ(result.quotient * linear + result.remainder, poly);
+      EXPECT_EQ(poly / linear, result.quotient);
+      EXPECT_EQ(poly % linear, result.remainder);
+      EXPECT_EQ(poly / linear.ToSparse(), result.quotient);
+      EXPECT_EQ(poly % linear.ToSparse(), result.remainder);
+    }
+  }
+}
+
+TEST_F(UnivariateDensePolynomialTest, DivBySparse) {
+  // poly = 2x⁴ + x² + 3
+  const Poly& poly = polys_[0];
+  // divisor = 3x³ + 4x + 1
+  Poly divisor(Coeffs({GF7(1), GF7(4), GF7(0), GF7(3)}));
+  DivResult<Poly> result = poly.DivMod(divisor);
+  EXPECT_EQ(result.quotient * divisor + result.remainder, poly);
+  EXPECT_LT(result.remainder.Degree(), divisor.Degree());
+  EXPECT_EQ(poly / divisor.ToSparse(), result.quotient);
+  EXPECT_EQ(poly % divisor.ToSparse(), result.remainder);
+}
+
+TEST_F(UnivariateDensePolynomialTest, DivByVanishingPolyInPlace) {
+  // poly = x⁴ + 2x² + 4 = (x - 1)(x - 2)(x + 1)(x + 2)
+  Poly poly = Poly(Coeffs({GF7(4), GF7::Zero(), GF7(2), GF7::Zero(), GF7(1)}));
+  std::vector<GF7> roots = {GF7(1), GF7(2), GF7(6)};
+  Poly expected = Poly(Coeffs({GF7(2), GF7(1)}));
+  Poly actual = poly;
+  actual.DivByVanishingPolyInPlace(roots);
+  EXPECT_EQ(actual, expected);
+
+  // The remainder is discarded.
+  Poly poly2 = poly + Poly(Coeffs({GF7(3), GF7(1)}));
+  expected = poly2.DivMod(Poly::FromRoots(roots)).quotient;
+  EXPECT_EQ(poly2.DivByVanishingPolyInPlace(roots), expected);
+
+  actual = poly;
+  roots.push_back(GF7(5));
+  actual.DivByVanishingPolyInPlace(roots);
+  EXPECT_TRUE(actual.IsOne());
+
+  roots.push_back(GF7(3));
+  actual.DivByVanishingPolyInPlace(roots);
+  EXPECT_TRUE(actual.IsZero());
+}
+
+TEST_F(UnivariateDensePolynomialTest, WeightedSum) {
+  std::vector<const Poly*> polys =
+      base::Map(polys_, [](const Poly& poly) { return &poly; });
+  std::vector<GF7> scalars =
+      base::CreateVector(polys.size(), []() { return GF7::Random(); });
+  Poly expected = Poly::Zero();
+  for (size_t i = 0; i < polys.size(); ++i) {
+    expected += *polys[i] * scalars[i];
+  }
+  EXPECT_EQ(Poly::WeightedSum(polys, scalars), expected);
+
+  // The leading terms which are cancelled out are removed.
+  polys = {&polys_[0], &polys_[0]};
+  scalars = {GF7(3), GF7(4)};
+  EXPECT_TRUE(Poly::WeightedSum(polys, scalars).IsZero());
+
+  EXPECT_TRUE(Poly::WeightedSum({}, {}).IsZero());
+}
+
 TEST_F(UnivariateDensePolynomialTest, FromRoots) {
   // poly = x⁴ + 2x² + 4 = (x - 1)(x - 2)(x + 1)(x + 2)
   Poly poly = Poly(Coeffs({GF7(4), GF7::Zero(), GF7(2), GF7::Zero(), GF7(1)}));
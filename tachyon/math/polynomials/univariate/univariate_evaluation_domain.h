@@ -113,9 +113,39 @@ class UnivariateEvaluationDomain : public EvaluationDomain<F, MaxDegree> {
   // Compute a FFT.
   [[nodiscard]] constexpr virtual Evals FFT(const DensePoly& poly) const = 0;
 
+  // Compute a FFT. Unlike the one above, this reuses the memory of |poly| for
+  // the evaluations instead of copying the coefficients.
+  [[nodiscard]] constexpr virtual Evals FFT(DensePoly&& poly) const = 0;
+
+  // Compute a FFT into |evals|. The memory already held by |evals| is reused,
+  // so that transforming many polynomials one after another with the same
+  // |evals| doesn't allocate every time.
+  constexpr void FFT(const DensePoly& poly, Evals* evals) const {
+    std::vector<F>& buffer = evals->evaluations();
+    const std::vector<F>& coefficients = poly.coefficients().coefficients();
+    buffer.reserve(size_);
+    buffer.assign(coefficients.begin(), coefficients.end());
+    *evals = FFT(DensePoly(DenseCoeffs(std::move(buffer))));
+  }
+
   // Compute an IFFT.
   [[nodiscard]] constexpr virtual DensePoly IFFT(const Evals& evals) const = 0;
 
+  // Compute an IFFT. Unlike the one above, this reuses the memory of |evals|
+  // for the coefficients instead of copying the evaluations.
+  [[nodiscard]] constexpr virtual DensePoly IFFT(Evals&& evals) const = 0;
+
+  // Compute an IFFT into |poly|. The memory already held by |poly| is reused,
+  // so that transforming many evaluations one after another with the same
+  // |poly| doesn't allocate every time.
+  constexpr void IFFT(const Evals& evals, DensePoly* poly) const {
+    std::vector<F>& buffer = poly->coefficients().coefficients();
+    const std::vector<F>& evaluations = evals.evaluations();
+    buffer.reserve(size_);
+    buffer.assign(evaluations.begin(), evaluations.end());
+    *poly = IFFT(Evals(std::move(buffer)));
+  }
+
   // Computes the first |size| roots of unity for the entire domain.
   // e.g. for the domain [1, g, g², ..., gⁿ⁻¹}] and |size| = n / 2, it computes
   // [1, g, g², ..., g^{(n / 2) - 1}]
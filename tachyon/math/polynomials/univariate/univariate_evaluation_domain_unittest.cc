@@ -273,6 +273,70 @@ TYPED_TEST(UnivariateEvaluationDomainTest, FFTCorrectness) {
   }
 }
 
+// Tests that the mixed radix FFT outputs the correct result on the domains
+// whose sizes are not a power of 2.
+TYPED_TEST(UnivariateEvaluationDomainTest, MixedRadixFFTCorrectness) {
+  using Domain = TypeParam;
+  using F = typename Domain::Field;
+  using BaseDomain = UnivariateEvaluationDomain<F, Domain::kMaxDegree>;
+  using DensePoly = typename Domain::DensePoly;
+  using Evals = typename Domain::Evals;
+
+  if constexpr (std::is_same_v<F, bn384_small_two_adicity::Fq>) {
+    for (size_t domain_size :
+         {size_t{3}, size_t{6}, size_t{9}, size_t{36}, size_t{2304}}) {
+      DensePoly rand_poly = DensePoly::Random(domain_size - 1);
+      this->TestDomains(
+          domain_size, [domain_size, &rand_poly](const BaseDomain& d) {
+            ASSERT_EQ(d.size(), domain_size);
+            Evals poly_evals = d.FFT(rand_poly);
+            for (size_t i = 0; i < domain_size; ++i) {
+              EXPECT_EQ(*poly_evals[i], rand_poly.Evaluate(d.GetElement(i)));
+            }
+            EXPECT_EQ(rand_poly, d.IFFT(poly_evals));
+          });
+    }
+  } else {
+    GTEST_SKIP() << "Skip testing MixedRadixFFTCorrectness on "
+                    "Radix2EvaluationDomain";
+  }
+}
+
+// Tests that the FFTs reusing the given memory output the same result as the
+// ones copying it.
+TYPED_TEST(UnivariateEvaluationDomainTest, InPlaceFFTCorrectness) {
+  using Domain = TypeParam;
+  using F = typename Domain::Field;
+  using BaseDomain = UnivariateEvaluationDomain<F, Domain::kMaxDegree>;
+  using DensePoly = typename Domain::DensePoly;
+  using Evals = typename Domain::Evals;
+
+  const size_t log_degree = 5;
+  const size_t degree = (size_t{1} << log_degree) - 1;
+  DensePoly rand_poly = DensePoly::Random(degree);
+  for (size_t log_domain_size = log_degree; log_domain_size < log_degree + 3;
+       ++log_domain_size) {
+    size_t domain_size = size_t{1} << log_domain_size;
+    this->TestDomains(domain_size, [&rand_poly](const BaseDomain& d) {
+      Evals expected_evals = d.FFT(rand_poly);
+
+      DensePoly poly = rand_poly;
+      EXPECT_EQ(d.FFT(std::move(poly)), expected_evals);
+
+      Evals evals = d.template Random<Evals>();
+      d.FFT(rand_poly, &evals);
+      EXPECT_EQ(evals, expected_evals);
+
+      Evals evals_to_move = expected_evals;
+      EXPECT_EQ(d.IFFT(std::move(evals_to_move)), rand_poly);
+
+      DensePoly out = DensePoly::Random(degree);
+      d.IFFT(expected_evals, &out);
+      EXPECT_EQ(out, rand_poly);
+    });
+  }
+}
+
 // Test that the degree aware FFT (O(n log d)) matches the regular FFT
 // (O(n log n)).
 TYPED_TEST(UnivariateEvaluationDomainTest, DegreeAwareFFTCorrectness) {
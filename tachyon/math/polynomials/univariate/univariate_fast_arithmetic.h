@@ -0,0 +1,188 @@
+#ifndef TACHYON_MATH_POLYNOMIALS_UNIVARIATE_UNIVARIATE_FAST_ARITHMETIC_H_
+#define TACHYON_MATH_POLYNOMIALS_UNIVARIATE_UNIVARIATE_FAST_ARITHMETIC_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/math/base/arithmetics_results.h"
+#include "tachyon/math/polynomials/univariate/radix2_evaluation_domain.h"
+#include "tachyon/math/polynomials/univariate/univariate_polynomial.h"
+
+namespace tachyon::math {
+
+// Polynomial arithmetic that runs in O(n log n) by using FFTs. These work on
+// the raw coefficients, which are ordered from the lowest degree to the
+// highest degree, so that they can be used regardless of the |MaxDegree| of
+// the polynomial.
+template <typename F>
+class UnivariateFastArithmetic {
+ public:
+  constexpr static size_t kMaxDegree =
+      (size_t{1} << F::Config::kTwoAdicity) - 1;
+
+  // The minimum number of coefficients at which FFT based multiplication is
+  // beneficial over the schoolbook multiplication.
+  constexpr static size_t kMinSizeForFFTMul = 1 << 6;
+  // The minimum degree of a divisor at which Newton iteration based division
+  // is beneficial over the long division.
+  constexpr static size_t kMinDegreeForNewtonDivision = 1 << 6;
+
+  using Domain = UnivariateEvaluationDomain<F, kMaxDegree>;
+  using DensePoly = typename Domain::DensePoly;
+  using DenseCoeffs = typename DensePoly::Coefficients;
+  using Evals = typename Domain::Evals;
+
+  // Returns the coefficients of |a| * |b|.
+  static std::vector<F> Mul(const std::vector<F>& a, const std::vector<F>& b) {
+    if (a.empty() || b.empty()) return {};
+    size_t size = a.size() + b.size() - 1;
+    if (std::min(a.size(), b.size()) < kMinSizeForFFTMul) {
+      return SchoolbookMul(a, b);
+    }
+
+    std::unique_ptr<Domain> domain =
+        Radix2EvaluationDomain<F, kMaxDegree>::Create(size);
+    Evals a_evals = domain->FFT(DensePoly(DenseCoeffs(a)));
+    Evals b_evals = domain->FFT(DensePoly(DenseCoeffs(b)));
+    a_evals *= b_evals;
+    std::vector<F> ret =
+        std::move(domain->IFFT(a_evals).coefficients().coefficients());
+    ret.resize(size, F::Zero());
+    return ret;
+  }
+
+  // Returns g such that |f| * g = 1 mod Xᵏ using Newton iteration, where k is
+  // |k|. |f[0]| must not be zero.
+  //
+  // Starting from g₀ = f₀⁻¹, each step doubles the precision as follows:
+  // gᵢ₊₁ = gᵢ * (2 - f * gᵢ) mod X^(2ⁱ⁺¹)
+  static std::vector<F> InverseModXPow(const std::vector<F>& f, size_t k) {
+    CHECK(!f.empty());
+    CHECK(!f[0].IsZero());
+    std::vector<F> g = {f[0].Inverse()};
+    size_t precision = 1;
+    while (precision < k) {
+      precision = std::min(precision * 2, k);
+      std::vector<F> f_truncated(f.begin(),
+                                 f.begin() + std::min(f.size(), precision));
+      // e = 2 - f * gᵢ mod X^(2ⁱ⁺¹)
+      std::vector<F> e = Mul(f_truncated, g);
+      e.resize(precision, F::Zero());
+      OPENMP_PARALLEL_FOR(size_t i = 0; i < e.size(); ++i) {
+        e[i].NegInPlace();
+      }
+      e[0] += F(2);
+      g = Mul(g, e);
+      g.resize(precision, F::Zero());
+    }
+    g.resize(k, F::Zero());
+    return g;
+  }
+
+  // Returns the quotient and the remainder of |a| / |b|.
+  template <size_t MaxDegree>
+  static DivResult<UnivariateDensePolynomial<F, MaxDegree>> DivMod(
+      const UnivariateDensePolynomial<F, MaxDegree>& a,
+      const UnivariateDensePolynomial<F, MaxDegree>& b) {
+    using Poly = UnivariateDensePolynomial<F, MaxDegree>;
+    using Coeffs = UnivariateDenseCoefficients<F, MaxDegree>;
+
+    CHECK(!b.IsZero()) << "Divide by zero polynomial";
+    if (a.IsZero() || a.Degree() < b.Degree()) {
+      return {Poly::Zero(), a};
+    }
+    if (b.Degree() < kMinDegreeForNewtonDivision) {
+      return a.DivMod(b);
+    }
+
+    std::vector<F> q;
+    std::vector<F> r;
+    NewtonDivMod(a.coefficients().coefficients(),
+                 b.coefficients().coefficients(), &q, &r);
+    return {Poly(Coeffs(std::move(q))), Poly(Coeffs(std::move(r)))};
+  }
+
+  // Returns the remainder of |a| / |b|, where both are given as coefficients.
+  // The leading coefficient of |b| must not be zero. Unlike |DivMod()|, the
+  // returned remainder always has deg(|b|) coefficients unless |a| has less
+  // coefficients than |b|, in which case |a| is returned as is.
+  static std::vector<F> Mod(const std::vector<F>& a, const std::vector<F>& b) {
+    CHECK(!b.empty());
+    CHECK(!b.back().IsZero());
+    if (a.size() < b.size()) return a;
+
+    std::vector<F> q;
+    std::vector<F> r;
+    if (b.size() - 1 < kMinDegreeForNewtonDivision) {
+      SchoolbookDivMod(a, b, &q, &r);
+    } else {
+      NewtonDivMod(a, b, &q, &r);
+    }
+    return r;
+  }
+
+ private:
+  // Computes |q| and |r| such that |a| = |q| * |b| + |r|, where |a| has at
+  // least as many coefficients as |b|. Let n be |a.size()| - 1 and m be
+  // |b.size()| - 1. Since deg(r) < m, rev(q) = rev(a) * rev(b)⁻¹ mod Xⁿ⁻ᵐ⁺¹,
+  // where rev(p) = Xᵈᵉᵍ⁽ᵖ⁾ * p(1 / X). Then r is given by a - q * b.
+  static void NewtonDivMod(const std::vector<F>& a, const std::vector<F>& b,
+                           std::vector<F>* q, std::vector<F>* r) {
+    size_t n = a.size() - 1;
+    size_t m = b.size() - 1;
+    size_t k = n - m + 1;
+
+    std::vector<F> rev_a(a.rbegin(), a.rbegin() + k);
+    std::vector<F> rev_b(b.rbegin(), b.rend());
+    std::vector<F> rev_q = Mul(rev_a, InverseModXPow(rev_b, k));
+    rev_q.resize(k, F::Zero());
+    *q = std::vector<F>(rev_q.rbegin(), rev_q.rend());
+
+    // Only the lower m coefficients of a - q * b can be nonzero.
+    std::vector<F> qb = Mul(*q, b);
+    *r = std::vector<F>(a.begin(), a.begin() + m);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < m; ++i) { (*r)[i] -= qb[i]; }
+  }
+
+  static void SchoolbookDivMod(const std::vector<F>& a, const std::vector<F>& b,
+                               std::vector<F>* q, std::vector<F>* r) {
+    size_t m = b.size() - 1;
+    size_t k = a.size() - m;
+    *q = base::CreateVector(k, F::Zero());
+    *r = a;
+    F leading_coeff_inv = b.back().Inverse();
+    for (size_t i = k - 1; i != SIZE_MAX; --i) {
+      F c = (*r)[i + m] * leading_coeff_inv;
+      (*q)[i] = c;
+      if (c.IsZero()) continue;
+      for (size_t j = 0; j < m; ++j) {
+        (*r)[i + j] -= c * b[j];
+      }
+    }
+    r->resize(m);
+  }
+
+  static std::vector<F> SchoolbookMul(const std::vector<F>& a,
+                                      const std::vector<F>& b) {
+    std::vector<F> ret =
+        base::CreateVector(a.size() + b.size() - 1, F::Zero());
+    for (size_t i = 0; i < a.size(); ++i) {
+      if (a[i].IsZero()) continue;
+      for (size_t j = 0; j < b.size(); ++j) {
+        ret[i + j] += a[i] * b[j];
+      }
+    }
+    return ret;
+  }
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_POLYNOMIALS_UNIVARIATE_UNIVARIATE_FAST_ARITHMETIC_H_
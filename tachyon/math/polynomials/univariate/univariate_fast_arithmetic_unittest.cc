@@ -0,0 +1,83 @@
+#include "gtest/gtest.h"
+
+#include "tachyon/math/elliptic_curves/bls12/bls12_381/fr.h"
+#include "tachyon/math/polynomials/univariate/univariate_fast_arithmetic.h"
+
+namespace tachyon::math {
+
+namespace {
+
+const size_t kMaxDegree = (size_t{1} << 13) - 1;
+
+using F = bls12_381::Fr;
+using Poly = UnivariateDensePolynomial<F, kMaxDegree>;
+using Coeffs = UnivariateDenseCoefficients<F, kMaxDegree>;
+
+class UnivariateFastArithmeticTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { F::Init(); }
+};
+
+}  // namespace
+
+TEST_F(UnivariateFastArithmeticTest, Mul) {
+  for (size_t degree : {size_t{3}, size_t{100}, size_t{1000}}) {
+    Poly a = Poly::Random(degree);
+    Poly b = Poly::Random(degree / 2 + 1);
+    std::vector<F> expected = (a * b).coefficients().coefficients();
+    std::vector<F> actual = UnivariateFastArithmetic<F>::Mul(
+        a.coefficients().coefficients(), b.coefficients().coefficients());
+    EXPECT_EQ(actual, expected);
+  }
+}
+
+TEST_F(UnivariateFastArithmeticTest, InverseModXPow) {
+  size_t k = 300;
+  Poly f = Poly::Random(500);
+  std::vector<F> g = UnivariateFastArithmetic<F>::InverseModXPow(
+      f.coefficients().coefficients(), k);
+  ASSERT_EQ(g.size(), k);
+  std::vector<F> fg = (f * Poly(Coeffs(g))).coefficients().coefficients();
+  EXPECT_TRUE(fg[0].IsOne());
+  for (size_t i = 1; i < k; ++i) {
+    EXPECT_TRUE(fg[i].IsZero());
+  }
+}
+
+TEST_F(UnivariateFastArithmeticTest, DivMod) {
+  struct {
+    size_t a_degree;
+    size_t b_degree;
+  } tests[] = {
+      {1000, 10},
+      {1000, 100},
+      {1000, 999},
+      {4000, 2000},
+      {100, 200},
+  };
+
+  for (const auto& test : tests) {
+    Poly a = Poly::Random(test.a_degree);
+    Poly b = Poly::Random(test.b_degree);
+    DivResult<Poly> expected = a.DivMod(b);
+    DivResult<Poly> actual = UnivariateFastArithmetic<F>::DivMod(a, b);
+    EXPECT_EQ(actual.quotient, expected.quotient);
+    EXPECT_EQ(actual.remainder, expected.remainder);
+  }
+}
+
+TEST_F(UnivariateFastArithmeticTest, DivByLargeLinear) {
+  // Large enough to run synthetic division in parallel.
+  Poly a = Poly::Random(kMaxDegree);
+  F root = F::Random();
+  Poly linear(Coeffs({-root, F::One()}));
+  DivResult<Poly> result = a.DivMod(linear);
+  EXPECT_EQ(result.remainder, Poly(Coeffs({a.Evaluate(root)})));
+  EXPECT_EQ(result.quotient * linear + result.remainder, a);
+
+  Poly quotient = a;
+  quotient.DivByVanishingPolyInPlace(std::vector<F>{root});
+  EXPECT_EQ(quotient, result.quotient);
+}
+
+}  // namespace tachyon::math
@@ -14,6 +14,7 @@
 #include <vector>
 
 #include "absl/hash/hash.h"
+#include "absl/types/span.h"
 
 #include "tachyon/base/buffer/copyable.h"
 #include "tachyon/base/json/json.h"
@@ -127,6 +128,24 @@ class UnivariatePolynomial final
                            });
   }
 
+  // Divides this polynomial by the vanishing polynomial Π(X - xᵢ) of the given
+  // |roots| and discards the remainder. This is only supported for dense
+  // polynomials.
+  template <typename Container>
+  UnivariatePolynomial& DivByVanishingPolyInPlace(const Container& roots) {
+    return internal::UnivariatePolynomialOp<
+        Coefficients>::DivByVanishingPolyInPlace(*this, roots);
+  }
+
+  // Returns Σᵢ |scalars[i]| * |polys[i]| in a single parallel pass over the
+  // coefficients. This is only supported for dense polynomials.
+  static UnivariatePolynomial WeightedSum(
+      absl::Span<const UnivariatePolynomial* const> polys,
+      absl::Span<const Field> scalars) {
+    return internal::UnivariatePolynomialOp<Coefficients>::WeightedSum(
+        polys, scalars);
+  }
+
   // Return a polynomial where the original polynomial reduces its degree
   // by categorizing coefficients into even and odd degrees,
   // multiplying either set of coefficients by a specified random field |r|,
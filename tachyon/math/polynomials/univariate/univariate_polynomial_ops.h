@@ -8,11 +8,15 @@
 
 #include <algorithm>
 #include <iterator>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/openmp_util.h"
+#include "tachyon/base/parallelize.h"
 #include "tachyon/math/base/arithmetics_results.h"
 #include "tachyon/math/polynomials/univariate/univariate_polynomial.h"
 
@@ -26,6 +30,10 @@ class UnivariatePolynomialOp<UnivariateDenseCoefficients<F, MaxDegree>> {
   using S = UnivariateSparseCoefficients<F, MaxDegree>;
   using Term = typename S::Term;
 
+  // The minimum size of coefficients at which parallelization of
+  // |SyntheticDivideInPlace()| is beneficial.
+  constexpr static size_t kMinSizeForParallelSyntheticDivision = 1 << 12;
+
   static UnivariatePolynomial<D>& AddInPlace(
       UnivariatePolynomial<D>& self, const UnivariatePolynomial<D>& other) {
     std::vector<F>& l_coefficients = self.coefficients_.coefficients_;
@@ -239,8 +247,19 @@ class UnivariatePolynomialOp<UnivariateDenseCoefficients<F, MaxDegree>> {
   template <typename DOrS>
   static UnivariatePolynomial<D>& DivInPlace(
       UnivariatePolynomial<D>& self, const UnivariatePolynomial<DOrS>& other) {
-    DivResult<UnivariatePolynomial<D>> result = Divide(self, other);
-    self = std::move(result.quotient);
+    if (self.IsZero()) {
+      return self;
+    } else if (other.IsZero()) {
+      NOTREACHED() << "Divide by zero polynomial";
+    } else if (self.Degree() < other.Degree()) {
+      self.coefficients_.coefficients_.clear();
+      return self;
+    }
+    std::vector<F>& coefficients = self.coefficients_.coefficients_;
+    size_t other_degree = other.Degree();
+    DivideInPlace(coefficients, other);
+    coefficients.erase(coefficients.begin(),
+                       coefficients.begin() + other_degree);
     self.coefficients_.RemoveHighDegreeZeros();
     return self;
   }
@@ -248,12 +267,74 @@ class UnivariatePolynomialOp<UnivariateDenseCoefficients<F, MaxDegree>> {
   template <typename DOrS>
   static UnivariatePolynomial<D>& ModInPlace(
       UnivariatePolynomial<D>& self, const UnivariatePolynomial<DOrS>& other) {
-    DivResult<UnivariatePolynomial<D>> result = Divide(self, other);
-    self = std::move(result.remainder);
+    if (self.IsZero()) {
+      return self;
+    } else if (other.IsZero()) {
+      NOTREACHED() << "Divide by zero polynomial";
+    } else if (self.Degree() < other.Degree()) {
+      return self;
+    }
+    std::vector<F>& coefficients = self.coefficients_.coefficients_;
+    DivideInPlace(coefficients, other);
+    coefficients.resize(other.Degree());
+    self.coefficients_.RemoveHighDegreeZeros();
+    return self;
+  }
+
+  // Divides |self| by the vanishing polynomial Π(X - xᵢ) of the given |roots|
+  // in place, using a synthetic division per root. The remainder is
+  // discarded.
+  template <typename Container>
+  static UnivariatePolynomial<D>& DivByVanishingPolyInPlace(
+      UnivariatePolynomial<D>& self, const Container& roots) {
+    std::vector<F>& coefficients = self.coefficients_.coefficients_;
+    size_t num_roots = std::size(roots);
+    if (coefficients.size() <= num_roots) {
+      coefficients.clear();
+      return self;
+    }
+    // NOTE: Each synthetic division leaves the remainder in the
+    // lowest slot and the quotient above it. So the next division can be
+    // done on the quotient by just skipping the lowest slot.
+    absl::Span<F> span = absl::MakeSpan(coefficients);
+    for (const F& root : roots) {
+      SyntheticDivideInPlace(span, root);
+      span.remove_prefix(1);
+    }
+    coefficients.erase(coefficients.begin(), coefficients.begin() + num_roots);
     self.coefficients_.RemoveHighDegreeZeros();
     return self;
   }
 
+  // Returns Σᵢ sᵢ * Pᵢ(X) without allocating any intermediate polynomial.
+  // Each thread accumulates a chunk of the coefficients over all |polys|, so
+  // the result is written once and every input is read once.
+  static UnivariatePolynomial<D> WeightedSum(
+      absl::Span<const UnivariatePolynomial<D>* const> polys,
+      absl::Span<const F> scalars) {
+    CHECK_EQ(polys.size(), scalars.size());
+    size_t size = 0;
+    for (const UnivariatePolynomial<D>* poly : polys) {
+      size = std::max(size, poly->coefficients_.coefficients_.size());
+    }
+    std::vector<F> coefficients = base::CreateVector(size, F::Zero());
+    base::Parallelize(coefficients, [polys, scalars](absl::Span<F> chunk,
+                                                      size_t chunk_offset,
+                                                      size_t chunk_size) {
+      size_t start = chunk_offset * chunk_size;
+      for (size_t i = 0; i < polys.size(); ++i) {
+        const std::vector<F>& poly_coefficients =
+            polys[i]->coefficients_.coefficients_;
+        if (start >= poly_coefficients.size()) continue;
+        size_t end = std::min(start + chunk.size(), poly_coefficients.size());
+        for (size_t j = start; j < end; ++j) {
+          chunk[j - start] += poly_coefficients[j] * scalars[i];
+        }
+      }
+    });
+    return UnivariatePolynomial<D>(D(std::move(coefficients)));
+  }
+
   template <typename DOrS>
   static DivResult<UnivariatePolynomial<D>> DivMod(
       const UnivariatePolynomial<D>& self,
@@ -309,35 +390,134 @@ class UnivariatePolynomialOp<UnivariateDenseCoefficients<F, MaxDegree>> {
     } else if (self.Degree() < other.Degree()) {
       return {UnivariatePolynomial<D>::Zero(), self.ToDense()};
     }
-    std::vector<F> quotient =
-        base::CreateVector(self.Degree() - other.Degree() + 1, F::Zero());
-    UnivariatePolynomial<D> remainder = self.ToDense();
-    std::vector<F>& r_coefficients = remainder.coefficients_.coefficients_;
-    F divisor_leading_inv = other.GetLeadingCoefficient()->Inverse();
-
-    while (!remainder.IsZero() && remainder.Degree() >= other.Degree()) {
-      F q_coeff =
-          remainder.coefficients_.coefficients_.back() * divisor_leading_inv;
-      size_t degree = remainder.Degree() - other.Degree();
-      quotient[degree] = q_coeff;
-
-      if constexpr (std::is_same_v<DOrS, D>) {
-        const std::vector<F>& d_terms = other.coefficients_.coefficients_;
-        for (size_t i = 0; i < d_terms.size(); ++i) {
-          r_coefficients[degree + i] -= q_coeff * d_terms[i];
+    std::vector<F> coefficients = self.coefficients_.coefficients_;
+    DivideInPlace(coefficients, other);
+    size_t other_degree = other.Degree();
+    std::vector<F> remainder(
+        std::make_move_iterator(coefficients.begin()),
+        std::make_move_iterator(coefficients.begin() + other_degree));
+    coefficients.erase(coefficients.begin(),
+                       coefficients.begin() + other_degree);
+    return {UnivariatePolynomial<D>(D(std::move(coefficients))),
+            UnivariatePolynomial<D>(D(std::move(remainder)))};
+  }
+
+  // Divides the polynomial whose coefficients are |coefficients| by |other|
+  // in place. Let n be the degree of the dividend and k be the degree of
+  // |other|. After this, |coefficients[0..k)| holds the remainder and
+  // |coefficients[k..n]| holds the quotient.
+  //
+  // If |other| is a linear polynomial, it is divided by synthetic division
+  // which runs in O(n) and can be parallelized. Otherwise, it is divided by
+  // an expanded synthetic division, which runs in O((n - k + 1) * k).
+  template <typename DOrS>
+  static void DivideInPlace(std::vector<F>& coefficients,
+                            const UnivariatePolynomial<DOrS>& other) {
+    size_t degree = coefficients.size() - 1;
+    size_t other_degree = other.Degree();
+    const F& leading_coeff = *other.GetLeadingCoefficient();
+
+    if (other_degree == 1) {
+      // a * X + b = a * (X - u), where u = -b / a.
+      F leading_coeff_inv = leading_coeff.Inverse();
+      F root = F::Zero();
+      const F* constant_coeff = other[0];
+      if (constant_coeff != nullptr) {
+        root = -(*constant_coeff) * leading_coeff_inv;
+      }
+      SyntheticDivideInPlace(absl::MakeSpan(coefficients), root);
+      if (!leading_coeff.IsOne()) {
+        OPENMP_PARALLEL_FOR(size_t i = 1; i < coefficients.size(); ++i) {
+          coefficients[i] *= leading_coeff_inv;
         }
-      } else {
-        const std::vector<Term>& d_terms = other.coefficients().terms_;
-        for (const Term& d_term : d_terms) {
-          r_coefficients[degree + d_term.degree] -=
-              q_coeff * d_term.coefficient;
+      }
+      return;
+    }
+
+    bool is_monic = leading_coeff.IsOne();
+    F leading_coeff_inv = is_monic ? F::One() : leading_coeff.Inverse();
+    for (size_t k = 0; k <= degree - other_degree; ++k) {
+      size_t i = degree - k;
+      F q_coeff = coefficients[i];
+      if (!is_monic) q_coeff *= leading_coeff_inv;
+      if (!q_coeff.IsZero()) {
+        size_t offset = i - other_degree;
+        if constexpr (std::is_same_v<DOrS, D>) {
+          const std::vector<F>& d_coefficients =
+              other.coefficients_.coefficients_;
+          for (size_t j = 0; j < other_degree; ++j) {
+            coefficients[offset + j] -= q_coeff * d_coefficients[j];
+          }
+        } else {
+          const std::vector<Term>& d_terms = other.coefficients().terms_;
+          for (const Term& d_term : d_terms) {
+            if (d_term.degree == other_degree) break;
+            coefficients[offset + d_term.degree] -=
+                q_coeff * d_term.coefficient;
+          }
         }
       }
-      remainder.coefficients_.RemoveHighDegreeZeros();
+      coefficients[i] = std::move(q_coeff);
+    }
+  }
+
+  // Divides the polynomial whose coefficients are |coefficients| by
+  // (X - |root|) in place using synthetic division. After this,
+  // |coefficients[0]| holds the remainder and |coefficients[1..n]| holds the
+  // quotient.
+  //
+  // Let the dividend be cₙXⁿ + ... + c₁X + c₀. Then the quotient qₙ₋₁Xⁿ⁻¹ +
+  // ... + q₀ and the remainder r are given by sᵢ = cᵢ + u * sᵢ₊₁ with sₙ = cₙ,
+  // where qᵢ = sᵢ₊₁ and r = s₀. Since this is a linear recurrence, it can be
+  // computed in parallel by blocks:
+  // 1) Each block runs the recurrence as if nothing was carried from the
+  //    upper block.
+  // 2) The true value at the bottom of each block is propagated from the
+  //    highest block to the lowest block serially.
+  // 3) Each block adds uʲ * carry to its j-th element counted from the top.
+  static void SyntheticDivideInPlace(absl::Span<F> coefficients,
+                                     const F& root) {
+    size_t size = coefficients.size();
+    if (size < 2) return;
+#if defined(TACHYON_HAS_OPENMP)
+    size_t thread_nums = static_cast<size_t>(omp_get_max_threads());
+#else
+    size_t thread_nums = 1;
+#endif
+    if (thread_nums == 1 || size < kMinSizeForParallelSyntheticDivision) {
+      for (size_t i = size - 1; i > 0; --i) {
+        coefficients[i - 1] += coefficients[i] * root;
+      }
+      return;
+    }
+
+    size_t chunk_size = (size + thread_nums - 1) / thread_nums;
+    size_t num_chunks = (size + chunk_size - 1) / chunk_size;
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < num_chunks; ++i) {
+      size_t lo = i * chunk_size;
+      size_t hi = std::min(lo + chunk_size, size);
+      for (size_t j = hi - 1; j > lo; --j) {
+        coefficients[j - 1] += coefficients[j] * root;
+      }
+    }
+
+    // |carries[i]| is the true value right above the i-th block.
+    std::vector<F> carries = base::CreateVector(num_chunks, F::Zero());
+    F root_pow_chunk_size = root.Pow(chunk_size);
+    for (size_t i = num_chunks - 1; i > 0; --i) {
+      carries[i - 1] = coefficients[i * chunk_size];
+      carries[i - 1] += root_pow_chunk_size * carries[i];
+    }
+
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < num_chunks - 1; ++i) {
+      size_t lo = i * chunk_size;
+      size_t hi = lo + chunk_size;
+      F carry = carries[i] * root;
+      for (size_t j = hi; j > lo; --j) {
+        coefficients[j - 1] += carry;
+        carry *= root;
+      }
     }
-    D d(std::move(quotient));
-    d.RemoveHighDegreeZeros();
-    return {UnivariatePolynomial<D>(std::move(d)), std::move(remainder)};
   }
 };
 
@@ -0,0 +1,197 @@
+#ifndef TACHYON_MATH_POLYNOMIALS_UNIVARIATE_UNIVARIATE_SUBPRODUCT_TREE_H_
+#define TACHYON_MATH_POLYNOMIALS_UNIVARIATE_UNIVARIATE_SUBPRODUCT_TREE_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/math/polynomials/univariate/univariate_fast_arithmetic.h"
+#include "tachyon/math/polynomials/univariate/univariate_polynomial.h"
+
+namespace tachyon::math {
+
+// A subproduct tree over points x₀, x₁, ..., xₙ₋₁, which are not necessarily
+// elements of a multiplicative subgroup. The leaves are X - xᵢ and every
+// other node is the product of its two children, so the node j at the level k
+// is the vanishing polynomial of the points xⱼ*₂ᵏ, ..., x₍ⱼ₊₁₎*₂ᵏ₋₁. If a
+// level has an odd number of nodes, the last node is carried to the next level
+// as is.
+//
+// Using the tree, multipoint evaluation and interpolation run in O(n log² n)
+// instead of O(n²). See
+// https://cr.yp.to/lineartime/multapps-20080515.pdf for details.
+template <typename F>
+class UnivariateSubproductTree {
+ public:
+  // The level at which |Evaluate()| stops descending the tree and evaluates
+  // the remainders directly. Dividing by polynomials of degree less than 2⁴ is
+  // slower than evaluating them with Horner's method.
+  constexpr static size_t kDirectEvaluationLevel = 4;
+
+  explicit UnivariateSubproductTree(std::vector<F> points)
+      : points_(std::move(points)) {
+    CHECK(!points_.empty());
+    levels_.push_back(base::Map(points_, [](const F& point) {
+      return std::vector<F>{-point, F::One()};
+    }));
+    while (levels_.back().size() > 1) {
+      const std::vector<std::vector<F>>& children = levels_.back();
+      std::vector<std::vector<F>> parents((children.size() + 1) / 2);
+      ForEachNode(parents.size(), [&children, &parents](size_t i) {
+        if (2 * i + 1 < children.size()) {
+          parents[i] = UnivariateFastArithmetic<F>::Mul(children[2 * i],
+                                                        children[2 * i + 1]);
+        } else {
+          parents[i] = children[2 * i];
+        }
+      });
+      levels_.push_back(std::move(parents));
+    }
+  }
+
+  const std::vector<F>& points() const { return points_; }
+
+  // Returns the vanishing polynomial of |points_|, which is the root of the
+  // tree.
+  template <size_t MaxDegree>
+  UnivariateDensePolynomial<F, MaxDegree> GetVanishingPolynomial() const {
+    return UnivariateDensePolynomial<F, MaxDegree>(
+        UnivariateDenseCoefficients<F, MaxDegree>(levels_.back()[0]));
+  }
+
+  // Returns the evaluations of |poly| at |points_|.
+  template <size_t MaxDegree>
+  std::vector<F> Evaluate(
+      const UnivariateDensePolynomial<F, MaxDegree>& poly) const {
+    return EvaluateCoefficients(poly.coefficients().coefficients());
+  }
+
+  // Computes the polynomial of degree less than |points_.size()| which
+  // evaluates to |evals[i]| at |points_[i]|. Returns false if |evals| doesn't
+  // match |points_| in size or |points_| are not distinct.
+  //
+  // Let m(X) be the vanishing polynomial of |points_|. Then the result is
+  // Σᵢ wᵢ * m(X) / (X - xᵢ), where wᵢ = yᵢ / m'(xᵢ). This is computed from the
+  // leaves to the root, where each node is the sum of its left child times the
+  // vanishing polynomial of its right child and vice versa.
+  template <size_t MaxDegree>
+  bool Interpolate(absl::Span<const F> evals,
+                   UnivariateDensePolynomial<F, MaxDegree>* ret) const {
+    using Poly = UnivariateDensePolynomial<F, MaxDegree>;
+    using Coeffs = UnivariateDenseCoefficients<F, MaxDegree>;
+
+    if (evals.size() != points_.size()) {
+      LOG(ERROR) << "points and evals sizes don't match";
+      return false;
+    }
+
+    // m'(X)
+    const std::vector<F>& vanishing_poly = levels_.back()[0];
+    std::vector<F> derivative(vanishing_poly.size() - 1);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < derivative.size(); ++i) {
+      derivative[i] = vanishing_poly[i + 1] * F(i + 1);
+    }
+    std::vector<F> weights = EvaluateCoefficients(derivative);
+    for (const F& weight : weights) {
+      if (weight.IsZero()) {
+        LOG(ERROR) << "points are not distinct";
+        return false;
+      }
+    }
+    CHECK(F::BatchInverseInPlace(weights));
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < weights.size(); ++i) {
+      weights[i] *= evals[i];
+    }
+
+    std::vector<std::vector<F>> nodes = base::Map(
+        weights, [](const F& weight) { return std::vector<F>{weight}; });
+    for (size_t level = 0; level < levels_.size() - 1; ++level) {
+      const std::vector<std::vector<F>>& vanishing_polys = levels_[level];
+      std::vector<std::vector<F>> parents((nodes.size() + 1) / 2);
+      ForEachNode(parents.size(), [&vanishing_polys, &nodes,
+                                   &parents](size_t i) {
+        if (2 * i + 1 < nodes.size()) {
+          std::vector<F> left = UnivariateFastArithmetic<F>::Mul(
+              nodes[2 * i], vanishing_polys[2 * i + 1]);
+          std::vector<F> right = UnivariateFastArithmetic<F>::Mul(
+              nodes[2 * i + 1], vanishing_polys[2 * i]);
+          if (left.size() < right.size()) std::swap(left, right);
+          for (size_t j = 0; j < right.size(); ++j) {
+            left[j] += right[j];
+          }
+          parents[i] = std::move(left);
+        } else {
+          parents[i] = std::move(nodes[2 * i]);
+        }
+      });
+      nodes = std::move(parents);
+    }
+    *ret = Poly(Coeffs(std::move(nodes[0])));
+    return true;
+  }
+
+ private:
+  // Calls |callback| for every index in [0, |num_nodes|). The nodes are
+  // processed in parallel only if there are enough nodes to keep every thread
+  // busy. Otherwise, the parallelism is left to the multiplications and the
+  // divisions inside |callback|.
+  template <typename Callback>
+  static void ForEachNode(size_t num_nodes, Callback callback) {
+#if defined(TACHYON_HAS_OPENMP)
+    size_t thread_nums = static_cast<size_t>(omp_get_max_threads());
+#pragma omp parallel for if (num_nodes >= thread_nums)
+#endif
+    for (size_t i = 0; i < num_nodes; ++i) {
+      callback(i);
+    }
+  }
+
+  // Returns the evaluations of the polynomial whose coefficients are
+  // |coefficients| at |points_|. The remainder of the polynomial divided by
+  // each node is computed from the root to |kDirectEvaluationLevel|, and then
+  // the remainders are evaluated at the points under each node.
+  std::vector<F> EvaluateCoefficients(
+      const std::vector<F>& coefficients) const {
+    size_t stop_level = std::min(kDirectEvaluationLevel, levels_.size() - 1);
+    std::vector<std::vector<F>> remainders = {
+        UnivariateFastArithmetic<F>::Mod(coefficients, levels_.back()[0])};
+    for (size_t level = levels_.size() - 2; level != stop_level - 1; --level) {
+      const std::vector<std::vector<F>>& nodes = levels_[level];
+      std::vector<std::vector<F>> children(nodes.size());
+      ForEachNode(children.size(), [&nodes, &remainders, &children](size_t i) {
+        children[i] = UnivariateFastArithmetic<F>::Mod(remainders[i / 2],
+                                                       nodes[i]);
+      });
+      remainders = std::move(children);
+    }
+
+    std::vector<F> ret(points_.size());
+    size_t points_per_node = size_t{1} << stop_level;
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < ret.size(); ++i) {
+      const std::vector<F>& remainder = remainders[i / points_per_node];
+      // Horner's method.
+      F eval = F::Zero();
+      for (auto it = remainder.rbegin(); it != remainder.rend(); ++it) {
+        eval *= points_[i];
+        eval += *it;
+      }
+      ret[i] = std::move(eval);
+    }
+    return ret;
+  }
+
+  std::vector<F> points_;
+  // |levels_[0]| are the leaves and |levels_.back()| has only the root.
+  std::vector<std::vector<std::vector<F>>> levels_;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_POLYNOMIALS_UNIVARIATE_UNIVARIATE_SUBPRODUCT_TREE_H_
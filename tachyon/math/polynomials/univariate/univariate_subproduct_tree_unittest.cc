@@ -0,0 +1,76 @@
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/elliptic_curves/bls12/bls12_381/fr.h"
+#include "tachyon/math/polynomials/univariate/univariate_subproduct_tree.h"
+
+namespace tachyon::math {
+
+namespace {
+
+const size_t kMaxDegree = (size_t{1} << 13) - 1;
+
+using F = bls12_381::Fr;
+using Poly = UnivariateDensePolynomial<F, kMaxDegree>;
+
+class UnivariateSubproductTreeTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { F::Init(); }
+};
+
+}  // namespace
+
+TEST_F(UnivariateSubproductTreeTest, GetVanishingPolynomial) {
+  std::vector<F> points = base::CreateVector(100, []() { return F::Random(); });
+  UnivariateSubproductTree<F> tree(points);
+  Poly vanishing_poly = tree.GetVanishingPolynomial<kMaxDegree>();
+  EXPECT_EQ(vanishing_poly.Degree(), points.size());
+  for (const F& point : points) {
+    EXPECT_TRUE(vanishing_poly.Evaluate(point).IsZero());
+  }
+}
+
+TEST_F(UnivariateSubproductTreeTest, Evaluate) {
+  for (size_t num_points : {size_t{1}, size_t{7}, size_t{100}, size_t{1000}}) {
+    std::vector<F> points =
+        base::CreateVector(num_points, []() { return F::Random(); });
+    UnivariateSubproductTree<F> tree(points);
+    for (size_t degree : {size_t{0}, num_points / 2, 2 * num_points}) {
+      Poly poly = Poly::Random(degree);
+      std::vector<F> expected = base::Map(
+          points, [&poly](const F& point) { return poly.Evaluate(point); });
+      EXPECT_EQ(tree.Evaluate(poly), expected);
+    }
+    EXPECT_EQ(tree.Evaluate(Poly::Zero()),
+              base::CreateVector(num_points, F::Zero()));
+  }
+}
+
+TEST_F(UnivariateSubproductTreeTest, Interpolate) {
+  for (size_t num_points : {size_t{1}, size_t{7}, size_t{100}, size_t{1000}}) {
+    std::vector<F> points =
+        base::CreateVector(num_points, []() { return F::Random(); });
+    Poly expected = Poly::Random(num_points - 1);
+    std::vector<F> evals = base::Map(points, [&expected](const F& point) {
+      return expected.Evaluate(point);
+    });
+
+    UnivariateSubproductTree<F> tree(points);
+    Poly actual;
+    ASSERT_TRUE(tree.Interpolate(evals, &actual));
+    EXPECT_EQ(actual, expected);
+  }
+}
+
+TEST_F(UnivariateSubproductTreeTest, InterpolateInvalidInputs) {
+  std::vector<F> points = {F(1), F(2), F(3)};
+  UnivariateSubproductTree<F> tree(points);
+  Poly poly;
+  EXPECT_FALSE(tree.Interpolate(std::vector<F>{F(1), F(2)}, &poly));
+
+  UnivariateSubproductTree<F> duplicated_tree({F(1), F(2), F(1)});
+  EXPECT_FALSE(
+      duplicated_tree.Interpolate(std::vector<F>{F(1), F(2), F(3)}, &poly));
+}
+
+}  // namespace tachyon::math
@@ -0,0 +1,181 @@
+// Copyright 2020-2022 The Electric Coin Company
+// Copyright 2022 The Halo2 developers
+// Use of this source code is governed by a MIT/Apache-2.0 style license that
+// can be found in the LICENSE-MIT.halo2 and the LICENCE-APACHE.halo2
+// file.
+
+#ifndef TACHYON_ZK_BASE_COMMITMENTS_GWC_EXTENSION_H_
+#define TACHYON_ZK_BASE_COMMITMENTS_GWC_EXTENSION_H_
+
+#include <stddef.h>
+
+#include <array>
+#include <utility>
+#include <vector>
+
+#include "tachyon/crypto/commitments/batch_commitment_state.h"
+#include "tachyon/crypto/commitments/kzg/gwc.h"
+#include "tachyon/zk/base/commitments/univariate_polynomial_commitment_scheme_extension.h"
+
+namespace tachyon {
+namespace zk {
+
+template <typename Curve, size_t MaxDegree, size_t MaxExtendedDegree,
+          typename Commitment>
+class GWCExtension final
+    : public UnivariatePolynomialCommitmentSchemeExtension<
+          GWCExtension<Curve, MaxDegree, MaxExtendedDegree, Commitment>> {
+ public:
+  // NOTE: The following value are pre-determined according to
+  // the Commitment Opening Scheme.
+  // https://
+  // github.com/kroma-network/halo2/blob/7d0a36990452c8e7ebd600de258420781a9b7917/halo2_proofs/src/poly/kzg/multiopen/gwc/prover.rs
+  constexpr static bool kQueryInstance = false;
+
+  using Base = UnivariatePolynomialCommitmentSchemeExtension<
+      GWCExtension<Curve, MaxDegree, MaxExtendedDegree, Commitment>>;
+  using Field = typename Base::Field;
+  using Poly = typename Base::Poly;
+  using Evals = typename Base::Evals;
+
+  GWCExtension() = default;
+  explicit GWCExtension(crypto::GWC<Curve, MaxDegree, Commitment>&& gwc)
+      : gwc_(std::move(gwc)) {}
+
+  size_t N() const { return gwc_.N(); }
+
+  size_t D() const { return N() - 1; }
+
+  crypto::BatchCommitmentState& batch_commitment_state() {
+    return gwc_.batch_commitment_state();
+  }
+  bool GetBatchMode() const { return gwc_.GetBatchMode(); }
+
+  void SetBatchMode(size_t batch_count) { gwc_.SetBatchMode(batch_count); }
+
+  std::vector<Commitment> GetBatchCommitments() {
+    return gwc_.GetBatchCommitments();
+  }
+
+  [[nodiscard]] bool DoUnsafeSetup(size_t size) {
+    return gwc_.DoUnsafeSetup(size);
+  }
+
+  [[nodiscard]] bool DoUnsafeSetup(size_t size, const Field& tau) {
+    return gwc_.DoUnsafeSetup(size, tau);
+  }
+
+  template <typename ScalarContainer>
+  [[nodiscard]] bool DoCommit(const ScalarContainer& v, Commitment* out) const {
+    return gwc_.DoCommit(v, out);
+  }
+
+  template <typename ScalarContainer>
+  [[nodiscard]] bool DoCommit(const ScalarContainer& v,
+                              crypto::BatchCommitmentState& state,
+                              size_t index) {
+    return gwc_.DoCommit(v, state, index);
+  }
+
+  [[nodiscard]] bool DoCommit(const Poly& poly, Commitment* out) const {
+    return gwc_.DoCommit(poly, out);
+  }
+
+  [[nodiscard]] bool DoCommit(const Poly& poly,
+                              crypto::BatchCommitmentState& state,
+                              size_t index) {
+    return gwc_.DoCommit(poly, state, index);
+  }
+
+  [[nodiscard]] bool DoCommitLagrange(const Evals& evals,
+                                      Commitment* out) const {
+    return gwc_.DoCommitLagrange(evals, out);
+  }
+
+  [[nodiscard]] bool DoCommitLagrange(const Evals& evals,
+                                      crypto::BatchCommitmentState& state,
+                                      size_t index) {
+    return gwc_.DoCommitLagrange(evals, state, index);
+  }
+
+  template <typename ScalarContainer>
+  [[nodiscard]] bool DoCommitLagrange(const ScalarContainer& v,
+                                      Commitment* out) const {
+    return gwc_.DoCommitLagrange(v, out);
+  }
+
+  template <typename ScalarContainer>
+  [[nodiscard]] bool DoCommitLagrange(const ScalarContainer& v,
+                                      crypto::BatchCommitmentState& state,
+                                      size_t index) {
+    return gwc_.DoCommitLagrange(v, state, index);
+  }
+
+  template <typename Container, typename Proof>
+  [[nodiscard]] bool DoCreateOpeningProof(const Container& poly_openings,
+                                          Proof* proof) const {
+    return gwc_.DoCreateOpeningProof(poly_openings, proof);
+  }
+
+  template <typename Container, typename Proof>
+  [[nodiscard]] bool DoVerifyOpeningProof(const Container& poly_openings,
+                                          Proof* proof) const {
+    return gwc_.DoVerifyOpeningProof(poly_openings, proof);
+  }
+
+  const std::array<typename Curve::G2Prepared, 2>& g2_arr() const {
+    return gwc_.g2_arr();
+  }
+
+  void SetTauG2(const typename Curve::G2Curve::AffinePoint& tau_g2) {
+    gwc_.SetTauG2(tau_g2);
+  }
+
+  template <typename Container>
+  [[nodiscard]] bool AccumulateOpeningProof(
+      const Container& poly_openings,
+      crypto::TranscriptReader<Commitment>* reader,
+      crypto::KZGPairingAccumulator<Curve>* accumulator) const {
+    return gwc_.AccumulateOpeningProof(poly_openings, reader, accumulator);
+  }
+
+  [[nodiscard]] bool VerifyAccumulator(
+      const crypto::KZGPairingAccumulator<Curve>& accumulator) const {
+    return gwc_.VerifyAccumulator(accumulator);
+  }
+
+ private:
+  crypto::GWC<Curve, MaxDegree, Commitment> gwc_;
+};
+
+template <typename Curve, size_t MaxDegree, size_t MaxExtendedDegree,
+          typename Commitment>
+struct UnivariatePolynomialCommitmentSchemeExtensionTraits<
+    GWCExtension<Curve, MaxDegree, MaxExtendedDegree, Commitment>> {
+ public:
+  constexpr static size_t kMaxExtendedDegree = MaxExtendedDegree;
+  constexpr static size_t kMaxExtendedSize = kMaxExtendedDegree + 1;
+};
+
+}  // namespace zk
+
+namespace crypto {
+
+template <typename Curve, size_t MaxDegree, size_t MaxExtendedDegree,
+          typename _Commitment>
+struct VectorCommitmentSchemeTraits<
+    zk::GWCExtension<Curve, MaxDegree, MaxExtendedDegree, _Commitment>> {
+ public:
+  using G1Point = typename Curve::G1Curve::AffinePoint;
+  using Field = typename G1Point::ScalarField;
+  using Commitment = _Commitment;
+
+  constexpr static size_t kMaxSize = MaxDegree + 1;
+  constexpr static bool kIsTransparent = false;
+  constexpr static bool kSupportsBatchMode = true;
+};
+
+}  // namespace crypto
+}  // namespace tachyon
+
+#endif  // TACHYON_ZK_BASE_COMMITMENTS_GWC_EXTENSION_H_
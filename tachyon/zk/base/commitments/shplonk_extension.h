@@ -9,9 +9,12 @@
 
 #include <stddef.h>
 
+#include <array>
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "tachyon/crypto/commitments/batch_commitment_state.h"
 #include "tachyon/crypto/commitments/kzg/shplonk.h"
 #include "tachyon/zk/base/commitments/univariate_polynomial_commitment_scheme_extension.h"
@@ -129,16 +132,37 @@ class SHPlonkExtension final
     return shplonk_.DoVerifyOpeningProof(poly_openings, proof);
   }
 
+  const std::array<typename Curve::G2Prepared, 2>& g2_arr() const {
+    return shplonk_.g2_arr();
+  }
+
+  void SetTauG2(const typename Curve::G2Curve::AffinePoint& tau_g2) {
+    shplonk_.SetTauG2(tau_g2);
+  }
+
+  template <typename Container>
+  [[nodiscard]] bool AccumulateOpeningProof(
+      const Container& poly_openings,
+      crypto::TranscriptReader<Commitment>* reader,
+      crypto::KZGPairingAccumulator<Curve>* accumulator) const {
+    return shplonk_.AccumulateOpeningProof(poly_openings, reader, accumulator);
+  }
+
+  [[nodiscard]] bool VerifyAccumulator(
+      const crypto::KZGPairingAccumulator<Curve>& accumulator) const {
+    return shplonk_.VerifyAccumulator(accumulator);
+  }
+
  private:
   friend class halo2_api::bn254::SHPlonkProver;
 
   using G1Point = typename Curve::G1Curve::AffinePoint;
 
-  const std::vector<G1Point>& GetG1PowersOfTau() const {
+  absl::Span<const G1Point> GetG1PowersOfTau() const {
     return this->shplonk_.GetG1PowersOfTau();
   }
 
-  const std::vector<G1Point>& GetG1PowersOfTauLagrange() const {
+  absl::Span<const G1Point> GetG1PowersOfTauLagrange() const {
     return this->shplonk_.GetG1PowersOfTauLagrange();
   }
 
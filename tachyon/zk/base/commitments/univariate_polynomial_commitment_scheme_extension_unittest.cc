@@ -0,0 +1,147 @@
+#include "tachyon/zk/base/commitments/univariate_polynomial_commitment_scheme_extension.h"
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/buffer/buffer.h"
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/crypto/transcripts/simple_transcript.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/bn254.h"
+#include "tachyon/math/polynomials/univariate/univariate_evaluation_domain_factory.h"
+#include "tachyon/zk/base/commitments/gwc_extension.h"
+#include "tachyon/zk/base/commitments/shplonk_extension.h"
+
+namespace tachyon::zk {
+
+namespace {
+
+constexpr size_t kMaxDegree = (size_t{1} << 3) - 1;
+constexpr size_t kMaxExtendedDegree = (size_t{1} << 5) - 1;
+
+template <typename PCS>
+class UnivariatePolynomialCommitmentSchemeExtensionTest
+    : public testing::Test {
+ public:
+  constexpr static size_t kN = kMaxDegree + 1;
+
+  using F = typename PCS::Field;
+  using Poly = typename PCS::Poly;
+  using Evals = typename PCS::Evals;
+  using Domain = typename PCS::Domain;
+  using Commitment = typename PCS::Commitment;
+  using Point = typename Poly::Point;
+
+  static void SetUpTestSuite() { math::bn254::BN254Curve::Init(); }
+
+  void SetUp() override {
+    ASSERT_TRUE(pcs_.UnsafeSetup(kN));
+
+    polys_ = base::CreateVector(3, []() { return Poly::Random(kMaxDegree); });
+    points_ = {F(1), F(2)};
+    commitments_ = base::Map(polys_, [this](const Poly& poly) {
+      Commitment commitment;
+      CHECK(pcs_.Commit(poly, &commitment));
+      return commitment;
+    });
+
+    // {P₀, [x₀, x₁]}, {P₁, [x₀]}, {P₂, [x₁]}
+    AddOpening(0, 0);
+    AddOpening(0, 1);
+    AddOpening(1, 0);
+    AddOpening(2, 1);
+  }
+
+ protected:
+  void AddOpening(size_t poly_idx, size_t point_idx) {
+    F opening = polys_[poly_idx].Evaluate(points_[point_idx]);
+    prover_openings_.emplace_back(
+        base::DeepRef<const Poly>(&polys_[poly_idx]),
+        base::DeepRef<const Point>(&points_[point_idx]), opening);
+    verifier_openings_.emplace_back(
+        base::DeepRef<const Commitment>(&commitments_[poly_idx]),
+        base::DeepRef<const Point>(&points_[point_idx]), opening);
+  }
+
+  PCS pcs_;
+  std::vector<Poly> polys_;
+  std::vector<F> points_;
+  std::vector<Commitment> commitments_;
+  std::vector<crypto::PolynomialOpening<Poly>> prover_openings_;
+  std::vector<crypto::PolynomialOpening<Poly, Commitment>> verifier_openings_;
+};
+
+}  // namespace
+
+using PCSTypes =
+    testing::Types<SHPlonkExtension<math::bn254::BN254Curve, kMaxDegree,
+                                    kMaxExtendedDegree,
+                                    math::bn254::G1AffinePoint>,
+                   GWCExtension<math::bn254::BN254Curve, kMaxDegree,
+                                kMaxExtendedDegree,
+                                math::bn254::G1AffinePoint>>;
+TYPED_TEST_SUITE(UnivariatePolynomialCommitmentSchemeExtensionTest, PCSTypes);
+
+TYPED_TEST(UnivariatePolynomialCommitmentSchemeExtensionTest, Commit) {
+  using PCS = TypeParam;
+  using Evals = typename PCS::Evals;
+  using Domain = typename PCS::Domain;
+  using Commitment = typename PCS::Commitment;
+
+  PCS& pcs = this->pcs_;
+  EXPECT_EQ(pcs.N(), this->kN);
+  EXPECT_FALSE(PCS::kQueryInstance);
+
+  std::unique_ptr<Domain> domain = Domain::Create(this->kN);
+  Evals evals = domain->FFT(this->polys_[0]);
+  Commitment commitment;
+  ASSERT_TRUE(pcs.CommitLagrange(evals, &commitment));
+  EXPECT_EQ(commitment, this->commitments_[0]);
+
+  pcs.SetBatchMode(this->polys_.size());
+  for (size_t i = 0; i < this->polys_.size(); ++i) {
+    ASSERT_TRUE(pcs.Commit(this->polys_[i], i));
+  }
+  EXPECT_EQ(pcs.GetBatchCommitments(), this->commitments_);
+  EXPECT_FALSE(pcs.GetBatchMode());
+}
+
+TYPED_TEST(UnivariatePolynomialCommitmentSchemeExtensionTest,
+           CreateAndVerifyProof) {
+  using PCS = TypeParam;
+  using F = typename PCS::Field;
+  using Commitment = typename PCS::Commitment;
+
+  PCS& pcs = this->pcs_;
+  crypto::SimpleTranscriptWriter<Commitment> writer(
+      (base::Uint8VectorBuffer()));
+  ASSERT_TRUE(writer.WriteToTranscript(F(1)));
+  ASSERT_TRUE(pcs.CreateOpeningProof(this->prover_openings_, &writer));
+  std::vector<uint8_t> proof = writer.buffer().owned_buffer();
+
+  {
+    crypto::SimpleTranscriptReader<Commitment> reader(
+        base::Buffer(proof.data(), proof.size()));
+    ASSERT_TRUE(reader.WriteToTranscript(F(1)));
+    EXPECT_TRUE(pcs.VerifyOpeningProof(this->verifier_openings_, &reader));
+  }
+  {
+    crypto::SimpleTranscriptReader<Commitment> reader(
+        base::Buffer(proof.data(), proof.size()));
+    ASSERT_TRUE(reader.WriteToTranscript(F(1)));
+    crypto::KZGPairingAccumulator<math::bn254::BN254Curve> accumulator;
+    ASSERT_TRUE(pcs.AccumulateOpeningProof(this->verifier_openings_, &reader,
+                                           &accumulator));
+    EXPECT_TRUE(pcs.VerifyAccumulator(accumulator));
+  }
+  {
+    this->verifier_openings_[3].opening += F::One();
+    crypto::SimpleTranscriptReader<Commitment> reader(
+        base::Buffer(proof.data(), proof.size()));
+    ASSERT_TRUE(reader.WriteToTranscript(F(1)));
+    EXPECT_FALSE(pcs.VerifyOpeningProof(this->verifier_openings_, &reader));
+  }
+}
+
+}  // namespace tachyon::zk
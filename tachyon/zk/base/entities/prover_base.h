@@ -10,11 +10,16 @@
 #include <stddef.h>
 
 #include <memory>
+#include <tuple>
 #include <utility>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
+#include "absl/types/span.h"
+
 #include "tachyon/base/logging.h"
 #include "tachyon/crypto/commitments/vector_commitment_scheme_traits_forward.h"
+#include "tachyon/math/polynomials/univariate/univariate_batch_evaluation.h"
 #include "tachyon/zk/base/blinded_polynomial.h"
 #include "tachyon/zk/base/blinder.h"
 #include "tachyon/zk/base/entities/entity.h"
@@ -123,19 +128,43 @@ class ProverBase : public Entity<PCS> {
     return {this->domain_->IFFT(evals), blinder_.Generate()};
   }
 
+  // Returns the evaluation of |poly| at |x|. If it was already evaluated by
+  // |EvaluateAndWriteToProof()| or |BatchEvaluateAndWriteToProof()|, the
+  // memoized value is returned.
+  F Evaluate(const Poly& poly, const F& x) const {
+    auto it = evaluations_.find(GetEvaluationKey(poly, x));
+    if (it != evaluations_.end()) return it->second;
+    return poly.Evaluate(x);
+  }
+
   void EvaluateAndWriteToProof(const Poly& poly, const F& x) {
-    F result = poly.Evaluate(x);
+    F result = Evaluate(poly, x);
+    evaluations_[GetEvaluationKey(poly, x)] = result;
     CHECK(GetWriter()->WriteToProof(result));
   }
 
+  // Evaluates |polys[i]| at |points[i]| all at once and writes the results to
+  // the proof in order.
+  void BatchEvaluateAndWriteToProof(absl::Span<const Poly* const> polys,
+                                    absl::Span<const F> points) {
+    std::vector<F> results = math::BatchEvaluate(polys, points);
+    for (size_t i = 0; i < results.size(); ++i) {
+      evaluations_[GetEvaluationKey(*polys[i], points[i])] = results[i];
+    }
+    CHECK(GetWriter()->BatchWriteToProof(absl::MakeConstSpan(results)));
+  }
+
+  // Forgets the memoized evaluations. This must be called before the
+  // polynomials that were evaluated are destroyed, since the evaluations are
+  // keyed by the address of the coefficients.
+  void ClearEvaluations() { evaluations_.clear(); }
+
   template <typename T = PCS,
             std::enable_if_t<crypto::VectorCommitmentSchemeTraits<
                 T>::kSupportsBatchMode>* = nullptr>
   void RetrieveAndWriteBatchCommitmentsToProof() {
     std::vector<Commitment> commitments = this->pcs_.GetBatchCommitments();
-    for (const Commitment& commitment : commitments) {
-      CHECK(GetWriter()->WriteToProof(commitment));
-    }
+    CHECK(GetWriter()->BatchWriteToProof(absl::MakeConstSpan(commitments)));
   }
 
   template <typename T = PCS,
@@ -143,13 +172,23 @@ class ProverBase : public Entity<PCS> {
                 T>::kSupportsBatchMode>* = nullptr>
   void RetrieveAndWriteBatchCommitmentsToTranscript() {
     std::vector<Commitment> commitments = this->pcs_.GetBatchCommitments();
-    for (const Commitment& commitment : commitments) {
-      CHECK(GetWriter()->WriteToTranscript(commitment));
-    }
+    CHECK(GetWriter()->BatchWriteToTranscript(
+        absl::MakeConstSpan(commitments)));
   }
 
  protected:
+  // NOTE: The address of the coefficients is used instead of the
+  // address of the polynomial, since the polynomials are moved between the
+  // steps of the prover while their coefficients stay in place.
+  using EvaluationKey = std::tuple<const F*, size_t, F>;
+
+  static EvaluationKey GetEvaluationKey(const Poly& poly, const F& x) {
+    const std::vector<F>& coefficients = poly.coefficients().coefficients();
+    return {coefficients.data(), coefficients.size(), x};
+  }
+
   Blinder<PCS> blinder_;
+  absl::flat_hash_map<EvaluationKey, F> evaluations_;
 };
 
 }  // namespace tachyon::zk
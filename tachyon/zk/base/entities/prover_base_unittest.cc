@@ -20,4 +20,23 @@ TEST_F(ProverBaseTest, CommitEvalsWithBlind) {
   EXPECT_EQ(out.poly(), prover_->domain()->IFFT(evals));
 }
 
+TEST_F(ProverBaseTest, BatchEvaluateAndWriteToProof) {
+  Poly a = Poly::Random(5);
+  Poly b = Poly::Random(5);
+  F x = F::Random();
+  F y = F::Random();
+
+  const Poly* polys[] = {&a, &b, &a};
+  const F points[] = {x, x, y};
+  prover_->BatchEvaluateAndWriteToProof(polys, points);
+
+  EXPECT_EQ(prover_->Evaluate(a, x), a.Evaluate(x));
+  EXPECT_EQ(prover_->Evaluate(b, x), b.Evaluate(x));
+  EXPECT_EQ(prover_->Evaluate(a, y), a.Evaluate(y));
+  EXPECT_EQ(prover_->Evaluate(b, y), b.Evaluate(y));
+
+  prover_->ClearEvaluations();
+  EXPECT_EQ(prover_->Evaluate(a, x), a.Evaluate(x));
+}
+
 }  // namespace tachyon::zk
@@ -81,11 +81,13 @@ LookupEvaluated<Poly> LookupArgumentRunner<Poly, Evals>::EvaluateCommitted(
   BlindedPolynomial<Poly> permuted_table_poly =
       std::move(committed).TakePermutedTablePoly();
 
-  prover->EvaluateAndWriteToProof(product_poly.poly(), x);
-  prover->EvaluateAndWriteToProof(product_poly.poly(), x_next);
-  prover->EvaluateAndWriteToProof(permuted_input_poly.poly(), x);
-  prover->EvaluateAndWriteToProof(permuted_input_poly.poly(), x_prev);
-  prover->EvaluateAndWriteToProof(permuted_table_poly.poly(), x);
+  const Poly* polys[] = {
+      &product_poly.poly(),        &product_poly.poly(),
+      &permuted_input_poly.poly(), &permuted_input_poly.poly(),
+      &permuted_table_poly.poly(),
+  };
+  const F points[] = {x, x_next, x, x_prev, x};
+  prover->BatchEvaluateAndWriteToProof(polys, points);
 
   return {
       std::move(permuted_input_poly),
@@ -109,19 +111,21 @@ LookupArgumentRunner<Poly, Evals>::OpenEvaluated(
   return {
       crypto::PolynomialOpening<Poly>(
           base::DeepRef<const Poly>(&evaluated.product_poly().poly()), x_ref,
-          evaluated.product_poly().poly().Evaluate(x)),
+          prover->Evaluate(evaluated.product_poly().poly(), x)),
       crypto::PolynomialOpening<Poly>(
           base::DeepRef<const Poly>(&evaluated.permuted_input_poly().poly()),
-          x_ref, evaluated.permuted_input_poly().poly().Evaluate(x)),
+          x_ref, prover->Evaluate(evaluated.permuted_input_poly().poly(), x)),
       crypto::PolynomialOpening<Poly>(
           base::DeepRef<const Poly>(&evaluated.permuted_table_poly().poly()),
-          x_ref, evaluated.permuted_table_poly().poly().Evaluate(x)),
+          x_ref, prover->Evaluate(evaluated.permuted_table_poly().poly(), x)),
       crypto::PolynomialOpening<Poly>(
           base::DeepRef<const Poly>(&evaluated.permuted_input_poly().poly()),
-          x_prev_ref, evaluated.permuted_input_poly().poly().Evaluate(x_prev)),
+          x_prev_ref,
+          prover->Evaluate(evaluated.permuted_input_poly().poly(), x_prev)),
       crypto::PolynomialOpening<Poly>(
           base::DeepRef<const Poly>(&evaluated.product_poly().poly()),
-          x_next_ref, evaluated.product_poly().poly().Evaluate(x_next))};
+          x_next_ref,
+          prover->Evaluate(evaluated.product_poly().poly(), x_next))};
 }
 
 template <typename Poly, typename Evals>
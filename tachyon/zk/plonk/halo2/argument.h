@@ -84,17 +84,14 @@ class Argument {
 
   // Generate a vector of advice coefficient-formed polynomials with a vector
   // of advice evaluation-formed columns. (a.k.a. Batch IFFT)
-  // And for memory optimization, every evaluations of advice will be released
-  // as soon as transforming it to coefficient form.
+  // And for memory optimization, every evaluations of advice are transformed
+  // to coefficient form in place, reusing their memory.
   void TransformAdvice(const Domain* domain) {
     CHECK(!advice_transformed_);
     advice_polys_vec_ = base::Map(
         advice_columns_vec_, [domain](std::vector<Evals>& advice_columns) {
           return base::Map(advice_columns, [domain](Evals& advice_column) {
-            Poly poly = domain->IFFT(advice_column);
-            // Release advice evals for memory optimization.
-            advice_column = Evals::Zero();
-            return poly;
+            return domain->IFFT(std::move(advice_column));
           });
         });
     // Deallocate evaluations for memory optimization.
@@ -196,6 +193,7 @@ class Argument {
     const ConstraintSystem<F>& cs =
         proving_key.verifying_key().constraint_system();
     std::vector<RefTable<Poly>> tables = ExportPolyTables();
+    prover->ClearEvaluations();
     EvaluateColumns(prover, cs, tables, x);
 
     F xn = x.Pow(prover->pcs().N());
@@ -273,7 +271,7 @@ class Argument {
 
     openings =
         PermutationArgumentRunner<Poly, Evals>::OpenPermutationProvingKey(
-            proving_key.permutation_proving_key(), x);
+            prover, proving_key.permutation_proving_key(), x);
     ret.insert(ret.end(), std::make_move_iterator(openings.begin()),
                std::make_move_iterator(openings.end()));
 
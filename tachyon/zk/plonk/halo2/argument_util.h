@@ -112,14 +112,14 @@ std::vector<PermutationEvaluated<Poly>> BatchEvaluatePermutations(
 }
 
 template <typename PCS, typename Poly, typename F, ColumnType C>
-void EvaluatePolysByQueries(ProverBase<PCS>* prover,
-                            const absl::Span<const Poly> polys,
-                            const std::vector<QueryData<C>>& queries,
-                            const F& x) {
+void CollectPolysByQueries(const ProverBase<PCS>* prover,
+                           const absl::Span<const Poly> polys,
+                           const std::vector<QueryData<C>>& queries,
+                           const F& x, std::vector<const Poly*>* polys_out,
+                           std::vector<F>* points_out) {
   for (const QueryData<C>& query : queries) {
-    const Poly& poly = polys[query.column().index()];
-    prover->EvaluateAndWriteToProof(
-        poly, query.rotation().RotateOmega(prover->domain(), x));
+    polys_out->push_back(&polys[query.column().index()]);
+    points_out->push_back(query.rotation().RotateOmega(prover->domain(), x));
   }
 }
 
@@ -128,19 +128,28 @@ void EvaluateColumns(ProverBase<PCS>* prover,
                      const ConstraintSystem<F>& constraint_system,
                      const std::vector<RefTable<Poly>>& tables, const F& x) {
   size_t num_circuits = tables.size();
+  std::vector<const Poly*> polys;
+  std::vector<F> points;
   if constexpr (PCS::kQueryInstance) {
     for (size_t i = 0; i < num_circuits; ++i) {
-      EvaluatePolysByQueries(prover, tables[i].instance_columns(),
-                             constraint_system.instance_queries(), x);
+      CollectPolysByQueries(prover, tables[i].instance_columns(),
+                            constraint_system.instance_queries(), x, &polys,
+                            &points);
     }
   }
   for (size_t i = 0; i < num_circuits; ++i) {
-    EvaluatePolysByQueries(prover, tables[i].advice_columns(),
-                           constraint_system.advice_queries(), x);
+    CollectPolysByQueries(prover, tables[i].advice_columns(),
+                          constraint_system.advice_queries(), x, &polys,
+                          &points);
   }
 
-  EvaluatePolysByQueries(prover, tables[0].fixed_columns(),
-                         constraint_system.fixed_queries(), x);
+  CollectPolysByQueries(prover, tables[0].fixed_columns(),
+                        constraint_system.fixed_queries(), x, &polys, &points);
+
+  // NOTE: The columns are evaluated at a handful of points, so it
+  // is much cheaper to evaluate them all at once than one by one.
+  prover->BatchEvaluateAndWriteToProof(absl::MakeConstSpan(polys),
+                                       absl::MakeConstSpan(points));
 }
 
 template <typename PCS, typename P, typename L, typename V>
@@ -178,8 +187,9 @@ std::vector<crypto::PolynomialOpening<Poly>> GenerateColumnOpenings(
         const F point = query.rotation().RotateOmega(prover->domain(), x);
         base::DeepRef<const F> point_ref = points.Insert(point);
         const Poly& poly = polys[query.column().index()];
-        return crypto::PolynomialOpening<Poly>(base::DeepRef<const Poly>(&poly),
-                                               point_ref, poly.Evaluate(point));
+        return crypto::PolynomialOpening<Poly>(
+            base::DeepRef<const Poly>(&poly), point_ref,
+            prover->Evaluate(poly, point));
       });
 }
 
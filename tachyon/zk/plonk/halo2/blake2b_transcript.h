@@ -7,14 +7,18 @@
 #ifndef TACHYON_ZK_PLONK_HALO2_BLAKE2B_TRANSCRIPT_H_
 #define TACHYON_ZK_PLONK_HALO2_BLAKE2B_TRANSCRIPT_H_
 
+#include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 
+#include <array>
 #include <utility>
 #include <vector>
 
 #include "absl/types/span.h"
 #include "openssl/blake2.h"
 
+#include "tachyon/base/openmp_util.h"
 #include "tachyon/crypto/transcripts/transcript.h"
 #include "tachyon/math/base/big_int.h"
 #include "tachyon/zk/plonk/halo2/constants.h"
@@ -40,25 +44,38 @@ class Blake2bBase {
   }
 
   bool DoWriteToTranscript(const AffinePoint& point) {
-    DoUpdate(kBlake2bPrefixPoint, 1);
-    if (point.infinity()) {
-      DoUpdate(BaseField::BigIntTy::Zero().ToBytesLE().data(),
-               BaseField::BigIntTy::kByteNums);
-      DoUpdate(typename BaseField::BigIntTy(5).ToBytesLE().data(),
-               BaseField::BigIntTy::kByteNums);
-    } else {
-      DoUpdate(point.x().ToBigInt().ToBytesLE().data(),
-               BaseField::BigIntTy::kByteNums);
-      DoUpdate(point.y().ToBigInt().ToBytesLE().data(),
-               BaseField::BigIntTy::kByteNums);
-    }
+    uint8_t bytes[kPointSize];
+    EncodePoint(point, bytes);
+    DoUpdate(bytes, kPointSize);
     return true;
   }
 
   bool DoWriteToTranscript(const ScalarField& scalar) {
-    DoUpdate(kBlake2bPrefixScalar, 1);
-    DoUpdate(scalar.ToBigInt().ToBytesLE().data(),
-             ScalarField::BigIntTy::kByteNums);
+    uint8_t bytes[kScalarSize];
+    EncodeScalar(scalar, bytes);
+    DoUpdate(bytes, kScalarSize);
+    return true;
+  }
+
+  // Hashes |points| with a single update, which is equivalent to calling
+  // |DoWriteToTranscript()| for every point in order.
+  bool DoBatchWriteToTranscript(absl::Span<const AffinePoint> points) {
+    std::vector<uint8_t> bytes(points.size() * kPointSize);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < points.size(); ++i) {
+      EncodePoint(points[i], &bytes[i * kPointSize]);
+    }
+    DoUpdate(bytes.data(), bytes.size());
+    return true;
+  }
+
+  // Hashes |scalars| with a single update, which is equivalent to calling
+  // |DoWriteToTranscript()| for every scalar in order.
+  bool DoBatchWriteToTranscript(absl::Span<const ScalarField> scalars) {
+    std::vector<uint8_t> bytes(scalars.size() * kScalarSize);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < scalars.size(); ++i) {
+      EncodeScalar(scalars[i], &bytes[i * kScalarSize]);
+    }
+    DoUpdate(bytes.data(), bytes.size());
     return true;
   }
 
@@ -97,6 +114,36 @@ class Blake2bBase {
   }
 
   BLAKE2B_CTX state_;
+
+ private:
+  constexpr static size_t kBaseFieldSize = BaseField::BigIntTy::kByteNums;
+  constexpr static size_t kScalarFieldSize = ScalarField::BigIntTy::kByteNums;
+  // prefix || x || y
+  constexpr static size_t kPointSize = 1 + 2 * kBaseFieldSize;
+  // prefix || scalar
+  constexpr static size_t kScalarSize = 1 + kScalarFieldSize;
+
+  static void EncodePoint(const AffinePoint& point, uint8_t* bytes) {
+    bytes[0] = kBlake2bPrefixPoint[0];
+    if (point.infinity()) {
+      CopyBytes(BaseField::BigIntTy::Zero().ToBytesLE(), &bytes[1]);
+      CopyBytes(typename BaseField::BigIntTy(5).ToBytesLE(),
+                &bytes[1 + kBaseFieldSize]);
+    } else {
+      CopyBytes(point.x().ToBigInt().ToBytesLE(), &bytes[1]);
+      CopyBytes(point.y().ToBigInt().ToBytesLE(), &bytes[1 + kBaseFieldSize]);
+    }
+  }
+
+  static void EncodeScalar(const ScalarField& scalar, uint8_t* bytes) {
+    bytes[0] = kBlake2bPrefixScalar[0];
+    CopyBytes(scalar.ToBigInt().ToBytesLE(), &bytes[1]);
+  }
+
+  template <size_t N>
+  static void CopyBytes(const std::array<uint8_t, N>& src, uint8_t* dst) {
+    memcpy(dst, src.data(), N);
+  }
 };
 
 }  // namespace internal
@@ -125,6 +172,14 @@ class Blake2bReader : public crypto::TranscriptReader<AffinePoint>,
     return this->DoWriteToTranscript(scalar);
   }
 
+  bool BatchWriteToTranscript(absl::Span<const AffinePoint> points) override {
+    return this->DoBatchWriteToTranscript(points);
+  }
+
+  bool BatchWriteToTranscript(absl::Span<const ScalarField> scalars) override {
+    return this->DoBatchWriteToTranscript(scalars);
+  }
+
  private:
   bool DoReadFromProof(AffinePoint* point) const override {
     return ProofSerializer<AffinePoint>::ReadFromProof(this->buffer_, point);
@@ -133,6 +188,16 @@ class Blake2bReader : public crypto::TranscriptReader<AffinePoint>,
   bool DoReadFromProof(ScalarField* scalar) const override {
     return ProofSerializer<ScalarField>::ReadFromProof(this->buffer_, scalar);
   }
+
+  bool DoBatchReadFromProof(absl::Span<AffinePoint> points) const override {
+    return ProofSerializer<AffinePoint>::BatchReadFromProof(this->buffer_,
+                                                            points);
+  }
+
+  bool DoBatchReadFromProof(absl::Span<ScalarField> scalars) const override {
+    return ProofSerializer<ScalarField>::BatchReadFromProof(this->buffer_,
+                                                            scalars);
+  }
 };
 
 template <typename AffinePoint>
@@ -166,6 +231,14 @@ class Blake2bWriter : public crypto::TranscriptWriter<AffinePoint>,
     return this->DoWriteToTranscript(scalar);
   }
 
+  bool BatchWriteToTranscript(absl::Span<const AffinePoint> points) override {
+    return this->DoBatchWriteToTranscript(points);
+  }
+
+  bool BatchWriteToTranscript(absl::Span<const ScalarField> scalars) override {
+    return this->DoBatchWriteToTranscript(scalars);
+  }
+
  private:
   bool DoWriteToProof(const AffinePoint& point) override {
     return ProofSerializer<AffinePoint>::WriteToProof(point, this->buffer_);
@@ -174,6 +247,16 @@ class Blake2bWriter : public crypto::TranscriptWriter<AffinePoint>,
   bool DoWriteToProof(const ScalarField& scalar) override {
     return ProofSerializer<ScalarField>::WriteToProof(scalar, this->buffer_);
   }
+
+  bool DoBatchWriteToProof(absl::Span<const AffinePoint> points) override {
+    return ProofSerializer<AffinePoint>::BatchWriteToProof(points,
+                                                           this->buffer_);
+  }
+
+  bool DoBatchWriteToProof(absl::Span<const ScalarField> scalars) override {
+    return ProofSerializer<ScalarField>::BatchWriteToProof(scalars,
+                                                           this->buffer_);
+  }
 };
 
 }  // namespace tachyon::zk::halo2
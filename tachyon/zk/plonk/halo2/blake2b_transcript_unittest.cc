@@ -11,6 +11,8 @@
 
 #include "gtest/gtest.h"
 
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/crypto/commitments/ipa/ipa.h"
 #include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
 
 namespace tachyon::zk::halo2 {
@@ -54,6 +56,42 @@ TEST_F(Blake2bTranscriptTest, WriteScalar) {
   EXPECT_EQ(expected, actual);
 }
 
+TEST_F(Blake2bTranscriptTest, BatchWrite) {
+  std::vector<G1AffinePoint> points =
+      base::CreateVector(5, []() { return G1AffinePoint::Random(); });
+  points[1] = G1AffinePoint::Zero();
+  std::vector<Fr> scalars =
+      base::CreateVector(7, []() { return Fr::Random(); });
+
+  Blake2bWriter<G1AffinePoint> expected_writer((base::Uint8VectorBuffer()));
+  for (const G1AffinePoint& point : points) {
+    ASSERT_TRUE(expected_writer.WriteToProof(point));
+  }
+  for (const Fr& scalar : scalars) {
+    ASSERT_TRUE(expected_writer.WriteToProof(scalar));
+  }
+
+  Blake2bWriter<G1AffinePoint> writer((base::Uint8VectorBuffer()));
+  ASSERT_TRUE(writer.BatchWriteToProof(absl::MakeConstSpan(points)));
+  ASSERT_TRUE(writer.BatchWriteToProof(absl::MakeConstSpan(scalars)));
+
+  EXPECT_EQ(writer.buffer().owned_buffer(),
+            expected_writer.buffer().owned_buffer());
+  Fr expected_challenge = expected_writer.SqueezeChallenge();
+  EXPECT_EQ(writer.SqueezeChallenge(), expected_challenge);
+
+  base::Buffer read_buf(writer.buffer().buffer(), writer.buffer().buffer_len());
+  Blake2bReader<G1AffinePoint> reader(std::move(read_buf));
+  std::vector<G1AffinePoint> actual_points(points.size());
+  ASSERT_TRUE(reader.BatchReadFromProof(absl::MakeSpan(actual_points)));
+  std::vector<Fr> actual_scalars(scalars.size());
+  ASSERT_TRUE(reader.BatchReadFromProof(absl::MakeSpan(actual_scalars)));
+
+  EXPECT_EQ(actual_points, points);
+  EXPECT_EQ(actual_scalars, scalars);
+  EXPECT_EQ(reader.SqueezeChallenge(), expected_challenge);
+}
+
 TEST_F(Blake2bTranscriptTest, SqueezeChallenge) {
   base::Uint8VectorBuffer write_buf;
   Blake2bWriter<G1AffinePoint> writer(std::move(write_buf));
@@ -71,4 +109,66 @@ TEST_F(Blake2bTranscriptTest, SqueezeChallenge) {
   EXPECT_EQ(expected, actual);
 }
 
+TEST_F(Blake2bTranscriptTest, IPAOpeningProof) {
+  constexpr size_t K = 3;
+  constexpr size_t N = size_t{1} << K;
+  constexpr size_t kMaxDegree = N - 1;
+
+  using PCS = crypto::IPA<G1AffinePoint, kMaxDegree, G1AffinePoint>;
+  using Poly = PCS::Poly;
+  using PolyRef = base::DeepRef<const Poly>;
+  using PointRef = base::DeepRef<const Fr>;
+  using CommitmentRef = base::DeepRef<const G1AffinePoint>;
+
+  PCS pcs;
+  ASSERT_TRUE(pcs.Setup(N));
+
+  std::vector<Poly> polys =
+      base::CreateVector(4, []() { return Poly::Random(kMaxDegree); });
+  std::vector<Fr> points = {Fr(1), Fr(2), Fr(3)};
+  std::vector<G1AffinePoint> commitments(polys.size());
+  for (size_t i = 0; i < polys.size(); ++i) {
+    ASSERT_TRUE(pcs.Commit(polys[i], &commitments[i]));
+  }
+
+  std::vector<crypto::PolynomialOpening<Poly>> prover_openings;
+  std::vector<crypto::PolynomialOpening<Poly, G1AffinePoint>>
+      verifier_openings;
+  // {P₀, [x₀, x₁]}, {P₁, [x₁, x₀]}, {P₂, [x₂]}, {P₃, [x₁]}
+  std::vector<std::pair<size_t, size_t>> queries = {
+      {0, 0}, {0, 1}, {1, 1}, {1, 0}, {2, 2}, {3, 1}};
+  for (const auto& [poly_idx, point_idx] : queries) {
+    Fr opening = polys[poly_idx].Evaluate(points[point_idx]);
+    prover_openings.emplace_back(PolyRef(&polys[poly_idx]),
+                                 PointRef(&points[point_idx]), opening);
+    verifier_openings.emplace_back(CommitmentRef(&commitments[poly_idx]),
+                                   PointRef(&points[point_idx]), opening);
+  }
+
+  Blake2bWriter<G1AffinePoint> writer((base::Uint8VectorBuffer()));
+  ASSERT_TRUE(pcs.CreateOpeningProof(prover_openings, &writer));
+  std::vector<uint8_t> proof = writer.buffer().owned_buffer();
+
+  // q', the 3 evaluations qᵢ(x₃), S, the K pairs of L and R, c and f, each
+  // of which is 32 bytes.
+  constexpr size_t kElementSize = 32;
+  ASSERT_EQ(proof.size(), (1 + 3 + 1 + 2 * K + 2) * kElementSize);
+
+  {
+    Blake2bReader<G1AffinePoint> reader(
+        base::Buffer(proof.data(), proof.size()));
+    EXPECT_TRUE(pcs.VerifyOpeningProof(verifier_openings, &reader));
+  }
+
+  // Flips a bit of S, the first L, the last R, c and f.
+  for (size_t i : {size_t{4}, size_t{5}, 4 + 2 * K, 5 + 2 * K, 6 + 2 * K}) {
+    SCOPED_TRACE(i);
+    std::vector<uint8_t> tampered_proof = proof;
+    tampered_proof[i * kElementSize] ^= 1;
+    Blake2bReader<G1AffinePoint> reader(
+        base::Buffer(tampered_proof.data(), tampered_proof.size()));
+    EXPECT_FALSE(pcs.VerifyOpeningProof(verifier_openings, &reader));
+  }
+}
+
 }  // namespace tachyon::zk::halo2
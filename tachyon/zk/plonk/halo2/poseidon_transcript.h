@@ -7,9 +7,15 @@
 #ifndef TACHYON_ZK_PLONK_HALO2_POSEIDON_TRANSCRIPT_H_
 #define TACHYON_ZK_PLONK_HALO2_POSEIDON_TRANSCRIPT_H_
 
+#include <stddef.h>
+
 #include <array>
 #include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
 
+#include "tachyon/base/openmp_util.h"
 #include "tachyon/crypto/transcripts/transcript.h"
 #include "tachyon/zk/plonk/halo2/poseidon_sponge.h"
 #include "tachyon/zk/plonk/halo2/proof_serializer.h"
@@ -42,6 +48,24 @@ class PoseidonBase {
     return state_.Absorb(scalar);
   }
 
+  // Absorbs |points| at once, which is equivalent to calling
+  // |DoWriteToTranscript()| for every point in order.
+  bool DoBatchWriteToTranscript(absl::Span<const AffinePoint> points) {
+    std::vector<ScalarField> coords(2 * points.size());
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < points.size(); ++i) {
+      coords[2 * i] = CurveConfig::BaseToScalar(points[i].x());
+      coords[2 * i + 1] = CurveConfig::BaseToScalar(points[i].y());
+    }
+    return state_.Absorb(coords);
+  }
+
+  // Absorbs |scalars| at once, which is equivalent to calling
+  // |DoWriteToTranscript()| for every scalar in order.
+  bool DoBatchWriteToTranscript(absl::Span<const ScalarField> scalars) {
+    return state_.Absorb(
+        std::vector<ScalarField>(scalars.begin(), scalars.end()));
+  }
+
   // TODO(chokobole): Implement DoUpdate() and DoFinalize() like
   // |Blake2bTranscript| or |Sha256Transcript|.
 
@@ -71,6 +95,14 @@ class PoseidonReader : public crypto::TranscriptReader<AffinePoint>,
     return this->DoWriteToTranscript(scalar);
   }
 
+  bool BatchWriteToTranscript(absl::Span<const AffinePoint> points) override {
+    return this->DoBatchWriteToTranscript(points);
+  }
+
+  bool BatchWriteToTranscript(absl::Span<const ScalarField> scalars) override {
+    return this->DoBatchWriteToTranscript(scalars);
+  }
+
  private:
   bool DoReadFromProof(AffinePoint* point) const override {
     return ProofSerializer<AffinePoint>::ReadFromProof(this->buffer_, point);
@@ -79,6 +111,16 @@ class PoseidonReader : public crypto::TranscriptReader<AffinePoint>,
   bool DoReadFromProof(ScalarField* scalar) const override {
     return ProofSerializer<ScalarField>::ReadFromProof(this->buffer_, scalar);
   }
+
+  bool DoBatchReadFromProof(absl::Span<AffinePoint> points) const override {
+    return ProofSerializer<AffinePoint>::BatchReadFromProof(this->buffer_,
+                                                            points);
+  }
+
+  bool DoBatchReadFromProof(absl::Span<ScalarField> scalars) const override {
+    return ProofSerializer<ScalarField>::BatchReadFromProof(this->buffer_,
+                                                            scalars);
+  }
 };
 
 template <typename AffinePoint>
@@ -102,6 +144,14 @@ class PoseidonWriter : public crypto::TranscriptWriter<AffinePoint>,
     return this->DoWriteToTranscript(scalar);
   }
 
+  bool BatchWriteToTranscript(absl::Span<const AffinePoint> points) override {
+    return this->DoBatchWriteToTranscript(points);
+  }
+
+  bool BatchWriteToTranscript(absl::Span<const ScalarField> scalars) override {
+    return this->DoBatchWriteToTranscript(scalars);
+  }
+
  private:
   bool DoWriteToProof(const AffinePoint& point) override {
     return ProofSerializer<AffinePoint>::WriteToProof(point, this->buffer_);
@@ -110,6 +160,16 @@ class PoseidonWriter : public crypto::TranscriptWriter<AffinePoint>,
   bool DoWriteToProof(const ScalarField& scalar) override {
     return ProofSerializer<ScalarField>::WriteToProof(scalar, this->buffer_);
   }
+
+  bool DoBatchWriteToProof(absl::Span<const AffinePoint> points) override {
+    return ProofSerializer<AffinePoint>::BatchWriteToProof(points,
+                                                           this->buffer_);
+  }
+
+  bool DoBatchWriteToProof(absl::Span<const ScalarField> scalars) override {
+    return ProofSerializer<ScalarField>::BatchWriteToProof(scalars,
+                                                           this->buffer_);
+  }
 };
 
 }  // namespace tachyon::zk::halo2
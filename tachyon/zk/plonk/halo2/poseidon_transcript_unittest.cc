@@ -11,6 +11,7 @@
 
 #include "gtest/gtest.h"
 
+#include "tachyon/base/containers/container_util.h"
 #include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
 
 namespace tachyon::zk::halo2 {
@@ -54,6 +55,42 @@ TEST_F(PoseidonTranscriptTest, WriteScalar) {
   EXPECT_EQ(expected, actual);
 }
 
+TEST_F(PoseidonTranscriptTest, BatchWrite) {
+  std::vector<G1AffinePoint> points =
+      base::CreateVector(5, []() { return G1AffinePoint::Random(); });
+  points[1] = G1AffinePoint::Zero();
+  std::vector<Fr> scalars =
+      base::CreateVector(7, []() { return Fr::Random(); });
+
+  PoseidonWriter<G1AffinePoint> expected_writer((base::Uint8VectorBuffer()));
+  for (const G1AffinePoint& point : points) {
+    ASSERT_TRUE(expected_writer.WriteToProof(point));
+  }
+  for (const Fr& scalar : scalars) {
+    ASSERT_TRUE(expected_writer.WriteToProof(scalar));
+  }
+
+  PoseidonWriter<G1AffinePoint> writer((base::Uint8VectorBuffer()));
+  ASSERT_TRUE(writer.BatchWriteToProof(absl::MakeConstSpan(points)));
+  ASSERT_TRUE(writer.BatchWriteToProof(absl::MakeConstSpan(scalars)));
+
+  EXPECT_EQ(writer.buffer().owned_buffer(),
+            expected_writer.buffer().owned_buffer());
+  Fr expected_challenge = expected_writer.SqueezeChallenge();
+  EXPECT_EQ(writer.SqueezeChallenge(), expected_challenge);
+
+  base::Buffer read_buf(writer.buffer().buffer(), writer.buffer().buffer_len());
+  PoseidonReader<G1AffinePoint> reader(std::move(read_buf));
+  std::vector<G1AffinePoint> actual_points(points.size());
+  ASSERT_TRUE(reader.BatchReadFromProof(absl::MakeSpan(actual_points)));
+  std::vector<Fr> actual_scalars(scalars.size());
+  ASSERT_TRUE(reader.BatchReadFromProof(absl::MakeSpan(actual_scalars)));
+
+  EXPECT_EQ(actual_points, points);
+  EXPECT_EQ(actual_scalars, scalars);
+  EXPECT_EQ(reader.SqueezeChallenge(), expected_challenge);
+}
+
 TEST_F(PoseidonTranscriptTest, SqueezeChallenge) {
   base::Uint8VectorBuffer write_buf;
   PoseidonWriter<G1AffinePoint> writer(std::move(write_buf));
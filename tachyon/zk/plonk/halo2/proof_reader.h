@@ -4,6 +4,8 @@
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "tachyon/base/logging.h"
 #include "tachyon/crypto/transcripts/transcript.h"
 #include "tachyon/zk/plonk/halo2/proof.h"
@@ -250,7 +252,9 @@ class ProofReader {
 
   template <typename T>
   std::vector<T> ReadMany(size_t n) {
-    return base::CreateVector(n, [this]() { return Read<T>(); });
+    std::vector<T> values(n);
+    CHECK(transcript_->BatchReadFromProof(absl::MakeSpan(values)));
+    return values;
   }
 
   const VerifyingKey<PCS>& verifying_key_;
@@ -7,10 +7,22 @@
 #ifndef TACHYON_ZK_PLONK_HALO2_PROOF_SERIALIZER_H_
 #define TACHYON_ZK_PLONK_HALO2_PROOF_SERIALIZER_H_
 
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <array>
+#include <atomic>
+#include <optional>
 #include <type_traits>
 #include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
 
 #include "tachyon/base/buffer/buffer.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/build/build_config.h"
 #include "tachyon/math/elliptic_curves/affine_point.h"
 #include "tachyon/math/finite_fields/prime_field_base.h"
 
@@ -23,6 +35,10 @@ template <typename F>
 class ProofSerializer<
     F, std::enable_if_t<std::is_base_of_v<math::PrimeFieldBase<F>, F>>> {
  public:
+  using BigInt = typename F::BigIntTy;
+
+  static_assert(sizeof(BigInt) == BigInt::kLimbNums * sizeof(uint64_t));
+
   [[nodiscard]] static bool ReadFromProof(const base::Buffer& buffer,
                                           F* scalar) {
     return buffer.Read(scalar);
@@ -32,6 +48,62 @@ class ProofSerializer<
                                          base::Buffer& buffer) {
     return buffer.Write(scalar);
   }
+
+  // Reads |scalars| from |buffer| at once, which is equivalent to calling
+  // |ReadFromProof()| for every scalar in order.
+  [[nodiscard]] static bool BatchReadFromProof(const base::Buffer& buffer,
+                                               absl::Span<F> scalars) {
+    std::vector<BigInt> bigints(scalars.size());
+    if (IsLimbOrderNative(buffer)) {
+      if (!buffer.Read(reinterpret_cast<uint8_t*>(bigints.data()),
+                       bigints.size() * sizeof(BigInt))) {
+        return false;
+      }
+    } else {
+      for (BigInt& bigint : bigints) {
+        if (!buffer.Read(&bigint)) return false;
+      }
+    }
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < scalars.size(); ++i) {
+      scalars[i] = F::FromBigInt(bigints[i]);
+    }
+    return true;
+  }
+
+  // Writes |scalars| to |buffer| at once, which is equivalent to calling
+  // |WriteToProof()| for every scalar in order. The scalars are converted out
+  // of the montgomery form in parallel and the buffer grows only once.
+  [[nodiscard]] static bool BatchWriteToProof(absl::Span<const F> scalars,
+                                              base::Buffer& buffer) {
+    std::vector<BigInt> bigints(scalars.size());
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < scalars.size(); ++i) {
+      bigints[i] = scalars[i].ToBigInt();
+    }
+    if (IsLimbOrderNative(buffer)) {
+      return buffer.Write(reinterpret_cast<const uint8_t*>(bigints.data()),
+                          bigints.size() * sizeof(BigInt));
+    }
+    size_t size_needed =
+        buffer.buffer_offset() + bigints.size() * sizeof(BigInt);
+    if (size_needed > buffer.buffer_len() && !buffer.Grow(size_needed)) {
+      return false;
+    }
+    for (const BigInt& bigint : bigints) {
+      if (!buffer.Write(bigint)) return false;
+    }
+    return true;
+  }
+
+ private:
+  // Returns true if the limbs are serialized as they are laid out in memory,
+  // so that the |BigInt|s can be copied from or to |buffer| at once.
+  static bool IsLimbOrderNative(const base::Buffer& buffer) {
+#if ARCH_CPU_LITTLE_ENDIAN
+    return buffer.endian() != base::Endian::kBig;
+#else
+    return buffer.endian() != base::Endian::kLittle;
+#endif
+  }
 };
 
 template <typename Curve>
@@ -49,35 +121,73 @@ class ProofSerializer<math::AffinePoint<Curve>> {
                                           math::AffinePoint<Curve>* point_out) {
     uint8_t bytes[kByteSize];
     if (!buffer.Read(bytes)) return false;
-    uint8_t is_odd = bytes[kByteSize - 1] >> 7;
-    bytes[kByteSize - 1] &= 0b01111111;
-    BaseField x = BaseField::FromBigInt(BigInt::FromBytesLE(bytes));
-    if (x.IsZero()) {
-      *point_out = math::AffinePoint<Curve>::Zero();
-      return true;
-    } else {
-      std::optional<math::AffinePoint<Curve>> point =
-          math::AffinePoint<Curve>::CreateFromX(x, is_odd);
-      if (!point.has_value()) return false;
-      *point_out = std::move(point).value();
-      return true;
-    }
+    return Decompress(bytes, point_out);
   }
 
   [[nodiscard]] static bool WriteToProof(const math::AffinePoint<Curve>& point,
                                          base::Buffer& buffer) {
+    uint8_t bytes[kByteSize];
+    Compress(point, bytes);
+    return buffer.Write(bytes);
+  }
+
+  // Reads |points| from |buffer| at once, which is equivalent to calling
+  // |ReadFromProof()| for every point in order. The points are decompressed
+  // in parallel.
+  [[nodiscard]] static bool BatchReadFromProof(
+      const base::Buffer& buffer, absl::Span<math::AffinePoint<Curve>> points) {
+    std::vector<uint8_t> bytes(points.size() * kByteSize);
+    if (!buffer.Read(bytes.data(), bytes.size())) return false;
+    std::atomic<bool> decompressed = true;
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < points.size(); ++i) {
+      if (!Decompress(&bytes[i * kByteSize], &points[i])) {
+        decompressed.store(false, std::memory_order_relaxed);
+      }
+    }
+    return decompressed.load();
+  }
+
+  // Writes |points| to |buffer| at once, which is equivalent to calling
+  // |WriteToProof()| for every point in order. The points are compressed in
+  // parallel and the buffer grows only once.
+  [[nodiscard]] static bool BatchWriteToProof(
+      absl::Span<const math::AffinePoint<Curve>> points, base::Buffer& buffer) {
+    std::vector<uint8_t> bytes(points.size() * kByteSize);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < points.size(); ++i) {
+      Compress(points[i], &bytes[i * kByteSize]);
+    }
+    return buffer.Write(bytes.data(), bytes.size());
+  }
+
+ private:
+  // Writes x in little endian to |bytes| and puts the parity of y into the
+  // most significant bit. The point at infinity is written as zeros.
+  static void Compress(const math::AffinePoint<Curve>& point, uint8_t* bytes) {
     if (point.infinity()) {
-      constexpr uint8_t kZeroBytes[kByteSize] = {
-          0,
-      };
-      return buffer.Write(kZeroBytes);
-    } else {
-      uint8_t is_odd = uint8_t{point.y().ToBigInt().IsOdd()} << 7;
-      std::array<uint8_t, kByteSize> x = point.x().ToBigInt().ToBytesLE();
-      if (!buffer.Write(x)) return false;
-      return buffer.WriteAt(buffer.buffer_offset() - 1,
-                            static_cast<uint8_t>(x[kByteSize - 1] | is_odd));
+      memset(bytes, 0, kByteSize);
+      return;
+    }
+    std::array<uint8_t, kByteSize> x = point.x().ToBigInt().ToBytesLE();
+    memcpy(bytes, x.data(), kByteSize);
+    bytes[kByteSize - 1] |= uint8_t{point.y().ToBigInt().IsOdd()} << 7;
+  }
+
+  static bool Decompress(const uint8_t* bytes,
+                         math::AffinePoint<Curve>* point_out) {
+    uint8_t x_bytes[kByteSize];
+    memcpy(x_bytes, bytes, kByteSize);
+    uint8_t is_odd = x_bytes[kByteSize - 1] >> 7;
+    x_bytes[kByteSize - 1] &= 0b01111111;
+    BaseField x = BaseField::FromBigInt(BigInt::FromBytesLE(x_bytes));
+    if (x.IsZero()) {
+      *point_out = math::AffinePoint<Curve>::Zero();
+      return true;
     }
+    std::optional<math::AffinePoint<Curve>> point =
+        math::AffinePoint<Curve>::CreateFromX(x, is_odd);
+    if (!point.has_value()) return false;
+    *point_out = std::move(point).value();
+    return true;
   }
 };
 
@@ -12,6 +12,7 @@
 #include "gtest/gtest.h"
 
 #include "tachyon/base/buffer/vector_buffer.h"
+#include "tachyon/base/containers/container_util.h"
 #include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
 
 namespace tachyon::zk::halo2 {
@@ -95,4 +96,58 @@ TEST_F(ProofSerializerTest, SerializeProof) {
   }
 }
 
+TEST_F(ProofSerializerTest, BatchSerializeScalars) {
+  std::vector<Fr> expected =
+      base::CreateVector(10, []() { return Fr::Random(); });
+
+  for (base::Endian endian :
+       {base::Endian::kNative, base::Endian::kLittle, base::Endian::kBig}) {
+    base::Uint8VectorBuffer expected_buf;
+    expected_buf.set_endian(endian);
+    for (const Fr& scalar : expected) {
+      ASSERT_TRUE(ProofSerializer<Fr>::WriteToProof(scalar, expected_buf));
+    }
+
+    base::Uint8VectorBuffer write_buf;
+    write_buf.set_endian(endian);
+    ASSERT_TRUE(ProofSerializer<Fr>::BatchWriteToProof(
+        absl::MakeConstSpan(expected), write_buf));
+    EXPECT_EQ(write_buf.owned_buffer(), expected_buf.owned_buffer());
+
+    write_buf.set_buffer_offset(0);
+    std::vector<Fr> actual(expected.size());
+    ASSERT_TRUE(ProofSerializer<Fr>::BatchReadFromProof(
+        write_buf, absl::MakeSpan(actual)));
+    EXPECT_EQ(actual, expected);
+
+    std::vector<Fr> too_many(expected.size() + 1);
+    write_buf.set_buffer_offset(0);
+    EXPECT_FALSE(ProofSerializer<Fr>::BatchReadFromProof(
+        write_buf, absl::MakeSpan(too_many)));
+  }
+}
+
+TEST_F(ProofSerializerTest, BatchSerializePoints) {
+  std::vector<G1AffinePoint> expected =
+      base::CreateVector(10, []() { return G1AffinePoint::Random(); });
+  expected[3] = G1AffinePoint::Zero();
+
+  base::Uint8VectorBuffer expected_buf;
+  for (const G1AffinePoint& point : expected) {
+    ASSERT_TRUE(
+        ProofSerializer<G1AffinePoint>::WriteToProof(point, expected_buf));
+  }
+
+  base::Uint8VectorBuffer write_buf;
+  ASSERT_TRUE(ProofSerializer<G1AffinePoint>::BatchWriteToProof(
+      absl::MakeConstSpan(expected), write_buf));
+  EXPECT_EQ(write_buf.owned_buffer(), expected_buf.owned_buffer());
+
+  write_buf.set_buffer_offset(0);
+  std::vector<G1AffinePoint> actual(expected.size());
+  ASSERT_TRUE(ProofSerializer<G1AffinePoint>::BatchReadFromProof(
+      write_buf, absl::MakeSpan(actual)));
+  EXPECT_EQ(actual, expected);
+}
+
 }  // namespace tachyon::zk::halo2
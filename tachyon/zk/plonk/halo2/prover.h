@@ -146,7 +146,8 @@ class Prover : public ProverBase<PCS> {
         this, proving_key, committed_result, beta, gamma, theta, y);
     VanishingConstructed<PCS> constructed_vanishing;
     CHECK(CommitFinalHPoly(this, std::move(committed_result).TakeVanishing(),
-                           proving_key.verifying_key(), circuit_column,
+                           proving_key.verifying_key(),
+                           std::move(circuit_column),
                            &constructed_vanishing));
 
     F x = writer->SqueezeChallenge();
@@ -160,6 +161,7 @@ class Prover : public ProverBase<PCS> {
         argument.ConstructOpenings(this, proving_key, evaluated_result, x);
 
     CHECK(this->pcs_.CreateOpeningProof(openings, this->GetWriter()));
+    this->ClearEvaluations();
   }
 
   std::unique_ptr<crypto::XORShiftRNG> rng_;
@@ -7,10 +7,19 @@
 #ifndef TACHYON_ZK_PLONK_HALO2_SHA256_TRANSCRIPT_H_
 #define TACHYON_ZK_PLONK_HALO2_SHA256_TRANSCRIPT_H_
 
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <array>
+#include <iterator>
 #include <utility>
+#include <vector>
 
+#include "absl/types/span.h"
 #include "openssl/sha.h"
 
+#include "tachyon/base/openmp_util.h"
 #include "tachyon/base/types/always_false.h"
 #include "tachyon/crypto/transcripts/transcript.h"
 #include "tachyon/math/base/big_int.h"
@@ -37,28 +46,50 @@ class Sha256Base {
     DoUpdate(result, 32);
 
     if constexpr (ScalarField::N <= 4) {
+      // The digest may not be less than the modulus. Like halo2's
+      // |from_uniform_bytes()|, it is zero-extended to 64 bytes and reduced.
+      uint8_t uniform_bytes[64] = {0};
+      memcpy(uniform_bytes, result, 32);
       return ScalarField::FromAnySizedBigInt(
-          math::BigInt<4>::FromBytesLE(result));
+          math::BigInt<8>::FromBytesLE(uniform_bytes));
     } else {
       base::AlwaysFalse<AffinePoint>();
     }
   }
 
   bool DoWriteToTranscript(const AffinePoint& point) {
-    DoUpdate(kShaPrefixZeros, 31);
-    DoUpdate(kShaPrefixPoint, 1);
-    DoUpdate(point.x().ToBigInt().ToBytesBE().data(),
-             BaseField::BigIntTy::kByteNums);
-    DoUpdate(point.y().ToBigInt().ToBytesBE().data(),
-             BaseField::BigIntTy::kByteNums);
+    uint8_t bytes[kPointSize];
+    EncodePoint(point, bytes);
+    DoUpdate(bytes, kPointSize);
     return true;
   }
 
   bool DoWriteToTranscript(const ScalarField& scalar) {
-    DoUpdate(kShaPrefixZeros, 31);
-    DoUpdate(kShaPrefixScalar, 1);
-    DoUpdate(scalar.ToBigInt().ToBytesBE().data(),
-             ScalarField::BigIntTy::kByteNums);
+    uint8_t bytes[kScalarSize];
+    EncodeScalar(scalar, bytes);
+    DoUpdate(bytes, kScalarSize);
+    return true;
+  }
+
+  // Hashes |points| with a single update, which is equivalent to calling
+  // |DoWriteToTranscript()| for every point in order.
+  bool DoBatchWriteToTranscript(absl::Span<const AffinePoint> points) {
+    std::vector<uint8_t> bytes(points.size() * kPointSize);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < points.size(); ++i) {
+      EncodePoint(points[i], &bytes[i * kPointSize]);
+    }
+    DoUpdate(bytes.data(), bytes.size());
+    return true;
+  }
+
+  // Hashes |scalars| with a single update, which is equivalent to calling
+  // |DoWriteToTranscript()| for every scalar in order.
+  bool DoBatchWriteToTranscript(absl::Span<const ScalarField> scalars) {
+    std::vector<uint8_t> bytes(scalars.size() * kScalarSize);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < scalars.size(); ++i) {
+      EncodeScalar(scalars[i], &bytes[i * kScalarSize]);
+    }
+    DoUpdate(bytes.data(), bytes.size());
     return true;
   }
 
@@ -74,6 +105,34 @@ class Sha256Base {
   }
 
   SHA256_CTX state_;
+
+ private:
+  constexpr static size_t kPrefixSize = std::size(kShaPrefixZeros) + 1;
+  constexpr static size_t kBaseFieldSize = BaseField::BigIntTy::kByteNums;
+  constexpr static size_t kScalarFieldSize = ScalarField::BigIntTy::kByteNums;
+  // zeros || prefix || x || y
+  constexpr static size_t kPointSize = kPrefixSize + 2 * kBaseFieldSize;
+  // zeros || prefix || scalar
+  constexpr static size_t kScalarSize = kPrefixSize + kScalarFieldSize;
+
+  static void EncodePoint(const AffinePoint& point, uint8_t* bytes) {
+    memcpy(bytes, kShaPrefixZeros, std::size(kShaPrefixZeros));
+    bytes[kPrefixSize - 1] = kShaPrefixPoint[0];
+    CopyBytes(point.x().ToBigInt().ToBytesBE(), &bytes[kPrefixSize]);
+    CopyBytes(point.y().ToBigInt().ToBytesBE(),
+              &bytes[kPrefixSize + kBaseFieldSize]);
+  }
+
+  static void EncodeScalar(const ScalarField& scalar, uint8_t* bytes) {
+    memcpy(bytes, kShaPrefixZeros, std::size(kShaPrefixZeros));
+    bytes[kPrefixSize - 1] = kShaPrefixScalar[0];
+    CopyBytes(scalar.ToBigInt().ToBytesBE(), &bytes[kPrefixSize]);
+  }
+
+  template <size_t N>
+  static void CopyBytes(const std::array<uint8_t, N>& src, uint8_t* dst) {
+    memcpy(dst, src.data(), N);
+  }
 };
 
 }  // namespace internal
@@ -105,6 +164,14 @@ class Sha256Reader : public crypto::TranscriptReader<AffinePoint>,
     return this->DoWriteToTranscript(scalar);
   }
 
+  bool BatchWriteToTranscript(absl::Span<const AffinePoint> points) override {
+    return this->DoBatchWriteToTranscript(points);
+  }
+
+  bool BatchWriteToTranscript(absl::Span<const ScalarField> scalars) override {
+    return this->DoBatchWriteToTranscript(scalars);
+  }
+
  private:
   bool DoReadFromProof(AffinePoint* point) const override {
     return ProofSerializer<AffinePoint>::ReadFromProof(this->buffer_, point);
@@ -113,6 +180,16 @@ class Sha256Reader : public crypto::TranscriptReader<AffinePoint>,
   bool DoReadFromProof(ScalarField* scalar) const override {
     return ProofSerializer<ScalarField>::ReadFromProof(this->buffer_, scalar);
   }
+
+  bool DoBatchReadFromProof(absl::Span<AffinePoint> points) const override {
+    return ProofSerializer<AffinePoint>::BatchReadFromProof(this->buffer_,
+                                                            points);
+  }
+
+  bool DoBatchReadFromProof(absl::Span<ScalarField> scalars) const override {
+    return ProofSerializer<ScalarField>::BatchReadFromProof(this->buffer_,
+                                                            scalars);
+  }
 };
 
 template <typename AffinePoint>
@@ -144,6 +221,14 @@ class Sha256Writer : public crypto::TranscriptWriter<AffinePoint>,
     return this->DoWriteToTranscript(scalar);
   }
 
+  bool BatchWriteToTranscript(absl::Span<const AffinePoint> points) override {
+    return this->DoBatchWriteToTranscript(points);
+  }
+
+  bool BatchWriteToTranscript(absl::Span<const ScalarField> scalars) override {
+    return this->DoBatchWriteToTranscript(scalars);
+  }
+
  private:
   bool DoWriteToProof(const AffinePoint& point) override {
     return ProofSerializer<AffinePoint>::WriteToProof(point, this->buffer_);
@@ -153,6 +238,16 @@ class Sha256Writer : public crypto::TranscriptWriter<AffinePoint>,
     return ProofSerializer<ScalarField>::WriteToProof(scalar, this->buffer_);
   }
 
+  bool DoBatchWriteToProof(absl::Span<const AffinePoint> points) override {
+    return ProofSerializer<AffinePoint>::BatchWriteToProof(points,
+                                                           this->buffer_);
+  }
+
+  bool DoBatchWriteToProof(absl::Span<const ScalarField> scalars) override {
+    return ProofSerializer<ScalarField>::BatchWriteToProof(scalars,
+                                                           this->buffer_);
+  }
+
   SHA256_CTX state_;
 };
 
@@ -11,6 +11,7 @@
 
 #include "gtest/gtest.h"
 
+#include "tachyon/base/containers/container_util.h"
 #include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
 
 namespace tachyon::zk::halo2 {
@@ -54,6 +55,42 @@ TEST_F(Sha256TranscriptTest, WriteScalar) {
   EXPECT_EQ(expected, actual);
 }
 
+TEST_F(Sha256TranscriptTest, BatchWrite) {
+  std::vector<G1AffinePoint> points =
+      base::CreateVector(5, []() { return G1AffinePoint::Random(); });
+  points[1] = G1AffinePoint::Zero();
+  std::vector<Fr> scalars =
+      base::CreateVector(7, []() { return Fr::Random(); });
+
+  Sha256Writer<G1AffinePoint> expected_writer((base::Uint8VectorBuffer()));
+  for (const G1AffinePoint& point : points) {
+    ASSERT_TRUE(expected_writer.WriteToProof(point));
+  }
+  for (const Fr& scalar : scalars) {
+    ASSERT_TRUE(expected_writer.WriteToProof(scalar));
+  }
+
+  Sha256Writer<G1AffinePoint> writer((base::Uint8VectorBuffer()));
+  ASSERT_TRUE(writer.BatchWriteToProof(absl::MakeConstSpan(points)));
+  ASSERT_TRUE(writer.BatchWriteToProof(absl::MakeConstSpan(scalars)));
+
+  EXPECT_EQ(writer.buffer().owned_buffer(),
+            expected_writer.buffer().owned_buffer());
+  Fr expected_challenge = expected_writer.SqueezeChallenge();
+  EXPECT_EQ(writer.SqueezeChallenge(), expected_challenge);
+
+  base::Buffer read_buf(writer.buffer().buffer(), writer.buffer().buffer_len());
+  Sha256Reader<G1AffinePoint> reader(std::move(read_buf));
+  std::vector<G1AffinePoint> actual_points(points.size());
+  ASSERT_TRUE(reader.BatchReadFromProof(absl::MakeSpan(actual_points)));
+  std::vector<Fr> actual_scalars(scalars.size());
+  ASSERT_TRUE(reader.BatchReadFromProof(absl::MakeSpan(actual_scalars)));
+
+  EXPECT_EQ(actual_points, points);
+  EXPECT_EQ(actual_scalars, scalars);
+  EXPECT_EQ(reader.SqueezeChallenge(), expected_challenge);
+}
+
 TEST_F(Sha256TranscriptTest, SqueezeChallenge) {
   base::Uint8VectorBuffer write_buf;
   Sha256Writer<G1AffinePoint> writer(std::move(write_buf));
@@ -71,4 +108,28 @@ TEST_F(Sha256TranscriptTest, SqueezeChallenge) {
   EXPECT_EQ(expected, actual);
 }
 
+TEST_F(Sha256TranscriptTest, SqueezeChallengeReducesDigest) {
+  // Find a transcript whose digest for the challenge is not less than the
+  // modulus.
+  bool found = false;
+  for (uint64_t i = 0; i < 32 && !found; ++i) {
+    Sha256Writer<G1AffinePoint> writer((base::Uint8VectorBuffer()));
+    ASSERT_TRUE(writer.WriteToTranscript(Fr(i)));
+
+    Sha256Writer<G1AffinePoint> hasher((base::Uint8VectorBuffer()));
+    ASSERT_TRUE(hasher.WriteToTranscript(Fr(i)));
+    hasher.Update(kShaPrefixChallenge, 1);
+    uint8_t digest_bytes[32];
+    hasher.Finalize(digest_bytes);
+    math::BigInt<4> digest = math::BigInt<4>::FromBytesLE(digest_bytes);
+    if (digest < Fr::Config::kModulus) continue;
+
+    SCOPED_TRACE(i);
+    found = true;
+    Fr expected = Fr::FromBigInt(digest % Fr::Config::kModulus);
+    EXPECT_EQ(writer.SqueezeChallenge(), expected);
+  }
+  ASSERT_TRUE(found);
+}
+
 }  // namespace tachyon::zk::halo2
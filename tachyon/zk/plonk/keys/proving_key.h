@@ -160,7 +160,7 @@ class ProvingKey : public Key<PCS> {
             }
           }
         });
-    l_active_row_ = domain->IFFT(evals);
+    l_active_row_ = domain->IFFT(std::move(evals));
 
     vanishing_argument_ =
         VanishingArgument<F>::Create(verifying_key_.constraint_system());
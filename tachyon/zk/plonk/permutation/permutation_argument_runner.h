@@ -48,8 +48,9 @@ class PermutationArgumentRunner {
       ProverBase<PCS>* prover, const PermutationEvaluated<Poly>& evaluated,
       const F& x, PointSet<F>& points);
 
-  template <typename F>
+  template <typename PCS, typename F>
   static std::vector<crypto::PolynomialOpening<Poly>> OpenPermutationProvingKey(
+      const ProverBase<PCS>* prover,
       const PermutationProvingKey<Poly, Evals>& proving_key, const F& x);
 
   template <typename PCS, typename F>
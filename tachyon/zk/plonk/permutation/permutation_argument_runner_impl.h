@@ -11,6 +11,9 @@
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
+#include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/logging.h"
 #include "tachyon/base/ref.h"
 #include "tachyon/zk/base/blinded_polynomial.h"
@@ -91,23 +94,33 @@ PermutationArgumentRunner<Poly, Evals>::EvaluateCommitted(
   std::vector<BlindedPolynomial<Poly>> product_polys =
       std::move(committed).TakeProductPolys();
 
+  F x_next = Rotation::Next().RotateOmega(prover->domain(), x);
+  F x_last =
+      Rotation(-(blinding_factors + 1)).RotateOmega(prover->domain(), x);
+
+  std::vector<const Poly*> polys;
+  std::vector<F> points;
+  polys.reserve(product_polys.size() * 3 - 1);
+  points.reserve(product_polys.size() * 3 - 1);
   for (size_t i = 0; i < product_polys.size(); ++i) {
     const Poly& poly = product_polys[i].poly();
 
-    prover->EvaluateAndWriteToProof(poly, x);
+    polys.push_back(&poly);
+    points.push_back(x);
 
-    F x_next = Rotation::Next().RotateOmega(prover->domain(), x);
-    prover->EvaluateAndWriteToProof(poly, x_next);
+    polys.push_back(&poly);
+    points.push_back(x_next);
 
     // If we have any remaining sets to process, evaluate this set at ωᵘ
     // so we can constrain the last value of its running product to equal the
     // first value of the next set's running product, chaining them together.
     if (i != product_polys.size() - 1) {
-      F x_last =
-          Rotation(-(blinding_factors + 1)).RotateOmega(prover->domain(), x);
-      prover->EvaluateAndWriteToProof(poly, x_last);
+      polys.push_back(&poly);
+      points.push_back(x_last);
     }
   }
+  prover->BatchEvaluateAndWriteToProof(absl::MakeConstSpan(polys),
+                                       absl::MakeConstSpan(points));
 
   return PermutationEvaluated<Poly>(std::move(product_polys));
 }
@@ -130,9 +143,10 @@ PermutationArgumentRunner<Poly, Evals>::OpenEvaluated(
   base::DeepRef<const F> x_ref = points.Insert(x);
   for (const BlindedPolynomial<Poly>& blinded_poly : product_polys) {
     const Poly& poly = blinded_poly.poly();
-    ret.emplace_back(base::DeepRef<const Poly>(&poly), x_ref, poly.Evaluate(x));
+    ret.emplace_back(base::DeepRef<const Poly>(&poly), x_ref,
+                     prover->Evaluate(poly, x));
     ret.emplace_back(base::DeepRef<const Poly>(&poly), x_next_ref,
-                     poly.Evaluate(x_next));
+                     prover->Evaluate(poly, x_next));
   }
 
   Rotation last_rotation =
@@ -142,20 +156,21 @@ PermutationArgumentRunner<Poly, Evals>::OpenEvaluated(
   for (auto it = product_polys.rbegin() + 1; it != product_polys.rend(); ++it) {
     const Poly& poly = it->poly();
     ret.emplace_back(base::DeepRef<const Poly>(&poly), x_last_ref,
-                     poly.Evaluate(x_last));
+                     prover->Evaluate(poly, x_last));
   }
   return ret;
 }
 
 template <typename Poly, typename Evals>
-template <typename F>
+template <typename PCS, typename F>
 std::vector<crypto::PolynomialOpening<Poly>>
 PermutationArgumentRunner<Poly, Evals>::OpenPermutationProvingKey(
+    const ProverBase<PCS>* prover,
     const PermutationProvingKey<Poly, Evals>& proving_key, const F& x) {
-  return base::Map(proving_key.polys(), [&x](const Poly& poly) {
+  return base::Map(proving_key.polys(), [prover, &x](const Poly& poly) {
     return crypto::PolynomialOpening<Poly>(base::DeepRef<const Poly>(&poly),
                                            base::DeepRef<const F>(&x),
-                                           poly.Evaluate(x));
+                                           prover->Evaluate(poly, x));
   });
 }
 
@@ -164,9 +179,11 @@ template <typename PCS, typename F>
 void PermutationArgumentRunner<Poly, Evals>::EvaluateProvingKey(
     ProverBase<PCS>* prover,
     const PermutationProvingKey<Poly, Evals>& proving_key, const F& x) {
-  for (const Poly& poly : proving_key.polys()) {
-    prover->EvaluateAndWriteToProof(poly, x);
-  }
+  std::vector<const Poly*> polys = base::Map(
+      proving_key.polys(), [](const Poly& poly) { return &poly; });
+  std::vector<F> points(polys.size(), x);
+  prover->BatchEvaluateAndWriteToProof(absl::MakeConstSpan(polys),
+                                       absl::MakeConstSpan(points));
 }
 
 template <typename Poly, typename Evals>
@@ -50,7 +50,7 @@ template <typename PCS>
 template <typename PCS, typename ExtendedEvals>
 [[nodiscard]] bool CommitFinalHPoly(
     ProverBase<PCS>* prover, VanishingCommitted<PCS>&& committed,
-    const VerifyingKey<PCS>& vk, ExtendedEvals& circuit_column,
+    const VerifyingKey<PCS>& vk, ExtendedEvals&& circuit_column,
     VanishingConstructed<PCS>* constructed_out) {
   using F = typename PCS::Field;
   using Commitment = typename PCS::Commitment;
@@ -59,12 +59,12 @@ template <typename PCS, typename ExtendedEvals>
   using ExtendedPoly = typename PCS::ExtendedPoly;
 
   // Divide by t(X) = X^{params.n} - 1.
-  ExtendedEvals h_evals = DivideByVanishingPolyInPlace<F>(
-      circuit_column, prover->extended_domain(), prover->domain());
+  DivideByVanishingPolyInPlace<F>(circuit_column, prover->extended_domain(),
+                                  prover->domain());
 
   // Obtain final h(X) polynomial
-  ExtendedPoly h_poly =
-      ExtendedToCoeff<F, ExtendedPoly>(h_evals, prover->extended_domain());
+  ExtendedPoly h_poly = ExtendedToCoeff<F, ExtendedPoly>(
+      std::move(circuit_column), prover->extended_domain());
 
   // Truncate it to match the size of the quotient polynomial; the
   // evaluation domain might be slightly larger than necessary because
@@ -97,7 +97,7 @@ TEST_F(VanishingArgumentTest, VanishingArgument) {
       ExtendedEvals::One(prover_->extended_domain()->size() - 1);
   VanishingConstructed<PCS> constructed_p;
   ASSERT_TRUE(CommitFinalHPoly(prover_.get(), std::move(committed_p), vkey,
-                               extended_evals, &constructed_p));
+                               std::move(extended_evals), &constructed_p));
 
   F x = F::One();
   VanishingEvaluated<PCS> evaluated;
@@ -145,11 +145,11 @@ void DistributePowersZeta(ExtendedPoly& poly, bool into_coset) {
 // This function will panic if the provided vector is not the correct length.
 template <typename F, typename ExtendedPoly, typename ExtendedEvals,
           typename ExtendedDomain>
-ExtendedPoly ExtendedToCoeff(const ExtendedEvals& evals,
+ExtendedPoly ExtendedToCoeff(ExtendedEvals&& evals,
                              const ExtendedDomain* extended_domain) {
   CHECK_EQ(evals.NumElements(), extended_domain->size());
 
-  ExtendedPoly poly = extended_domain->IFFT(evals);
+  ExtendedPoly poly = extended_domain->IFFT(std::move(evals));
 
   // Distribute powers to move from coset; opposite from the
   // transformation we performed earlier.
@@ -160,21 +160,29 @@ ExtendedPoly ExtendedToCoeff(const ExtendedEvals& evals,
 
 template <typename Domain, typename Poly, typename F,
           typename Evals = typename Domain::Evals>
-Evals CoeffToExtendedPart(const Domain* domain,
-                          const BlindedPolynomial<Poly>& poly, const F& zeta,
+Evals CoeffToExtendedPart(const Domain* domain, const Poly& poly, const F& zeta,
                           const F& extended_omega_factor) {
-  Poly cloned = poly.poly();
+  using Coeffs = typename Poly::Coefficients;
+
+  // NOTE: The coefficients are copied into a buffer that is already
+  // large enough to hold the evaluations over |domain|. This way, the powers
+  // are distributed and the FFT is done on the buffer in place, instead of
+  // cloning |poly| and then allocating the evaluations again.
+  const std::vector<F>& coefficients = poly.coefficients().coefficients();
+  std::vector<F> buffer;
+  buffer.reserve(domain->size());
+  buffer.assign(coefficients.begin(), coefficients.end());
+  Poly cloned(Coeffs(std::move(buffer)));
   Domain::DistributePowers(cloned, zeta * extended_omega_factor);
-  return domain->FFT(cloned);
+  return domain->FFT(std::move(cloned));
 }
 
 template <typename Domain, typename Poly, typename F,
           typename Evals = typename Domain::Evals>
-Evals CoeffToExtendedPart(const Domain* domain, const Poly& poly, const F& zeta,
+Evals CoeffToExtendedPart(const Domain* domain,
+                          const BlindedPolynomial<Poly>& poly, const F& zeta,
                           const F& extended_omega_factor) {
-  Poly cloned = poly;
-  Domain::DistributePowers(cloned, zeta * extended_omega_factor);
-  return domain->FFT(cloned);
+  return CoeffToExtendedPart(domain, poly.poly(), zeta, extended_omega_factor);
 }
 
 template <typename Domain, typename Poly, typename F,
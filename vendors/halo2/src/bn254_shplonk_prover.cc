@@ -1,5 +1,7 @@
 #include "vendors/halo2/include/bn254_shplonk_prover.h"
 
+#include "absl/types/span.h"
+
 #include "tachyon/base/buffer/buffer.h"
 #include "tachyon/math/elliptic_curves/msm/variable_base_msm.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluation_domain_factory.h"
@@ -14,7 +16,7 @@ namespace tachyon::halo2_api::bn254 {
 namespace {
 
 rust::Box<G1JacobianPoint> DoCommit(
-    const std::vector<math::bn254::G1AffinePoint>& cpp_bases,
+    absl::Span<const math::bn254::G1AffinePoint> cpp_bases,
     rust::Slice<const Fr> scalars) {
   math::VariableBaseMSM<math::bn254::G1AffinePoint> msm;
   math::VariableBaseMSM<math::bn254::G1AffinePoint>::Bucket bucket;